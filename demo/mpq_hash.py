@@ -0,0 +1,33 @@
+import gmpy2
+import timeit
+
+# Measure the cost of hashing an mpq for numerators and denominators of
+# increasing size.
+#
+# The hash of an mpq is cached after the first call, so every iteration
+# hashes a freshly created value ("-x"); the cost of creating it is
+# measured separately and subtracted. hash(Fraction) is shown for
+# comparison. Run the script before and after a change to compare.
+
+NUMBER = 100000
+REPEAT = 7
+SIZES = (32, 64, 128, 256, 1024, 4096, 16384)
+
+def bench(stmt, x):
+    t = timeit.repeat(stmt, number = NUMBER, repeat = REPEAT,
+                      globals = {"x": x})
+    return min(t) / NUMBER * 1e9
+
+if __name__ == "__main__":
+    from fractions import Fraction
+
+    rand = gmpy2.random_state(42)
+    print("%8s  %14s  %14s" % ("bits", "mpq hash (ns)", "Fraction (ns)"))
+    for bits in SIZES:
+        num = gmpy2.mpz_urandomb(rand, bits) | 1
+        den = gmpy2.mpz_urandomb(rand, bits) | 1
+        x = gmpy2.mpq(num, den)
+        t = bench("hash(-x)", x) - bench("-x", x)
+        f = Fraction(int(x.numerator), int(x.denominator))
+        tf = bench("hash(-x)", f) - bench("-x", f)
+        print("%8d  %14.1f  %14.1f" % (bits, t, tf))
@@ -0,0 +1,44 @@
+import gmpy2
+import timeit
+
+# Measure reading and assigning slices of an xmpz used as a bitset.
+#
+# Slices of a non-negative xmpz are read and written a limb at a time:
+# contiguous slices are shifted and masked as whole limbs, and strided
+# slices are gathered into or scattered from whole limbs. Setting or
+# clearing a slice uses the same code as set_progression() and
+# clear_progression(). The last two cases compare a loop of slice
+# assignments with sieve_clear(). Run the script before and after a change
+# to compare.
+
+BITS = 1 << 20
+REPEAT = 5
+PRIMES = [p for p in range(3, 1000) if gmpy2.is_prime(p)]
+OFFSETS = [p * p for p in PRIMES]
+
+def bench(stmt, number):
+    g = dict(globals())
+    setup = "x = gmpy2.xmpz(0); x[0:BITS] = -1; y = gmpy2.xmpz(0)"
+    t = timeit.repeat(stmt, setup, number = number, repeat = REPEAT, globals = g)
+    return min(t) / number * 1e6
+
+CASES = [
+    ("get x[:]", "x[0:BITS]"),
+    ("get x[1000:BITS-1000]", "x[1000:BITS-1000]"),
+    ("get x[::3]", "x[::3]"),
+    ("get x[::97]", "x[::97]"),
+    ("set y[:] = -1", "y[0:BITS] = -1"),
+    ("set x[7:BITS-7] = 0", "x[7:BITS-7] = 0"),
+    ("set y[5:BITS+5] = x", "y[5:BITS+5] = x"),
+    ("set x[::3] = 0", "x[::3] = 0"),
+    ("set y[::97] = -1", "y[0:BITS:97] = -1"),
+    ("set y[::2] = x", "y[0:2*BITS:2] = x"),
+    ("x.clear_progression()", "x.clear_progression(1, 3, BITS)"),
+    ("x[p*p::p] = 0, p < 1000", "for p, o in zip(PRIMES, OFFSETS): x[o::p] = 0"),
+    ("x.sieve_clear(), p < 1000", "x.sieve_clear(PRIMES, OFFSETS)"),
+]
+
+if __name__ == "__main__":
+    print("%d-bit xmpz" % BITS)
+    for label, stmt in CASES:
+        print("%-24s %10.1f us" % (label, bench(stmt, 10)))
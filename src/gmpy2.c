@@ -125,6 +125,14 @@ LGPL 3 or later.";
 #define MAX_CACHE_MPZ_LIMBS (64)
 #define MAX_CACHE_MPFR_BITS (1024)
 
+/* The mpfr and mpc caches are split into buckets by precision. Bucket b
+ * holds objects with a precision of at most (64 << b) bits, and the
+ * significands of those objects are always allocated for the largest
+ * precision in the bucket.
+ */
+#define CACHE_MPFR_BUCKETS (5)
+#define CACHE_MPFR_BUCKET_BITS(b) (((mpfr_prec_t)64) << (b))
+
 typedef struct {
     MPZ_Object *gmpympzcache[CACHE_SIZE+1];
     int in_gmpympzcache;
@@ -135,11 +143,29 @@ typedef struct {
     MPQ_Object *gmpympqcache[CACHE_SIZE+1];
     int in_gmpympqcache;
 
-    MPFR_Object *gmpympfrcache[CACHE_SIZE+1];
-    int in_gmpympfrcache;
-
-    MPC_Object *gmpympccache[CACHE_SIZE+1];
-    int in_gmpympccache;
+    MPFR_Object *gmpympfrcache[CACHE_MPFR_BUCKETS][CACHE_SIZE+1];
+    int in_gmpympfrcache[CACHE_MPFR_BUCKETS];
+    Py_ssize_t gmpympfrcache_hits[CACHE_MPFR_BUCKETS];
+    Py_ssize_t gmpympfrcache_misses[CACHE_MPFR_BUCKETS];
+
+    MPC_Object *gmpympccache[CACHE_MPFR_BUCKETS][CACHE_SIZE+1];
+    int in_gmpympccache[CACHE_MPFR_BUCKETS];
+    Py_ssize_t gmpympccache_hits[CACHE_MPFR_BUCKETS];
+    Py_ssize_t gmpympccache_misses[CACHE_MPFR_BUCKETS];
+
+    /* Table of small primes shared by the combinatorial functions in
+     * gmpy2_mpz_misc.c. It is extended on demand and is owned by a capsule
+     * in the thread state dict, so it is freed at thread exit or by
+     * free_cache().
+     */
+    unsigned long *primes;
+    Py_ssize_t in_primes;
+    unsigned long primes_limit;
+
+    /* Cache of constant values, see gmpy2_const.c. Like the prime table it
+     * is owned by a capsule in the thread state dict.
+     */
+    GMPy_Const_Cache *consts;
 } gmpy_global;
 
 #if !defined(_MSC_VER)
@@ -152,8 +178,12 @@ _Py_thread_local gmpy_global global = {
     .in_gmpympzcache = 0,
     .in_gmpyxmpzcache = 0,
     .in_gmpympqcache = 0,
-    .in_gmpympfrcache = 0,
-    .in_gmpympccache = 0,
+    .in_gmpympfrcache = {0},
+    .in_gmpympccache = {0},
+    .primes = NULL,
+    .in_primes = 0,
+    .primes_limit = 0,
+    .consts = NULL,
 };
 
 /* Support for context manager using context vars.
@@ -161,6 +191,10 @@ _Py_thread_local gmpy_global global = {
 
 static PyObject *current_context_var = NULL;
 
+/* Functions registered with register_constant(), keyed by name. */
+
+static PyObject *registered_constants = NULL;
+
 /* Define gmpy2 specific errors for mpfr and mpc data types. No change will
  * be made the exceptions raised by mpz, xmpz, and mpq.
  */
@@ -209,6 +243,10 @@ static PyObject *GMPyExc_Erange = NULL;
 
 #include "gmpy_mpz_prp.c"
 
+/* Support for Chinese remaindering with a precomputed basis. */
+
+#include "gmpy2_mpz_crt.c"
+
 /* Include helper functions for mpmath. */
 
 #include "gmpy2_mpmath.c"
@@ -238,6 +276,7 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_format.c"
 #include "gmpy2_hash.c"
 #include "gmpy2_fused.c"
+#include "gmpy2_poly.c"
 #include "gmpy2_muldiv_2exp.c"
 #include "gmpy2_predicate.c"
 #include "gmpy2_sign.c"
@@ -249,18 +288,24 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_mpz_misc.c"
 #include "gmpy2_xmpz_misc.c"
 #include "gmpy2_xmpz_limbs.c"
+#include "gmpy2_xmpz_rank.c"
 
-#ifdef VECTOR
+#include "gmpy2_mpfr_array.c"
+#include "gmpy2_mpfr_accumulator.c"
+#include "gmpy2_mpq_accumulator.c"
+#include "gmpy2_mpq_cf.c"
 #include "gmpy2_vector.c"
-#endif
 
 /* Include gmpy_context last to avoid adding doc names to .h files. */
 
 #include "gmpy2_mpz.c"
 #include "gmpy2_xmpz.c"
 #include "gmpy2_mpq.c"
+#include "gmpy2_xmpq.c"
 #include "gmpy2_mpfr.c"
+#include "gmpy2_xmpfr.c"
 #include "gmpy2_mpc.c"
+#include "gmpy2_xmpc.c"
 
 #include "gmpy2_context.c"
 
@@ -276,40 +321,46 @@ static PyMethodDef Pygmpy_methods [] =
     { "bit_scan1", (PyCFunction)GMPy_MPZ_bit_scan1_function, METH_FASTCALL, doc_bit_scan1_function },
     { "bit_set", GMPy_MPZ_bit_set_function, METH_VARARGS, doc_bit_set_function },
     { "bit_test", (PyCFunction)GMPy_MPZ_bit_test_function, METH_FASTCALL, doc_bit_test_function },
-    { "bincoef", (PyCFunction)GMPy_MPZ_Function_Bincoef, METH_FASTCALL, GMPy_doc_mpz_function_bincoef },
+    { "bincoef", (PyCFunction)GMPy_MPZ_Function_Bincoef, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_bincoef },
+    { "bincoef_mod", (PyCFunction)GMPy_MPZ_Function_BincoefMod, METH_FASTCALL, GMPy_doc_mpz_function_bincoef_mod },
     { "cmp", GMPy_MPANY_cmp, METH_VARARGS, GMPy_doc_mpany_cmp },
     { "cmp_abs", GMPy_MPANY_cmp_abs, METH_VARARGS, GMPy_doc_mpany_cmp_abs },
-    { "comb", (PyCFunction)GMPy_MPZ_Function_Bincoef, METH_FASTCALL, GMPy_doc_mpz_function_comb },
-    { "c_div", GMPy_MPZ_c_div, METH_VARARGS, doc_c_div },
-    { "c_div_2exp", GMPy_MPZ_c_div_2exp, METH_VARARGS, doc_c_div_2exp },
+    { "comb", (PyCFunction)GMPy_MPZ_Function_Bincoef, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_comb },
+    { "continued_fraction", (PyCFunction)GMPy_MPQ_Function_ContinuedFraction, METH_FASTCALL, GMPy_doc_mpq_function_continued_fraction },
+    { "convergents", (PyCFunction)GMPy_MPQ_Function_Convergents, METH_FASTCALL, GMPy_doc_mpq_function_convergents },
+    { "c_div", (PyCFunction)GMPy_MPZ_c_div, METH_FASTCALL | METH_KEYWORDS, doc_c_div },
+    { "c_div_2exp", (PyCFunction)GMPy_MPZ_c_div_2exp, METH_FASTCALL | METH_KEYWORDS, doc_c_div_2exp },
     { "c_divmod", GMPy_MPZ_c_divmod, METH_VARARGS, doc_c_divmod },
     { "c_divmod_2exp", GMPy_MPZ_c_divmod_2exp, METH_VARARGS, doc_c_divmod_2exp },
-    { "c_mod", GMPy_MPZ_c_mod, METH_VARARGS, doc_c_mod },
-    { "c_mod_2exp", GMPy_MPZ_c_mod_2exp, METH_VARARGS, doc_c_mod_2exp },
+    { "c_mod", (PyCFunction)GMPy_MPZ_c_mod, METH_FASTCALL | METH_KEYWORDS, doc_c_mod },
+    { "c_mod_2exp", (PyCFunction)GMPy_MPZ_c_mod_2exp, METH_FASTCALL | METH_KEYWORDS, doc_c_mod_2exp },
     { "denom", GMPy_MPQ_Function_Denom, METH_O, GMPy_doc_mpq_function_denom },
     { "digits", GMPy_Context_Digits, METH_VARARGS, GMPy_doc_context_digits },
     { "div", GMPy_Context_TrueDiv, METH_VARARGS, GMPy_doc_truediv },
     { "divexact", (PyCFunction)GMPy_MPZ_Function_Divexact, METH_FASTCALL, GMPy_doc_mpz_function_divexact },
     { "divm", (PyCFunction)GMPy_MPZ_Function_Divm, METH_FASTCALL, GMPy_doc_mpz_function_divm },
-    { "double_fac", GMPy_MPZ_Function_DoubleFac, METH_O, GMPy_doc_mpz_function_double_fac },
-    { "fac", GMPy_MPZ_Function_Fac, METH_O, GMPy_doc_mpz_function_fac },
-    { "fib", GMPy_MPZ_Function_Fib, METH_O, GMPy_doc_mpz_function_fib },
+    { "double_fac", (PyCFunction)GMPy_MPZ_Function_DoubleFac, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_double_fac },
+    { "fac", (PyCFunction)GMPy_MPZ_Function_Fac, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_fac },
+    { "falling_factorial", (PyCFunction)GMPy_MPZ_Function_FallingFactorial, METH_FASTCALL, GMPy_doc_mpz_function_falling_factorial },
+    { "fib", (PyCFunction)GMPy_MPZ_Function_Fib, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_fib },
     { "fib2", GMPy_MPZ_Function_Fib2, METH_O, GMPy_doc_mpz_function_fib2 },
     { "floor_div", GMPy_Context_FloorDiv, METH_VARARGS, GMPy_doc_floordiv },
     { "from_binary", GMPy_MPANY_From_Binary, METH_O, doc_from_binary },
-    { "f_div", GMPy_MPZ_f_div, METH_VARARGS, doc_f_div },
-    { "f_div_2exp", GMPy_MPZ_f_div_2exp, METH_VARARGS, doc_f_div_2exp },
+    { "f_div", (PyCFunction)GMPy_MPZ_f_div, METH_FASTCALL | METH_KEYWORDS, doc_f_div },
+    { "f_div_2exp", (PyCFunction)GMPy_MPZ_f_div_2exp, METH_FASTCALL | METH_KEYWORDS, doc_f_div_2exp },
     { "f_divmod", GMPy_MPZ_f_divmod, METH_VARARGS, doc_f_divmod },
     { "f_divmod_2exp", GMPy_MPZ_f_divmod_2exp, METH_VARARGS, doc_f_divmod_2exp },
-    { "f_mod", GMPy_MPZ_f_mod, METH_VARARGS, doc_f_mod },
-    { "f_mod_2exp", GMPy_MPZ_f_mod_2exp, METH_VARARGS, doc_f_mod_2exp },
-    { "gcd", (PyCFunction)GMPy_MPZ_Function_GCD, METH_FASTCALL, GMPy_doc_mpz_function_gcd },
+    { "f_mod", (PyCFunction)GMPy_MPZ_f_mod, METH_FASTCALL | METH_KEYWORDS, doc_f_mod },
+    { "f_mod_2exp", (PyCFunction)GMPy_MPZ_f_mod_2exp, METH_FASTCALL | METH_KEYWORDS, doc_f_mod_2exp },
+    { "gcd", (PyCFunction)GMPy_MPZ_Function_GCD, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_gcd },
     { "gcdext", (PyCFunction)GMPy_MPZ_Function_GCDext, METH_FASTCALL, GMPy_doc_mpz_function_gcdext },
     { "hamdist", GMPy_MPZ_hamdist, METH_VARARGS, doc_hamdist },
-    { "invert", (PyCFunction)GMPy_MPZ_Function_Invert, METH_FASTCALL, GMPy_doc_mpz_function_invert },
+    { "hamdist_many", (PyCFunction)GMPy_MPZ_hamdist_many, METH_VARARGS | METH_KEYWORDS, doc_hamdist_many },
+    { "invert", (PyCFunction)GMPy_MPZ_Function_Invert, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_invert },
+    { "invert_many", (PyCFunction)GMPy_MPZ_Function_InvertMany, METH_FASTCALL, GMPy_doc_mpz_function_invert_many },
     { "iroot", (PyCFunction)GMPy_MPZ_Function_Iroot, METH_FASTCALL, GMPy_doc_mpz_function_iroot },
     { "iroot_rem", (PyCFunction)GMPy_MPZ_Function_IrootRem, METH_FASTCALL, GMPy_doc_mpz_function_iroot_rem },
-    { "isqrt", GMPy_MPZ_Function_Isqrt, METH_O, GMPy_doc_mpz_function_isqrt },
+    { "isqrt", (PyCFunction)GMPy_MPZ_Function_Isqrt, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_isqrt },
     { "isqrt_rem", GMPy_MPZ_Function_IsqrtRem, METH_O, GMPy_doc_mpz_function_isqrt_rem },
     { "is_bpsw_prp", GMPY_mpz_is_bpsw_prp, METH_VARARGS, doc_mpz_is_bpsw_prp },
     { "is_congruent", (PyCFunction)GMPy_MPZ_Function_IsCongruent, METH_FASTCALL, GMPy_doc_mpz_function_is_congruent },
@@ -332,12 +383,16 @@ static PyMethodDef Pygmpy_methods [] =
     { "is_strong_selfridge_prp", GMPY_mpz_is_strongselfridge_prp, METH_VARARGS, doc_mpz_is_strongselfridge_prp },
     { "jacobi", (PyCFunction)GMPy_MPZ_Function_Jacobi, METH_FASTCALL, GMPy_doc_mpz_function_jacobi },
     { "kronecker", (PyCFunction)GMPy_MPZ_Function_Kronecker, METH_FASTCALL, GMPy_doc_mpz_function_kronecker },
-    { "lcm", (PyCFunction)GMPy_MPZ_Function_LCM, METH_FASTCALL, GMPy_doc_mpz_function_lcm },
+    { "lcm", (PyCFunction)GMPy_MPZ_Function_LCM, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_lcm },
     { "legendre", (PyCFunction)GMPy_MPZ_Function_Legendre, METH_FASTCALL, GMPy_doc_mpz_function_legendre },
     { "license", GMPy_get_license, METH_NOARGS, GMPy_doc_license },
-    { "lucas", GMPy_MPZ_Function_Lucas, METH_O, GMPy_doc_mpz_function_lucas },
+    { "lucas", (PyCFunction)GMPy_MPZ_Function_Lucas, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_lucas },
     { "lucasu", GMPY_mpz_lucasu, METH_VARARGS, doc_mpz_lucasu },
     { "lucasu_mod", GMPY_mpz_lucasu_mod, METH_VARARGS, doc_mpz_lucasu_mod },
+    { "lucasuv", GMPY_mpz_lucasuv, METH_VARARGS, doc_mpz_lucasuv },
+    { "lucasuv_mod", GMPY_mpz_lucasuv_mod, METH_VARARGS, doc_mpz_lucasuv_mod },
+    { "lucasuv_mod_batch", GMPY_mpz_lucasuv_mod_batch, METH_O, doc_mpz_lucasuv_mod_batch },
+    { "lucasuv_mod_list", GMPY_mpz_lucasuv_mod_list, METH_VARARGS, doc_mpz_lucasuv_mod_list },
     { "lucasv", GMPY_mpz_lucasv, METH_VARARGS, doc_mpz_lucasv },
     { "lucasv_mod", GMPY_mpz_lucasv_mod, METH_VARARGS, doc_mpz_lucasv_mod },
     { "lucas2", GMPy_MPZ_Function_Lucas2, METH_O, GMPy_doc_mpz_function_lucas2 },
@@ -347,13 +402,14 @@ static PyMethodDef Pygmpy_methods [] =
     { "mpc_version", GMPy_get_mpc_version, METH_NOARGS, GMPy_doc_mpc_version },
     { "mpfr_version", GMPy_get_mpfr_version, METH_NOARGS, GMPy_doc_mpfr_version },
     { "mpq_from_old_binary", GMPy_MPQ_From_Old_Binary, METH_O, doc_mpq_from_old_binary },
+    { "mpq_sum", GMPy_MPQ_Function_Sum, METH_O, GMPy_doc_mpq_function_sum },
     { "mpz_from_old_binary", GMPy_MPZ_From_Old_Binary, METH_O, doc_mpz_from_old_binary },
     { "mpz_random", GMPy_MPZ_random_Function, METH_VARARGS, GMPy_doc_mpz_random_function },
     { "mpz_rrandomb", GMPy_MPZ_rrandomb_Function, METH_VARARGS, GMPy_doc_mpz_rrandomb_function },
     { "mpz_urandomb", GMPy_MPZ_urandomb_Function, METH_VARARGS, GMPy_doc_mpz_urandomb_function },
     { "mul", GMPy_Context_Mul, METH_VARARGS, GMPy_doc_function_mul },
-    { "multi_fac", (PyCFunction)GMPy_MPZ_Function_MultiFac, METH_FASTCALL, GMPy_doc_mpz_function_multi_fac },
-    { "next_prime", GMPy_MPZ_Function_NextPrime, METH_O, GMPy_doc_mpz_function_next_prime },
+    { "multi_fac", (PyCFunction)GMPy_MPZ_Function_MultiFac, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_multi_fac },
+    { "next_prime", (PyCFunction)GMPy_MPZ_Function_NextPrime, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_next_prime },
 #if (__GNU_MP_VERSION > 6) || (__GNU_MP_VERSION == 6 &&  __GNU_MP_VERSION_MINOR >= 3)
     { "prev_prime", GMPy_MPZ_Function_PrevPrime, METH_O, GMPy_doc_mpz_function_prev_prime },
 #endif
@@ -361,29 +417,38 @@ static PyMethodDef Pygmpy_methods [] =
     { "num_digits", (PyCFunction)GMPy_MPZ_Function_NumDigits, METH_FASTCALL, GMPy_doc_mpz_function_num_digits },
     { "pack", GMPy_MPZ_pack, METH_VARARGS, doc_pack },
     { "popcount", GMPy_MPZ_popcount, METH_O, doc_popcount },
-    { "powmod", GMPy_Integer_PowMod, METH_VARARGS, GMPy_doc_integer_powmod },
+    { "popcount_many", (PyCFunction)GMPy_MPZ_popcount_many, METH_VARARGS | METH_KEYWORDS, doc_popcount_many },
+    { "powmod", (PyCFunction)GMPy_Integer_PowMod, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_integer_powmod },
     { "powmod_base_list", GMPy_Integer_PowMod_Base_List, METH_VARARGS, GMPy_doc_integer_powmod_base_list },
     { "powmod_exp_list", GMPy_Integer_PowMod_Exp_List, METH_VARARGS, GMPy_doc_integer_powmod_exp_list },
     { "powmod_sec", GMPy_Integer_PowMod_Sec, METH_VARARGS, GMPy_doc_integer_powmod_sec },
-    { "primorial", GMPy_MPZ_Function_Primorial, METH_O, GMPy_doc_mpz_function_primorial },
+    { "primorial", (PyCFunction)GMPy_MPZ_Function_Primorial, METH_FASTCALL | METH_KEYWORDS, GMPy_doc_mpz_function_primorial },
     { "qdiv", GMPy_MPQ_Function_Qdiv, METH_VARARGS, GMPy_doc_function_qdiv },
     { "remove", (PyCFunction)GMPy_MPZ_Function_Remove, METH_FASTCALL, GMPy_doc_mpz_function_remove },
+    { "rising_factorial", (PyCFunction)GMPy_MPZ_Function_RisingFactorial, METH_FASTCALL, GMPy_doc_mpz_function_rising_factorial },
     { "random_state", GMPy_RandomState_Factory, METH_VARARGS, GMPy_doc_random_state_factory },
+    { "range_product", (PyCFunction)GMPy_MPZ_Function_RangeProduct, METH_FASTCALL, GMPy_doc_mpz_function_range_product },
+    { "rational_reconstruct", (PyCFunction)GMPy_MPQ_Function_RationalReconstruct, METH_FASTCALL, GMPy_doc_mpq_function_rational_reconstruct },
     { "sign", GMPy_Context_Sign, METH_O, GMPy_doc_function_sign },
+    { "sqrtmod", (PyCFunction)GMPy_MPZ_Function_Sqrtmod, METH_FASTCALL, GMPy_doc_mpz_function_sqrtmod },
+    { "sqrtmod_list", (PyCFunction)GMPy_MPZ_Function_SqrtmodList, METH_FASTCALL, GMPy_doc_mpz_function_sqrtmod_list },
+    { "sqrtmod_prime_power", (PyCFunction)GMPy_MPZ_Function_SqrtmodPrimePower, METH_FASTCALL, GMPy_doc_mpz_function_sqrtmod_prime_power },
+    { "sqrtmod_prime_power_list", (PyCFunction)GMPy_MPZ_Function_SqrtmodPrimePowerList, METH_FASTCALL, GMPy_doc_mpz_function_sqrtmod_prime_power_list },
     { "square", GMPy_Context_Square, METH_O, GMPy_doc_function_square },
     { "sub", GMPy_Context_Sub, METH_VARARGS, GMPy_doc_sub },
     { "to_binary", GMPy_MPANY_To_Binary, METH_O, doc_to_binary },
-    { "t_div", GMPy_MPZ_t_div, METH_VARARGS, doc_t_div },
-    { "t_div_2exp", GMPy_MPZ_t_div_2exp, METH_VARARGS, doc_t_div_2exp },
+    { "t_div", (PyCFunction)GMPy_MPZ_t_div, METH_FASTCALL | METH_KEYWORDS, doc_t_div },
+    { "t_div_2exp", (PyCFunction)GMPy_MPZ_t_div_2exp, METH_FASTCALL | METH_KEYWORDS, doc_t_div_2exp },
     { "t_divmod", GMPy_MPZ_t_divmod, METH_VARARGS, doc_t_divmod },
     { "t_divmod_2exp", GMPy_MPZ_t_divmod_2exp, METH_VARARGS, doc_t_divmod_2exp },
-    { "t_mod", GMPy_MPZ_t_mod, METH_VARARGS, doc_t_mod },
-    { "t_mod_2exp", GMPy_MPZ_t_mod_2exp, METH_VARARGS, doc_t_mod_2exp },
+    { "t_mod", (PyCFunction)GMPy_MPZ_t_mod, METH_FASTCALL | METH_KEYWORDS, doc_t_mod },
+    { "t_mod_2exp", (PyCFunction)GMPy_MPZ_t_mod_2exp, METH_FASTCALL | METH_KEYWORDS, doc_t_mod_2exp },
     { "unpack", GMPy_MPZ_unpack, METH_VARARGS, doc_unpack },
     { "version", GMPy_get_version, METH_NOARGS, GMPy_doc_version },
     { "xbit_mask", GMPy_XMPZ_Function_XbitMask, METH_O, GMPy_doc_xmpz_function_xbit_mask },
     { "_mpmath_normalize", (PyCFunction)Pympz_mpmath_normalize_fast, METH_FASTCALL, doc_mpmath_normalizeg },
     { "_mpmath_create", (PyCFunction)Pympz_mpmath_create_fast, METH_FASTCALL, doc_mpmath_create },
+    { "_cache_stats", GMPy_Cache_Stats, METH_NOARGS, GMPy_doc_cache_stats },
 
     { "acos", GMPy_Context_Acos, METH_O, GMPy_doc_function_acos },
     { "acosh", GMPy_Context_Acosh, METH_O, GMPy_doc_function_acosh },
@@ -402,6 +467,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "const_euler", (PyCFunction)GMPy_Function_Const_Euler, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_const_euler },
     { "const_log2", (PyCFunction)GMPy_Function_Const_Log2, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_const_log2 },
     { "const_pi", (PyCFunction)GMPy_Function_Const_Pi, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_const_pi },
+    { "constant", (PyCFunction)GMPy_Function_Constant, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_constant },
     { "copy_sign", GMPy_MPFR_copy_sign, METH_VARARGS, GMPy_doc_mpfr_copy_sign },
     { "cos", GMPy_Context_Cos, METH_O, GMPy_doc_function_cos },
     { "cosh", GMPy_Context_Cosh, METH_O, GMPy_doc_function_cosh },
@@ -415,13 +481,17 @@ static PyMethodDef Pygmpy_methods [] =
     { "eint", GMPy_Context_Eint, METH_O, GMPy_doc_function_eint },
     { "erf", GMPy_Context_Erf, METH_O, GMPy_doc_function_erf },
     { "erfc", GMPy_Context_Erfc, METH_O, GMPy_doc_function_erfc },
+    { "erf_erfc", GMPy_Context_Erf_Erfc, METH_O, GMPy_doc_function_erf_erfc },
+    { "evaluate_to", (PyCFunction)GMPy_Context_Evaluate_To, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_evaluate_to },
     { "exp", GMPy_Context_Exp, METH_O, GMPy_doc_function_exp },
     { "expm1", GMPy_Context_Expm1, METH_O, GMPy_doc_function_expm1 },
     { "exp10", GMPy_Context_Exp10, METH_O, GMPy_doc_function_exp10 },
     { "exp2", GMPy_Context_Exp2, METH_O, GMPy_doc_function_exp2 },
+    { "exp_expm1", GMPy_Context_Exp_Expm1, METH_O, GMPy_doc_function_exp_expm1 },
     { "f2q", GMPy_Context_F2Q, METH_VARARGS, GMPy_doc_function_f2q },
     { "factorial", GMPy_Context_Factorial, METH_O, GMPy_doc_function_factorial },
     { "floor", GMPy_Context_Floor, METH_O, GMPy_doc_function_floor },
+    { "fdot", GMPy_Context_Fdot, METH_VARARGS, GMPy_doc_function_fdot },
     { "fma", GMPy_Context_FMA, METH_VARARGS, GMPy_doc_function_fma },
     { "fms", GMPy_Context_FMS, METH_VARARGS, GMPy_doc_function_fms },
     { "fmma", GMPy_Context_FMMA, METH_VARARGS, GMPy_doc_function_fmma },
@@ -433,6 +503,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "fsum", GMPy_Context_Fsum, METH_O, GMPy_doc_function_fsum },
     { "gamma", GMPy_Context_Gamma, METH_O, GMPy_doc_function_gamma },
     { "gamma_inc", GMPy_Context_Gamma_Inc, METH_VARARGS, GMPy_doc_function_gamma_inc },
+    { "gamma_lgamma", GMPy_Context_Gamma_Lgamma, METH_O, GMPy_doc_function_gamma_lgamma },
     { "get_context", GMPy_CTXT_Get, METH_NOARGS, GMPy_doc_get_context },
     { "get_emax_max", GMPy_MPFR_get_emax_max, METH_NOARGS, GMPy_doc_mpfr_get_emax_max },
     { "get_emin_min", GMPy_MPFR_get_emin_min, METH_NOARGS, GMPy_doc_mpfr_get_emin_min },
@@ -452,6 +523,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "is_zero", GMPy_Context_Is_Zero, METH_O, GMPy_doc_function_is_zero },
     { "jn", GMPy_Context_Jn, METH_VARARGS, GMPy_doc_function_jn },
     { "j0", GMPy_Context_J0, METH_O, GMPy_doc_function_j0 },
+    { "j0_j1_y0_y1", GMPy_Context_J0_J1_Y0_Y1, METH_O, GMPy_doc_function_j0_j1_y0_y1 },
     { "j1", GMPy_Context_J1, METH_O, GMPy_doc_function_j1 },
     { "lgamma", GMPy_Context_Lgamma, METH_O, GMPy_doc_function_lgamma },
     { "li2", GMPy_Context_Li2, METH_O, GMPy_doc_function_li2 },
@@ -461,6 +533,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "log1p", GMPy_Context_Log1p, METH_O, GMPy_doc_function_log1p },
     { "log10", GMPy_Context_Log10, METH_O, GMPy_doc_function_log10 },
     { "log2", GMPy_Context_Log2, METH_O, GMPy_doc_function_log2 },
+    { "log_log1p", GMPy_Context_Log_Log1p, METH_O, GMPy_doc_function_log_log1p },
     { "maxnum", GMPy_Context_Maxnum, METH_VARARGS, GMPy_doc_function_maxnum },
     { "minnum", GMPy_Context_Minnum, METH_VARARGS, GMPy_doc_function_minnum },
     { "modf", GMPy_Context_Modf, METH_O, GMPy_doc_function_modf },
@@ -473,8 +546,11 @@ static PyMethodDef Pygmpy_methods [] =
     { "next_above", GMPy_Context_NextAbove, METH_O, GMPy_doc_function_next_above },
     { "next_below", GMPy_Context_NextBelow, METH_O, GMPy_doc_function_next_below },
     { "next_toward", GMPy_Context_NextToward, METH_VARARGS, GMPy_doc_function_next_toward },
+    { "polyval", GMPy_Context_Polyval, METH_VARARGS, GMPy_doc_function_polyval },
+    { "polyval_many", GMPy_Context_Polyval_Many, METH_VARARGS, GMPy_doc_function_polyval_many },
     { "radians", GMPy_Context_Radians, METH_O, GMPy_doc_function_radians },
     { "rec_sqrt", GMPy_Context_RecSqrt, METH_O, GMPy_doc_function_rec_sqrt },
+    { "register_constant", GMPy_Function_Register_Constant, METH_VARARGS, GMPy_doc_function_register_constant },
     { "reldiff", GMPy_Context_RelDiff, METH_VARARGS, GMPy_doc_function_reldiff },
     { "remainder", GMPy_Context_Remainder, METH_VARARGS, GMPy_doc_function_remainder },
     { "remquo", GMPy_Context_RemQuo, METH_VARARGS, GMPy_doc_function_remquo },
@@ -500,10 +576,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "tan", GMPy_Context_Tan, METH_O, GMPy_doc_function_tan },
     { "tanh", GMPy_Context_Tanh, METH_O, GMPy_doc_function_tanh },
     { "trunc", GMPy_Context_Trunc, METH_O, GMPy_doc_function_trunc},
-#ifdef VECTOR
-    { "vector", GMPy_Context_Vector, METH_O, GMPy_doc_function_vector},
-    { "vector2", GMPy_Context_Vector2, METH_VARARGS, GMPy_doc_function_vector2},
-#endif
+    { "vec", (PyCFunction)GMPy_Context_Vec, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_vec },
     { "yn", GMPy_Context_Yn, METH_VARARGS, GMPy_doc_function_yn },
     { "y0", GMPy_Context_Y0, METH_O, GMPy_doc_function_y0 },
     { "y1", GMPy_Context_Y1, METH_O, GMPy_doc_function_y1 },
@@ -611,6 +684,21 @@ gmpy_exec(PyObject *gmpy_module)
         return -1;;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&XMPQ_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&XMPFR_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&XMPC_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
     if (PyType_Ready(&GMPy_Iter_Type) < 0) {
         /* LCOV_EXCL_START */
         return -1;;
@@ -636,6 +724,31 @@ gmpy_exec(PyObject *gmpy_module)
         return -1;;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&CRTBasis_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&MPFR_Array_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&MPFR_Accumulator_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&MPQ_Accumulator_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&CF_Iterator_Type) < 0) {
+        /* LCOV_EXCL_START */
+        return -1;;
+        /* LCOV_EXCL_STOP */
+    }
 
     /* Initialize exceptions. */
     GMPyExc_GmpyError = PyErr_NewException("gmpy2.gmpy2Error", PyExc_ArithmeticError, NULL);
@@ -726,21 +839,62 @@ gmpy_exec(PyObject *gmpy_module)
     Py_INCREF(&MPQ_Type);
     PyModule_AddObject(gmpy_module, "mpq", (PyObject*)&MPQ_Type);
 
+    /* Add the XMPQ type to the module namespace. */
+
+    Py_INCREF(&XMPQ_Type);
+    PyModule_AddObject(gmpy_module, "xmpq", (PyObject*)&XMPQ_Type);
+
     /* Add the MPFR type to the module namespace. */
 
     Py_INCREF(&MPFR_Type);
     PyModule_AddObject(gmpy_module, "mpfr", (PyObject*)&MPFR_Type);
 
+    /* Add the XMPFR type to the module namespace. */
+
+    Py_INCREF(&XMPFR_Type);
+    PyModule_AddObject(gmpy_module, "xmpfr", (PyObject*)&XMPFR_Type);
+
     /* Add the MPC type to the module namespace. */
 
     Py_INCREF(&MPC_Type);
     PyModule_AddObject(gmpy_module, "mpc", (PyObject*)&MPC_Type);
 
+    /* Add the XMPC type to the module namespace. */
+
+    Py_INCREF(&XMPC_Type);
+    PyModule_AddObject(gmpy_module, "xmpc", (PyObject*)&XMPC_Type);
+
+    /* Add the CRTBasis type to the module namespace. */
+
+    Py_INCREF(&CRTBasis_Type);
+    PyModule_AddObject(gmpy_module, "CRTBasis", (PyObject*)&CRTBasis_Type);
+
+    /* Add the mpfr_array type to the module namespace. */
+
+    Py_INCREF(&MPFR_Array_Type);
+    PyModule_AddObject(gmpy_module, "mpfr_array", (PyObject*)&MPFR_Array_Type);
+
+    /* Add the mpfr_accumulator type to the module namespace. */
+
+    Py_INCREF(&MPFR_Accumulator_Type);
+    PyModule_AddObject(gmpy_module, "mpfr_accumulator", (PyObject*)&MPFR_Accumulator_Type);
+
+    /* Add the mpq_accumulator type to the module namespace. */
+
+    Py_INCREF(&MPQ_Accumulator_Type);
+    PyModule_AddObject(gmpy_module, "mpq_accumulator", (PyObject*)&MPQ_Accumulator_Type);
+
     /* Initialize context var. */
     if (!(current_context_var = PyContextVar_New("gmpy2_context", NULL))) {
         return -1;
     }
 
+    if (!(registered_constants = PyDict_New())) {
+        /* LCOV_EXCL_START */
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+
     /* Add the constants for defining rounding modes. */
     if (PyModule_AddIntConstant(gmpy_module, "RoundToNearest", MPFR_RNDN) < 0) {
         /* LCOV_EXCL_START */
@@ -829,11 +983,11 @@ gmpy_exec(PyObject *gmpy_module)
     GMPy_C_API[MPZ_Type_NUM] = (void*)&MPZ_Type;
     GMPy_C_API[XMPZ_Type_NUM] = (void*)&XMPZ_Type;
     GMPy_C_API[MPQ_Type_NUM] = (void*)&MPQ_Type;
-    GMPy_C_API[XMPQ_Type_NUM] = (void*)&MPQ_Type;
+    GMPy_C_API[XMPQ_Type_NUM] = (void*)&XMPQ_Type;
     GMPy_C_API[MPFR_Type_NUM] = (void*)&MPFR_Type;
-    GMPy_C_API[XMPFR_Type_NUM] = (void*)&MPFR_Type;
+    GMPy_C_API[XMPFR_Type_NUM] = (void*)&XMPFR_Type;
     GMPy_C_API[MPC_Type_NUM] = (void*)&MPC_Type;
-    GMPy_C_API[XMPC_Type_NUM] = (void*)&MPC_Type;
+    GMPy_C_API[XMPC_Type_NUM] = (void*)&XMPC_Type;
     GMPy_C_API[CTXT_Type_NUM] = (void*)&CTXT_Type;
     GMPy_C_API[RandomState_Type_NUM] = (void*)&RandomState_Type;
 
@@ -876,8 +1030,11 @@ gmpy_exec(PyObject *gmpy_module)
             "copyreg.pickle(gmpy2.mpz, gmpy2_reducer)\n"
             "copyreg.pickle(gmpy2.xmpz, gmpy2_reducer)\n"
             "copyreg.pickle(gmpy2.mpq, gmpy2_reducer)\n"
+            "copyreg.pickle(gmpy2.xmpq, gmpy2_reducer)\n"
             "copyreg.pickle(gmpy2.mpfr, gmpy2_reducer)\n"
-            "copyreg.pickle(gmpy2.mpc, gmpy2_reducer)\n";
+            "copyreg.pickle(gmpy2.xmpfr, gmpy2_reducer)\n"
+            "copyreg.pickle(gmpy2.mpc, gmpy2_reducer)\n"
+            "copyreg.pickle(gmpy2.xmpc, gmpy2_reducer)\n";
 
         namespace = PyDict_New();
         PyDict_SetItemString(namespace, "copyreg", copy_reg_module);
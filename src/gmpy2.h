@@ -128,6 +128,7 @@ typedef struct {
 typedef struct {
     PyObject_HEAD
     mpz_t z;
+    struct gmpy_rank_dir *rank;  /* rank/select directory or NULL */
 } XMPZ_Object;
 
 typedef struct {
@@ -136,6 +137,17 @@ typedef struct {
     Py_hash_t  hash_cache;
 } MPQ_Object;
 
+/* The mutable types share the layout of the immutable types so the MPQ(),
+ * MPFR() and MPC() macros and the conversion functions apply to both. The
+ * hash_cache field is never used.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    mpq_t q;
+    Py_hash_t  hash_cache;
+} XMPQ_Object;
+
 typedef struct {
     PyObject_HEAD
     mpfr_t f;
@@ -143,6 +155,13 @@ typedef struct {
     int rc;
 } MPFR_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpfr_t f;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPFR_Object;
+
 typedef struct {
     PyObject_HEAD
     mpc_t c;
@@ -150,6 +169,13 @@ typedef struct {
     int rc;
 } MPC_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpc_t c;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPC_Object;
+
 typedef struct {
     PyObject_HEAD
     gmp_randstate_t state;
@@ -399,8 +425,11 @@ typedef struct {
 #include "gmpy2_mpz.h"
 #include "gmpy2_xmpz.h"
 #include "gmpy2_mpq.h"
+#include "gmpy2_xmpq.h"
 #include "gmpy2_mpfr.h"
+#include "gmpy2_xmpfr.h"
 #include "gmpy2_mpc.h"
+#include "gmpy2_xmpc.h"
 #include "gmpy2_context.h"
 #include "gmpy2_random.h"
 
@@ -435,6 +464,7 @@ typedef struct {
 #include "gmpy2_xmpz_inplace.h"
 #include "gmpy2_xmpz_misc.h"
 #include "gmpy2_xmpz_limbs.h"
+#include "gmpy2_xmpz_rank.h"
 
 /* Support for mpq specific functions. */
 
@@ -456,6 +486,10 @@ typedef struct {
 
 #include "gmpy_mpz_prp.h"
 
+/* Support Chinese remaindering with a precomputed basis. */
+
+#include "gmpy2_mpz_crt.h"
+
 /* Support higher-level Python methods and functions; generally not
  * specific to a single type.
  */
@@ -477,15 +511,18 @@ typedef struct {
 #include "gmpy2_format.h"
 #include "gmpy2_hash.h"
 #include "gmpy2_fused.h"
+#include "gmpy2_poly.h"
 #include "gmpy2_muldiv_2exp.h"
 #include "gmpy2_predicate.h"
 #include "gmpy2_sign.h"
 #include "gmpy2_richcompare.h"
 #include "gmpy2_cmp.h"
 
-#ifdef VECTOR
-#  include "gmpy2_vector.h"
-#endif /* defined(VECTOR) */
+#include "gmpy2_mpfr_array.h"
+#include "gmpy2_mpfr_accumulator.h"
+#include "gmpy2_mpq_accumulator.h"
+#include "gmpy2_mpq_cf.h"
+#include "gmpy2_vector.h"
 
 #else /* defined(GMPY2_MODULE) */
 
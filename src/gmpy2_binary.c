@@ -681,8 +681,88 @@ GMPy_MPC_To_Binary(MPC_Object *obj)
     return ret;
 }
 
+/* Format of the binary representation of an xmpq, xmpfr or xmpc.
+ *
+ * The format is the binary format of the mpq, mpfr or mpc with the same
+ * value, with the leading byte replaced by
+ *
+ * byte[0]:     6 => xmpq
+ *              7 => xmpfr
+ *              8 => xmpc
+ */
+
+static PyObject *
+GMPy_XMPANY_To_Binary(PyObject *obj)
+{
+    PyObject *result;
+
+    if (XMPQ_Check(obj))
+        result = GMPy_MPQ_To_Binary((MPQ_Object*)obj);
+    else if (XMPFR_Check(obj))
+        result = GMPy_MPFR_To_Binary((MPFR_Object*)obj);
+    else
+        result = GMPy_MPC_To_Binary((MPC_Object*)obj);
+
+    /* The result is a new bytes object, so it may still be modified. */
+
+    if (result) {
+        PyBytes_AS_STRING(result)[0] += 0x03;
+    }
+    return result;
+}
+
+/* Convert the bytes of an xmpq, xmpfr or xmpc to the immutable type and
+ * return a mutable copy.
+ */
+
+static PyObject *
+GMPy_XMPANY_From_Binary(unsigned char *buffer, Py_ssize_t len)
+{
+    PyObject *temp, *value, *result = NULL;
+
+    if (!(temp = PyBytes_FromStringAndSize((char*)buffer, len))) {
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+    PyBytes_AS_STRING(temp)[0] -= 0x03;
+    value = GMPy_MPANY_From_Binary(NULL, temp);
+    Py_DECREF(temp);
+    if (!value) {
+        return NULL;
+    }
+
+    if (MPQ_Check(value)) {
+        XMPQ_Object *x;
+
+        if ((x = GMPy_XMPQ_New(NULL))) {
+            mpq_swap(x->q, MPQ(value));
+        }
+        result = (PyObject*)x;
+    }
+    else if (MPFR_Check(value)) {
+        XMPFR_Object *x;
+
+        if ((x = GMPy_XMPFR_New(mpfr_get_prec(MPFR(value)), NULL))) {
+            mpfr_swap(x->f, MPFR(value));
+            x->rc = ((MPFR_Object*)value)->rc;
+        }
+        result = (PyObject*)x;
+    }
+    else {
+        XMPC_Object *x;
+
+        if ((x = GMPy_XMPC_New(mpfr_get_prec(mpc_realref(MPC(value))),
+                               mpfr_get_prec(mpc_imagref(MPC(value))), NULL))) {
+            mpc_swap(x->c, MPC(value));
+            x->rc = ((MPC_Object*)value)->rc;
+        }
+        result = (PyObject*)x;
+    }
+    Py_DECREF(value);
+    return result;
+}
+
 PyDoc_STRVAR(doc_from_binary,
-"from_binary(bytes, /) -> mpz | xmpz | mpq | mpfr | mpc\n\n"
+"from_binary(bytes, /) -> mpz | xmpz | mpq | xmpq | mpfr | xmpfr | mpc | xmpc\n\n"
 "Return a Python object from a byte sequence created by `to_binary()`.");
 
 static PyObject *
@@ -1230,6 +1310,10 @@ GMPy_MPANY_From_Binary(PyObject *self, PyObject *other)
             Py_DECREF((PyObject*)imag);
             return (PyObject*)result;
         }
+        case 0x06:
+        case 0x07:
+        case 0x08:
+            return GMPy_XMPANY_From_Binary(buffer, len);
         default: {
             TYPE_ERROR("from_binary() argument type not supported");
             return NULL;
@@ -1257,6 +1341,8 @@ GMPy_MPANY_To_Binary(PyObject *self, PyObject *other)
         return GMPy_MPFR_To_Binary((MPFR_Object*)other);
     else if(MPC_Check(other))
         return GMPy_MPC_To_Binary((MPC_Object*)other);
+    else if(XMPQ_Check(other) || XMPFR_Check(other) || XMPC_Check(other))
+        return GMPy_XMPANY_To_Binary(other);
     TYPE_ERROR("to_binary() argument type not supported");
     return NULL;
 }
@@ -48,6 +48,8 @@ static PyObject * GMPy_XMPZ_To_Binary(XMPZ_Object *self);
 static PyObject * GMPy_MPQ_To_Binary(MPQ_Object *self);
 static PyObject * GMPy_MPFR_To_Binary(MPFR_Object *self);
 static PyObject * GMPy_MPC_To_Binary(MPC_Object *self);
+static PyObject * GMPy_XMPANY_To_Binary(PyObject *obj);
+static PyObject * GMPy_XMPANY_From_Binary(unsigned char *buffer, Py_ssize_t len);
 
 #ifdef __cplusplus
 }
@@ -97,11 +97,11 @@ GMPy_MPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
             return (PyObject*)GMPy_MPZ_From_PyLong(n, context);
         }
 
-        if (MPQ_Check(n)) {
+        if (MPQ_Check(n) || XMPQ_Check(n)) {
             return (PyObject*)GMPy_MPZ_From_MPQ((MPQ_Object*)n, context);
         }
 
-        if (MPFR_Check(n)) {
+        if (MPFR_Check(n) || XMPFR_Check(n)) {
             return (PyObject*)GMPy_MPZ_From_MPFR((MPFR_Object*)n, context);
         }
 
@@ -207,6 +207,7 @@ GMPy_XMPZ_New(CTXT_Object *context)
             return NULL;
         }
         mpz_init(result->z);
+        result->rank = NULL;
     }
     return result;
 }
@@ -247,11 +248,11 @@ GMPy_XMPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
             return (PyObject*)GMPy_XMPZ_From_PyLong(n, context);
         }
 
-        if (MPQ_Check(n)) {
+        if (MPQ_Check(n) || XMPQ_Check(n)) {
             return (PyObject*)GMPy_XMPZ_From_MPQ((MPQ_Object*)n, context);
         }
 
-        if (MPFR_Check(n)) {
+        if (MPFR_Check(n) || XMPFR_Check(n)) {
             return (PyObject*)GMPy_XMPZ_From_MPFR((MPFR_Object*)n, context);
         }
 
@@ -314,6 +315,7 @@ GMPy_XMPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
 static void
 GMPy_XMPZ_Dealloc(XMPZ_Object *self)
 {
+   XMPZ_MODIFIED(self);
    if (global.in_gmpyxmpzcache < CACHE_SIZE &&
        self->z->_mp_alloc <= MAX_CACHE_MPZ_LIMBS) {
         global.gmpyxmpzcache[(global.in_gmpyxmpzcache)++] = self;
@@ -455,12 +457,80 @@ GMPy_MPQ_Dealloc(MPQ_Object *self)
     }
 }
 
+/* The mutable types are not cached. Their constructors accept the same
+ * arguments as the immutable types and copy the result.
+ */
+
+static XMPQ_Object *
+GMPy_XMPQ_New(CTXT_Object *context)
+{
+    XMPQ_Object *result = NULL;
+
+    result = PyObject_New(XMPQ_Object, &XMPQ_Type);
+    if (result == NULL) {
+        return NULL;
+    }
+    mpq_init(result->q);
+    result->hash_cache = -1;
+    return result;
+}
+
+static PyObject *
+GMPy_XMPQ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPQ_Object *result = NULL;
+    PyObject *temp = NULL;
+
+    if (type != &XMPQ_Type) {
+        TYPE_ERROR("xmpq.__new__() requires xmpq type");
+        return NULL;
+    }
+
+    if (!(temp = GMPy_MPQ_NewInit(&MPQ_Type, args, keywds))) {
+        return NULL;
+    }
+
+    if ((result = GMPy_XMPQ_New(NULL))) {
+        mpq_set(result->q, MPQ(temp));
+    }
+    Py_DECREF(temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPQ_Dealloc(XMPQ_Object *self)
+{
+    mpq_clear(self->q);
+    PyObject_Free(self);
+}
+
 /* Caching logic for Pympfr. */
 
+/* Return the cache bucket for a precision, or -1 if objects with that
+ * precision are not cached.
+ */
+
+static int
+GMPy_Cache_Bucket(mpfr_prec_t bits)
+{
+    int b;
+
+    if (bits > MAX_CACHE_MPFR_BITS) {
+        return -1;
+    }
+    for (b = 0; b < CACHE_MPFR_BUCKETS; b++) {
+        if (bits <= CACHE_MPFR_BUCKET_BITS(b)) {
+            return b;
+        }
+    }
+    return -1;
+}
+
 static MPFR_Object *
 GMPy_MPFR_New(mpfr_prec_t bits, CTXT_Object *context)
 {
     MPFR_Object *result;
+    int b;
 
     if (bits < 2) {
         CHECK_CONTEXT(context);
@@ -472,8 +542,14 @@ GMPy_MPFR_New(mpfr_prec_t bits, CTXT_Object *context)
         return NULL;
     }
 
-    if (global.in_gmpympfrcache) {
-        result = global.gmpympfrcache[--(global.in_gmpympfrcache)];
+    b = GMPy_Cache_Bucket(bits);
+
+    if (b >= 0 && global.in_gmpympfrcache[b]) {
+        /* The significand was allocated for CACHE_MPFR_BUCKET_BITS(b), so
+         * mpfr_set_prec() does not need to reallocate it.
+         */
+        result = global.gmpympfrcache[b][--(global.in_gmpympfrcache[b])];
+        global.gmpympfrcache_hits[b]++;
         Py_INCREF((PyObject*)result);
         mpfr_set_prec(result->f, bits);
     }
@@ -482,7 +558,14 @@ GMPy_MPFR_New(mpfr_prec_t bits, CTXT_Object *context)
         if (result == NULL) {
             return NULL;
         }
-        mpfr_init2(result->f, bits);
+        if (b >= 0) {
+            global.gmpympfrcache_misses[b]++;
+            mpfr_init2(result->f, CACHE_MPFR_BUCKET_BITS(b));
+            mpfr_set_prec(result->f, bits);
+        }
+        else {
+            mpfr_init2(result->f, bits);
+        }
     }
     result->hash_cache = -1;
     result->rc = 0;
@@ -606,10 +689,10 @@ GMPy_MPFR_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
 static void
 GMPy_MPFR_Dealloc(MPFR_Object *self)
 {
-    if (global.in_gmpympfrcache < CACHE_SIZE &&
-        self->f->_mpfr_prec <= MAX_CACHE_MPFR_BITS) {
+    int b = GMPy_Cache_Bucket(mpfr_get_prec(self->f));
 
-        global.gmpympfrcache[(global.in_gmpympfrcache)++] = self;
+    if (b >= 0 && global.in_gmpympfrcache[b] < CACHE_SIZE) {
+        global.gmpympfrcache[b][(global.in_gmpympfrcache[b])++] = self;
     }
     else {
         mpfr_clear(self->f);
@@ -617,10 +700,66 @@ GMPy_MPFR_Dealloc(MPFR_Object *self)
     }
 }
 
+static XMPFR_Object *
+GMPy_XMPFR_New(mpfr_prec_t bits, CTXT_Object *context)
+{
+    XMPFR_Object *result;
+
+    if (bits < 2) {
+        CHECK_CONTEXT(context);
+        bits = GET_MPFR_PREC(context);
+    }
+
+    if (bits < MPFR_PREC_MIN || bits > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    result = PyObject_New(XMPFR_Object, &XMPFR_Type);
+    if (result == NULL) {
+        return NULL;
+    }
+    mpfr_init2(result->f, bits);
+    result->hash_cache = -1;
+    result->rc = 0;
+    return result;
+}
+
+static PyObject *
+GMPy_XMPFR_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPFR_Object *result = NULL;
+    PyObject *temp = NULL;
+
+    if (type != &XMPFR_Type) {
+        TYPE_ERROR("xmpfr.__new__() requires xmpfr type");
+        return NULL;
+    }
+
+    if (!(temp = GMPy_MPFR_NewInit(&MPFR_Type, args, keywds))) {
+        return NULL;
+    }
+
+    if ((result = GMPy_XMPFR_New(mpfr_get_prec(MPFR(temp)), NULL))) {
+        mpfr_set(result->f, MPFR(temp), MPFR_RNDN);
+        result->rc = ((MPFR_Object*)temp)->rc;
+    }
+    Py_DECREF(temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPFR_Dealloc(XMPFR_Object *self)
+{
+    mpfr_clear(self->f);
+    PyObject_Free(self);
+}
+
 static MPC_Object *
 GMPy_MPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context)
 {
     MPC_Object *result;
+    int b;
 
     if (rprec < 2) {
         CHECK_CONTEXT(context);
@@ -637,23 +776,31 @@ GMPy_MPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context)
         VALUE_ERROR("invalid value for precision");
         return NULL;
     }
-    if (global.in_gmpympccache) {
-        result = global.gmpympccache[--(global.in_gmpympccache)];
+
+    b = GMPy_Cache_Bucket(rprec > iprec ? rprec : iprec);
+
+    if (b >= 0 && global.in_gmpympccache[b]) {
+        /* Both significands were allocated for CACHE_MPFR_BUCKET_BITS(b). */
+        result = global.gmpympccache[b][--(global.in_gmpympccache[b])];
+        global.gmpympccache_hits[b]++;
         Py_INCREF((PyObject*)result);
-        if (rprec == iprec) {
-            mpc_set_prec(result->c, rprec);
-        }
-        else {
-            mpc_clear(result->c);
-            mpc_init3(result->c, rprec, iprec);
-        }
+        mpfr_set_prec(mpc_realref(result->c), rprec);
+        mpfr_set_prec(mpc_imagref(result->c), iprec);
     }
     else {
         result = PyObject_New(MPC_Object, &MPC_Type);
         if (result == NULL) {
             return NULL;
         }
-        mpc_init3(result->c, rprec, iprec);
+        if (b >= 0) {
+            global.gmpympccache_misses[b]++;
+            mpc_init2(result->c, CACHE_MPFR_BUCKET_BITS(b));
+            mpfr_set_prec(mpc_realref(result->c), rprec);
+            mpfr_set_prec(mpc_imagref(result->c), iprec);
+        }
+        else {
+            mpc_init3(result->c, rprec, iprec);
+        }
     }
     result->hash_cache = -1;
     result->rc = 0;
@@ -887,14 +1034,128 @@ GMPy_MPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
 static void
 GMPy_MPC_Dealloc(MPC_Object *self)
 {
-    if (global.in_gmpympccache < CACHE_SIZE &&
-        mpc_realref(self->c)->_mpfr_prec <= MAX_CACHE_MPFR_BITS &&
-        mpc_imagref(self->c)->_mpfr_prec <= MAX_CACHE_MPFR_BITS) {
+    mpfr_prec_t rprec = mpfr_get_prec(mpc_realref(self->c));
+    mpfr_prec_t iprec = mpfr_get_prec(mpc_imagref(self->c));
+    int b = GMPy_Cache_Bucket(rprec > iprec ? rprec : iprec);
 
-        global.gmpympccache[(global.in_gmpympccache)++] = self;
+    if (b >= 0 && global.in_gmpympccache[b] < CACHE_SIZE) {
+        global.gmpympccache[b][(global.in_gmpympccache[b])++] = self;
     }
     else {
         mpc_clear(self->c);
         PyObject_Free(self);
     }
 }
+
+static XMPC_Object *
+GMPy_XMPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context)
+{
+    XMPC_Object *result;
+
+    if (rprec < 2) {
+        CHECK_CONTEXT(context);
+        rprec = GET_REAL_PREC(context);
+    }
+
+    if (iprec < 2) {
+        CHECK_CONTEXT(context);
+        iprec = GET_IMAG_PREC(context);
+    }
+
+    if (rprec < MPFR_PREC_MIN || rprec > MPFR_PREC_MAX ||
+        iprec < MPFR_PREC_MIN || iprec > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    result = PyObject_New(XMPC_Object, &XMPC_Type);
+    if (result == NULL) {
+        return NULL;
+    }
+    mpc_init3(result->c, rprec, iprec);
+    result->hash_cache = -1;
+    result->rc = 0;
+    return result;
+}
+
+static PyObject *
+GMPy_XMPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPC_Object *result = NULL;
+    PyObject *temp = NULL;
+    mpfr_prec_t rprec = 0, iprec = 0;
+
+    if (type != &XMPC_Type) {
+        TYPE_ERROR("xmpc.__new__() requires xmpc type");
+        return NULL;
+    }
+
+    if (!(temp = GMPy_MPC_NewInit(&MPC_Type, args, keywds))) {
+        return NULL;
+    }
+
+    mpc_get_prec2(&rprec, &iprec, MPC(temp));
+    if ((result = GMPy_XMPC_New(rprec, iprec, NULL))) {
+        mpc_set(result->c, MPC(temp), MPC_RNDNN);
+        result->rc = ((MPC_Object*)temp)->rc;
+    }
+    Py_DECREF(temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPC_Dealloc(XMPC_Object *self)
+{
+    mpc_clear(self->c);
+    PyObject_Free(self);
+}
+
+PyDoc_STRVAR(GMPy_doc_cache_stats,
+"_cache_stats() -> dict\n\n"
+"Return statistics for the mpfr and mpc object caches of the current\n"
+"thread. For each type, a tuple (bits, cached, hits, misses) is returned\n"
+"for every precision bucket, where bits is the largest precision stored\n"
+"in the bucket.");
+
+static PyObject *
+GMPy_Cache_Stats(PyObject *self, PyObject *args)
+{
+    PyObject *result = NULL, *mpfr_stats = NULL, *mpc_stats = NULL, *temp;
+    int b;
+
+    if (!(mpfr_stats = PyTuple_New(CACHE_MPFR_BUCKETS)) ||
+        !(mpc_stats = PyTuple_New(CACHE_MPFR_BUCKETS))) {
+        /* LCOV_EXCL_START */
+        goto error;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (b = 0; b < CACHE_MPFR_BUCKETS; b++) {
+        if (!(temp = Py_BuildValue("(linn)", (long)CACHE_MPFR_BUCKET_BITS(b),
+                                   global.in_gmpympfrcache[b],
+                                   global.gmpympfrcache_hits[b],
+                                   global.gmpympfrcache_misses[b]))) {
+            /* LCOV_EXCL_START */
+            goto error;
+            /* LCOV_EXCL_STOP */
+        }
+        PyTuple_SET_ITEM(mpfr_stats, b, temp);
+
+        if (!(temp = Py_BuildValue("(linn)", (long)CACHE_MPFR_BUCKET_BITS(b),
+                                   global.in_gmpympccache[b],
+                                   global.gmpympccache_hits[b],
+                                   global.gmpympccache_misses[b]))) {
+            /* LCOV_EXCL_START */
+            goto error;
+            /* LCOV_EXCL_STOP */
+        }
+        PyTuple_SET_ITEM(mpc_stats, b, temp);
+    }
+
+    result = Py_BuildValue("{sOsO}", "mpfr", mpfr_stats, "mpc", mpc_stats);
+
+  error:
+    Py_XDECREF(mpfr_stats);
+    Py_XDECREF(mpc_stats);
+    return result;
+}
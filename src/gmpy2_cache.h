@@ -38,6 +38,8 @@ extern "C" {
 
 /* Private functions */
 
+static PyObject *    GMPy_Cache_Stats(PyObject *self, PyObject *args);
+
 /* C-API functions */
 
 /* static MPZ_Object *  GMPy_MPZ_New(CTXT_Object *context); */
@@ -71,6 +73,20 @@ static GMPy_MPFR_Dealloc_RETURN GMPy_MPFR_Dealloc GMPy_MPFR_Dealloc_PROTO;
 static MPC_Object *  GMPy_MPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context);
 static void          GMPy_MPC_Dealloc(MPC_Object *self);
 
+/* The mutable xmpq, xmpfr and xmpc types are not cached. */
+
+static XMPQ_Object * GMPy_XMPQ_New(CTXT_Object *context);
+static PyObject *    GMPy_XMPQ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void          GMPy_XMPQ_Dealloc(XMPQ_Object *self);
+
+static XMPFR_Object * GMPy_XMPFR_New(mpfr_prec_t bits, CTXT_Object *context);
+static PyObject *     GMPy_XMPFR_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void           GMPy_XMPFR_Dealloc(XMPFR_Object *self);
+
+static XMPC_Object * GMPy_XMPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context);
+static PyObject *    GMPy_XMPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void          GMPy_XMPC_Dealloc(XMPC_Object *self);
+
 #ifdef __cplusplus
 }
 #endif
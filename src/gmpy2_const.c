@@ -24,6 +24,237 @@
  * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/* gmpy2 keeps, for each thread, the most precise value of every constant
+ * that it has computed so far. A request for a lower precision is answered
+ * by rounding the cached value when mpfr_can_round() shows that the result
+ * is correctly rounded; otherwise the constant is recomputed with
+ * GMPY_CONST_GUARD extra bits and the cache is updated. Since the builtin
+ * constants are irrational, the ternary value of the rounding is exact.
+ *
+ * Constants registered with register_constant() are cached the same way,
+ * keyed by name together with the function that computes them, so
+ * registering a name again replaces its entry. The cache is owned by a
+ * capsule in the thread state dict, so it is released when the thread
+ * exits and by free_cache().
+ */
+
+#define GMPY_CONST_GUARD 32
+#define CONST_CAPSULE "gmpy2.constants"
+
+static int (*GMPy_Const_Funcs[GMPY_CONST_BUILTIN])(mpfr_ptr, mpfr_rnd_t) = {
+    mpfr_const_pi, mpfr_const_euler, mpfr_const_log2, mpfr_const_catalan
+};
+
+static const char *GMPy_Const_Names[GMPY_CONST_BUILTIN] = {
+    "pi", "euler", "log2", "catalan"
+};
+
+static void
+GMPy_Const_Capsule_Free(PyObject *capsule)
+{
+    GMPy_Const_Cache *cache = PyCapsule_GetPointer(capsule, CONST_CAPSULE);
+    int i;
+
+    /* MPFR also caches the constants per thread; release them too when the
+     * capsule is freed by its own thread, e.g. at thread exit.
+     */
+    if (global.consts == cache) {
+        global.consts = NULL;
+        mpfr_free_cache2(MPFR_FREE_LOCAL_CACHE);
+    }
+    for (i = 0; i < GMPY_CONST_BUILTIN; i++) {
+        if (cache->prec[i]) {
+            mpfr_clear(cache->value[i]);
+        }
+    }
+    Py_XDECREF(cache->user);
+    PyMem_RawFree(cache);
+}
+
+/* Return the cache of the current thread, creating it if needed. Returns
+ * NULL, possibly with an exception set, if it cannot be created.
+ */
+
+static GMPy_Const_Cache *
+GMPy_Const_Get_Cache(void)
+{
+    GMPy_Const_Cache *cache;
+    PyObject *dict, *capsule;
+    int rc;
+
+    if (global.consts) {
+        return global.consts;
+    }
+
+    if (!(dict = PyThreadState_GetDict()) ||
+        !(cache = PyMem_RawCalloc(1, sizeof(GMPy_Const_Cache)))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    if (!(capsule = PyCapsule_New(cache, CONST_CAPSULE, GMPy_Const_Capsule_Free))) {
+        /* LCOV_EXCL_START */
+        PyMem_RawFree(cache);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    rc = PyDict_SetItemString(dict, CONST_CAPSULE, capsule);
+    Py_DECREF(capsule);
+    if (rc < 0) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    global.consts = cache;
+    return cache;
+}
+
+/* Return 1 if the value b, with an error of at most 2**(EXP(b)-err), can
+ * be rounded correctly to the precision of rop in any rounding mode.
+ */
+
+static int
+GMPy_Const_CanRound(mpfr_srcptr b, mpfr_prec_t err, mpfr_srcptr rop)
+{
+    mpfr_prec_t prec = mpfr_get_prec(rop);
+
+    return mpfr_get_prec(b) > prec + 1 &&
+           mpfr_can_round(b, err, MPFR_RNDN, MPFR_RNDZ, prec + 1);
+}
+
+static int
+GMPy_Const_Builtin(mpfr_ptr rop, int which, mpfr_rnd_t rnd)
+{
+    GMPy_Const_Cache *cache;
+    mpfr_prec_t prec = mpfr_get_prec(rop);
+
+    if (!(cache = GMPy_Const_Get_Cache())) {
+        /* LCOV_EXCL_START */
+        PyErr_Clear();
+        return GMPy_Const_Funcs[which](rop, rnd);
+        /* LCOV_EXCL_STOP */
+    }
+
+    if (cache->prec[which] &&
+        GMPy_Const_CanRound(cache->value[which], cache->prec[which], rop)) {
+        return mpfr_set(rop, cache->value[which], rnd);
+    }
+
+    if (prec <= MPFR_PREC_MAX - GMPY_CONST_GUARD &&
+        cache->prec[which] < prec + GMPY_CONST_GUARD) {
+        if (cache->prec[which]) {
+            mpfr_set_prec(cache->value[which], prec + GMPY_CONST_GUARD);
+        }
+        else {
+            mpfr_init2(cache->value[which], prec + GMPY_CONST_GUARD);
+        }
+        GMPy_Const_Funcs[which](cache->value[which], MPFR_RNDN);
+        cache->prec[which] = prec + GMPY_CONST_GUARD;
+
+        if (GMPy_Const_CanRound(cache->value[which], cache->prec[which], rop)) {
+            return mpfr_set(rop, cache->value[which], rnd);
+        }
+    }
+
+    /* LCOV_EXCL_START */
+    return GMPy_Const_Funcs[which](rop, rnd);
+    /* LCOV_EXCL_STOP */
+}
+
+/* Set result to the value of the constant called name, computed by fn.
+ * The cached value is assumed to be within one ulp of the constant.
+ */
+
+static int
+GMPy_Const_User(MPFR_Object *result, PyObject *name, PyObject *fn,
+                CTXT_Object *context)
+{
+    GMPy_Const_Cache *cache;
+    MPFR_Object *value = NULL;
+    PyObject *temp, *entry;
+    mpfr_prec_t prec = mpfr_get_prec(result->f);
+    int xtype;
+
+    if (!(cache = GMPy_Const_Get_Cache()) ||
+        (!cache->user && !(cache->user = PyDict_New()))) {
+        /* LCOV_EXCL_START */
+        if (!PyErr_Occurred()) {
+            PyErr_NoMemory();
+        }
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* An entry computed by a previously registered function is stale. */
+    if ((entry = PyDict_GetItemWithError(cache->user, name)) &&
+        PyTuple_GET_ITEM(entry, 0) == fn) {
+        value = (MPFR_Object*)PyTuple_GET_ITEM(entry, 1);
+        Py_INCREF((PyObject*)value);
+    }
+    else if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    if (!value || (mpfr_get_prec(value->f) < prec + GMPY_CONST_GUARD &&
+                   !GMPy_Const_CanRound(value->f, mpfr_get_prec(value->f) - 1, result->f))) {
+        Py_XDECREF((PyObject*)value);
+        if (!(temp = PyObject_CallFunction(fn, "l", (long)(prec + GMPY_CONST_GUARD)))) {
+            return -1;
+        }
+        xtype = GMPy_ObjectType(temp);
+        if (!IS_TYPE_REAL(xtype)) {
+            Py_DECREF(temp);
+            TYPE_ERROR("constant function must return a real number");
+            return -1;
+        }
+        value = GMPy_MPFR_From_RealWithType(temp, xtype, prec + GMPY_CONST_GUARD, context);
+        Py_DECREF(temp);
+        if (!value) {
+            return -1;
+        }
+
+        /* fn may have called free_cache(), so look the cache up again. */
+        if (!(cache = GMPy_Const_Get_Cache()) ||
+            (!cache->user && !(cache->user = PyDict_New())) ||
+            !(entry = PyTuple_Pack(2, fn, (PyObject*)value))) {
+            /* LCOV_EXCL_START */
+            if (!PyErr_Occurred()) {
+                PyErr_NoMemory();
+            }
+            Py_DECREF((PyObject*)value);
+            return -1;
+            /* LCOV_EXCL_STOP */
+        }
+        if (PyDict_SetItem(cache->user, name, entry) < 0) {
+            /* LCOV_EXCL_START */
+            Py_DECREF(entry);
+            Py_DECREF((PyObject*)value);
+            return -1;
+            /* LCOV_EXCL_STOP */
+        }
+        Py_DECREF(entry);
+    }
+
+    result->rc = mpfr_set(result->f, value->f, GET_MPFR_ROUND(context));
+    Py_DECREF((PyObject*)value);
+    return 0;
+}
+
+static void
+GMPy_Const_Free_Cache(void)
+{
+    PyObject *dict;
+
+    if (global.consts && (dict = PyThreadState_GetDict())) {
+        /* Deleting the capsule frees the cache and resets global. */
+        if (PyDict_DelItemString(dict, CONST_CAPSULE) < 0) {
+            /* LCOV_EXCL_START */
+            PyErr_Clear();
+            /* LCOV_EXCL_STOP */
+        }
+    }
+}
+
 PyDoc_STRVAR(GMPy_doc_function_const_pi,
 "const_pi(precision=0) -> mpfr\n\n"
 "Return the constant pi using the specified precision. If no\n"
@@ -45,7 +276,7 @@ GMPy_Function_Const_Pi(PyObject *self, PyObject *args, PyObject *keywds)
 
     if ((result = GMPy_MPFR_New(bits, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_pi(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_PI, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -64,7 +295,7 @@ GMPy_Context_Const_Pi(PyObject *self, PyObject *args)
 
     if ((result = GMPy_MPFR_New(0, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_pi(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_PI, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -92,7 +323,7 @@ GMPy_Function_Const_Euler(PyObject *self, PyObject *args, PyObject *keywds)
 
     if ((result = GMPy_MPFR_New(bits, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_euler(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_EULER, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -111,7 +342,7 @@ GMPy_Context_Const_Euler(PyObject *self, PyObject *args)
 
     if ((result = GMPy_MPFR_New(0, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_euler(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_EULER, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -139,7 +370,7 @@ GMPy_Function_Const_Log2(PyObject *self, PyObject *args, PyObject *keywds)
 
     if ((result = GMPy_MPFR_New(bits, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_log2(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_LOG2, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -158,7 +389,7 @@ GMPy_Context_Const_Log2(PyObject *self, PyObject *args)
 
     if ((result = GMPy_MPFR_New(0, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_log2(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_LOG2, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -186,7 +417,7 @@ GMPy_Function_Const_Catalan(PyObject *self, PyObject *args, PyObject *keywds)
 
     if ((result = GMPy_MPFR_New(bits, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_catalan(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_CATALAN, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
@@ -205,9 +436,130 @@ GMPy_Context_Const_Catalan(PyObject *self, PyObject *args)
 
     if ((result = GMPy_MPFR_New(0, context))) {
         mpfr_clear_flags();
-        result->rc = mpfr_const_catalan(result->f, GET_MPFR_ROUND(context));
+        result->rc = GMPy_Const_Builtin(result->f, GMPY_CONST_CATALAN, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
 
     return (PyObject*)result;
 }
+
+/* Return the value of the constant called name with precision bits. */
+
+static PyObject *
+GMPy_Const_Lookup(PyObject *name, mpfr_prec_t bits, CTXT_Object *context)
+{
+    MPFR_Object *result = NULL;
+    PyObject *fn;
+    int i;
+
+    if (!PyUnicode_Check(name)) {
+        TYPE_ERROR("constant() requires a string argument");
+        return NULL;
+    }
+
+    for (i = 0; i < GMPY_CONST_BUILTIN; i++) {
+        if (PyUnicode_CompareWithASCIIString(name, GMPy_Const_Names[i]) == 0) {
+            if ((result = GMPy_MPFR_New(bits, context))) {
+                mpfr_clear_flags();
+                result->rc = GMPy_Const_Builtin(result->f, i, GET_MPFR_ROUND(context));
+                _GMPy_MPFR_Cleanup(&result, context);
+            }
+            return (PyObject*)result;
+        }
+    }
+
+    if (!(fn = PyDict_GetItemWithError(registered_constants, name))) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_ValueError, "unknown constant %R", name);
+        }
+        return NULL;
+    }
+
+    Py_INCREF(fn);
+    if ((result = GMPy_MPFR_New(bits, context))) {
+        if (GMPy_Const_User(result, name, fn, context) < 0) {
+            Py_CLEAR(result);
+        }
+        else {
+            mpfr_clear_flags();
+            if (result->rc) {
+                mpfr_set_inexflag();
+            }
+            _GMPy_MPFR_Cleanup(&result, context);
+        }
+    }
+    Py_DECREF(fn);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_constant,
+"constant(name, /, precision=0) -> mpfr\n\n"
+"Return the constant called name using the specified precision. If no\n"
+"precision is specified, the default precision is used. name is one of\n"
+"'pi', 'euler', 'log2' and 'catalan' or a name given to\n"
+"register_constant(). The most precise value computed so far is cached\n"
+"and lower precisions are obtained by rounding it.");
+
+static PyObject *
+GMPy_Function_Constant(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *name;
+    mpfr_prec_t bits = 0;
+    static char *kwlist[] = {"", "precision", NULL};
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O|l", kwlist, &name, &bits)) {
+        return NULL;
+    }
+
+    return GMPy_Const_Lookup(name, bits, context);
+}
+
+PyDoc_STRVAR(GMPy_doc_context_constant,
+"context.constant(name, /) -> mpfr\n\n"
+"Return the constant called name using the context's precision.");
+
+static PyObject *
+GMPy_Context_Constant(PyObject *self, PyObject *other)
+{
+    return GMPy_Const_Lookup(other, 0, (CTXT_Object*)self);
+}
+
+PyDoc_STRVAR(GMPy_doc_function_register_constant,
+"register_constant(name, fn, /) -> None\n\n"
+"Register fn as the function computing the constant called name. fn is\n"
+"called with a precision in bits and must return the constant to within\n"
+"one ulp at that precision, for example by evaluating it inside\n"
+"'with context(precision=precision)'. The values are then available from\n"
+"constant(name) and are cached like the builtin constants. Registering\n"
+"a name again replaces the previous function.");
+
+static PyObject *
+GMPy_Function_Register_Constant(PyObject *self, PyObject *args)
+{
+    PyObject *name, *fn;
+    int i;
+
+    if (!PyArg_ParseTuple(args, "UO", &name, &fn)) {
+        return NULL;
+    }
+
+    if (!PyCallable_Check(fn)) {
+        TYPE_ERROR("register_constant() requires a callable");
+        return NULL;
+    }
+
+    for (i = 0; i < GMPY_CONST_BUILTIN; i++) {
+        if (PyUnicode_CompareWithASCIIString(name, GMPy_Const_Names[i]) == 0) {
+            VALUE_ERROR("cannot replace a builtin constant");
+            return NULL;
+        }
+    }
+
+    if (PyDict_SetItem(registered_constants, name, fn) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
@@ -32,6 +32,28 @@
 extern "C" {
 #endif
 
+/* Index of the builtin constants in the per-thread constant cache. */
+
+#define GMPY_CONST_PI       0
+#define GMPY_CONST_EULER    1
+#define GMPY_CONST_LOG2     2
+#define GMPY_CONST_CATALAN  3
+#define GMPY_CONST_BUILTIN  4
+
+/* Most precise values computed so far of the builtin constants, and a
+ * dict mapping the names of registered constants to a (function, value)
+ * tuple. A precision of 0 means the entry is not initialized. The cache is
+ * allocated per thread and owned by a capsule in the thread state dict.
+ */
+typedef struct {
+    mpfr_t value[GMPY_CONST_BUILTIN];
+    mpfr_prec_t prec[GMPY_CONST_BUILTIN];
+    PyObject *user;
+} GMPy_Const_Cache;
+
+static int        GMPy_Const_Builtin(mpfr_ptr rop, int which, mpfr_rnd_t rnd);
+static void       GMPy_Const_Free_Cache(void);
+
 static PyObject * GMPy_Function_Const_Pi(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_Context_Const_Pi(PyObject *self, PyObject *args);
 
@@ -44,6 +66,10 @@ static PyObject * GMPy_Context_Const_Log2(PyObject *self, PyObject *args);
 static PyObject * GMPy_Function_Const_Catalan(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_Context_Const_Catalan(PyObject *self, PyObject *args);
 
+static PyObject * GMPy_Function_Constant(PyObject *self, PyObject *args, PyObject *keywds);
+static PyObject * GMPy_Context_Constant(PyObject *self, PyObject *other);
+static PyObject * GMPy_Function_Register_Constant(PyObject *self, PyObject *args);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1128,6 +1128,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "const_euler", GMPy_Context_Const_Euler, METH_NOARGS, GMPy_doc_context_const_euler },
     { "const_log2", GMPy_Context_Const_Log2, METH_NOARGS, GMPy_doc_context_const_log2 },
     { "const_pi", GMPy_Context_Const_Pi, METH_NOARGS, GMPy_doc_context_const_pi },
+    { "constant", GMPy_Context_Constant, METH_O, GMPy_doc_context_constant },
     { "cos", GMPy_Context_Cos, METH_O, GMPy_doc_context_cos },
     { "cosh", GMPy_Context_Cosh, METH_O, GMPy_doc_context_cosh },
     { "cot", GMPy_Context_Cot, METH_O, GMPy_doc_context_cot },
@@ -1143,13 +1144,17 @@ static PyMethodDef GMPyContext_methods[] =
     { "eint", GMPy_Context_Eint, METH_O, GMPy_doc_context_eint },
     { "erf", GMPy_Context_Erf, METH_O, GMPy_doc_context_erf },
     { "erfc", GMPy_Context_Erfc, METH_O, GMPy_doc_context_erfc },
+    { "erf_erfc", GMPy_Context_Erf_Erfc, METH_O, GMPy_doc_context_erf_erfc },
+    { "evaluate_to", (PyCFunction)GMPy_Context_Evaluate_To, METH_VARARGS | METH_KEYWORDS, GMPy_doc_context_evaluate_to },
     { "exp", GMPy_Context_Exp, METH_O, GMPy_doc_context_exp },
     { "expm1", GMPy_Context_Expm1, METH_O, GMPy_doc_context_expm1 },
     { "exp10", GMPy_Context_Exp10, METH_O, GMPy_doc_context_exp10 },
     { "exp2", GMPy_Context_Exp2, METH_O, GMPy_doc_context_exp2 },
+    { "exp_expm1", GMPy_Context_Exp_Expm1, METH_O, GMPy_doc_context_exp_expm1 },
     { "factorial", GMPy_Context_Factorial, METH_O, GMPy_doc_context_factorial },
     { "floor", GMPy_Context_Floor, METH_O, GMPy_doc_context_floor },
     { "floor_div", GMPy_Context_FloorDiv, METH_VARARGS, GMPy_doc_context_floordiv },
+    { "fdot", GMPy_Context_Fdot, METH_VARARGS, GMPy_doc_context_fdot },
     { "fma", GMPy_Context_FMA, METH_VARARGS, GMPy_doc_context_fma },
     { "fms", GMPy_Context_FMS, METH_VARARGS, GMPy_doc_context_fms },
 #if MPFR_VERSION_MAJOR > 3
@@ -1162,6 +1167,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "fsum", GMPy_Context_Fsum, METH_O, GMPy_doc_context_fsum },
     { "gamma", GMPy_Context_Gamma, METH_O, GMPy_doc_context_gamma },
     { "gamma_inc", GMPy_Context_Gamma_Inc, METH_VARARGS, GMPy_doc_context_gamma_inc },
+    { "gamma_lgamma", GMPy_Context_Gamma_Lgamma, METH_O, GMPy_doc_context_gamma_lgamma },
     { "hypot", GMPy_Context_Hypot, METH_VARARGS, GMPy_doc_context_hypot },
     { "is_finite", GMPy_Context_Is_Finite, METH_O, GMPy_doc_context_is_finite },
     { "is_infinite", GMPy_Context_Is_Infinite, METH_O, GMPy_doc_context_is_infinite },
@@ -1172,6 +1178,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "is_zero", GMPy_Context_Is_Zero, METH_O, GMPy_doc_context_is_zero },
     { "jn", GMPy_Context_Jn, METH_VARARGS, GMPy_doc_context_jn },
     { "j0", GMPy_Context_J0, METH_O, GMPy_doc_context_j0 },
+    { "j0_j1_y0_y1", GMPy_Context_J0_J1_Y0_Y1, METH_O, GMPy_doc_context_j0_j1_y0_y1 },
     { "j1", GMPy_Context_J1, METH_O, GMPy_doc_context_j1 },
     { "li2", GMPy_Context_Li2, METH_O, GMPy_doc_context_li2 },
     { "lgamma", GMPy_Context_Lgamma, METH_O, GMPy_doc_context_lgamma },
@@ -1180,6 +1187,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "log10", GMPy_Context_Log10, METH_O, GMPy_doc_context_log10 },
     { "log1p", GMPy_Context_Log1p, METH_O, GMPy_doc_context_log1p },
     { "log2", GMPy_Context_Log2, METH_O, GMPy_doc_context_log2 },
+    { "log_log1p", GMPy_Context_Log_Log1p, METH_O, GMPy_doc_context_log_log1p },
     { "maxnum", GMPy_Context_Maxnum, METH_VARARGS, GMPy_doc_context_maxnum },
     { "minnum", GMPy_Context_Minnum, METH_VARARGS, GMPy_doc_context_minnum },
     { "minus", GMPy_Context_Minus, METH_VARARGS, GMPy_doc_context_minus },
@@ -1194,6 +1202,8 @@ static PyMethodDef GMPyContext_methods[] =
     { "phase", GMPy_Context_Phase, METH_O, GMPy_doc_context_phase },
     { "plus", GMPy_Context_Plus, METH_VARARGS, GMPy_doc_context_plus },
     { "polar", GMPy_Context_Polar, METH_O, GMPy_doc_context_polar },
+    { "polyval", GMPy_Context_Polyval, METH_VARARGS, GMPy_doc_context_polyval },
+    { "polyval_many", GMPy_Context_Polyval_Many, METH_VARARGS, GMPy_doc_context_polyval_many },
     { "proj", GMPy_Context_Proj, METH_O, GMPy_doc_context_proj },
     { "pow", GMPy_Context_Pow, METH_VARARGS, GMPy_doc_context_pow },
     { "radians", GMPy_Context_Radians, METH_O, GMPy_doc_context_radians },
@@ -1224,10 +1234,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "tan", GMPy_Context_Tan, METH_O, GMPy_doc_context_tan },
     { "tanh", GMPy_Context_Tanh, METH_O, GMPy_doc_context_tanh },
     { "trunc", GMPy_Context_Trunc, METH_O, GMPy_doc_context_trunc },
-#ifdef VECTOR
-    { "vector", GMPy_Context_Vector, METH_O, GMPy_doc_context_vector },
-    { "vector2", GMPy_Context_Vector2, METH_VARARGS, GMPy_doc_context_vector2 },
-#endif
+    { "vec", (PyCFunction)GMPy_Context_Vec, METH_VARARGS | METH_KEYWORDS, GMPy_doc_context_vec },
     { "yn", GMPy_Context_Yn, METH_VARARGS, GMPy_doc_context_yn },
     { "y0", GMPy_Context_Y0, METH_O, GMPy_doc_context_y0 },
     { "y1", GMPy_Context_Y1, METH_O, GMPy_doc_context_y1 },
@@ -92,6 +92,12 @@ static inline int GMPy_ObjectType(PyObject *obj)
 
     if (XMPZ_Check(obj)) return OBJ_TYPE_XMPZ;
 
+    if (XMPFR_Check(obj)) return OBJ_TYPE_XMPFR;
+
+    if (XMPQ_Check(obj)) return OBJ_TYPE_XMPQ;
+
+    if (XMPC_Check(obj)) return OBJ_TYPE_XMPC;
+
     if (PyLong_Check(obj)) return OBJ_TYPE_PyInteger;
 
     if (PyFloat_Check(obj)) return OBJ_TYPE_PyFloat;
@@ -78,19 +78,22 @@ extern "C" {
 #define OBJ_TYPE_MPQ            16
 #define OBJ_TYPE_PyFraction     17
 #define OBJ_TYPE_HAS_MPQ        18
-/* 19 to 30 reserved for additional rational types. */
+#define OBJ_TYPE_XMPQ           19
+/* 20 to 30 reserved for additional rational types. */
 #define OBJ_TYPE_RATIONAL       31
 
 #define OBJ_TYPE_MPFR           32
 #define OBJ_TYPE_PyFloat        33
 #define OBJ_TYPE_HAS_MPFR       34
-/* 35 to 46 reserved for additional real types. */
+#define OBJ_TYPE_XMPFR          35
+/* 36 to 46 reserved for additional real types. */
 #define OBJ_TYPE_REAL           47
 
 #define OBJ_TYPE_MPC            48
 #define OBJ_TYPE_PyComplex      49
 #define OBJ_TYPE_HAS_MPC        50
-/* 50 to 62 reserved for additional complex types. */
+#define OBJ_TYPE_XMPC           51
+/* 52 to 62 reserved for additional complex types. */
 #define OBJ_TYPE_COMPLEX        63
 
 #define OBJ_TYPE_MAX            64
@@ -112,6 +115,7 @@ extern "C" {
 #define IS_TYPE_MPQ(x)              (x == OBJ_TYPE_MPQ)
 #define IS_TYPE_PyFraction(x)       (x == OBJ_TYPE_PyFraction)
 #define IS_TYPE_HAS_MPQ(x)          (x == OBJ_TYPE_HAS_MPQ)
+#define IS_TYPE_XMPQ(x)             (x == OBJ_TYPE_XMPQ)
 #define IS_TYPE_RATIONAL(x)         ((x > OBJ_TYPE_UNKNOWN) && \
                                      (x < OBJ_TYPE_RATIONAL))
 #define IS_TYPE_RATIONAL_ONLY(x)    ((x > OBJ_TYPE_INTEGER) && \
@@ -120,6 +124,7 @@ extern "C" {
 #define IS_TYPE_MPFR(x)             (x == OBJ_TYPE_MPFR)
 #define IS_TYPE_PyFloat(x)          (x == OBJ_TYPE_PyFloat)
 #define IS_TYPE_HAS_MPFR(x)         (x == OBJ_TYPE_HAS_MPFR)
+#define IS_TYPE_XMPFR(x)            (x == OBJ_TYPE_XMPFR)
 #define IS_TYPE_REAL(x)             ((x > OBJ_TYPE_UNKNOWN) && \
                                      (x < OBJ_TYPE_REAL))
 #define IS_TYPE_REAL_ONLY(x)        ((x > OBJ_TYPE_RATIONAL) && \
@@ -128,6 +133,7 @@ extern "C" {
 #define IS_TYPE_MPC(x)              (x == OBJ_TYPE_MPC)
 #define IS_TYPE_PyComplex(x)        (x == OBJ_TYPE_PyComplex)
 #define IS_TYPE_HAS_MPC(x)          (x == OBJ_TYPE_HAS_MPC)
+#define IS_TYPE_XMPC(x)             (x == OBJ_TYPE_XMPC)
 #define IS_TYPE_COMPLEX(x)          ((x > OBJ_TYPE_UNKNOWN) && \
                                      (x < OBJ_TYPE_COMPLEX))
 #define IS_TYPE_COMPLEX_ONLY(x)     ((x > OBJ_TYPE_REAL) && \
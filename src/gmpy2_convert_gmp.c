@@ -808,6 +808,19 @@ GMPy_MPQ_From_XMPZ(XMPZ_Object *obj, CTXT_Object *context)
     return result;
 }
 
+/* An xmpq can be changed later so a new mpq is always returned. */
+
+static MPQ_Object *
+GMPy_MPQ_From_XMPQ(XMPQ_Object *obj, CTXT_Object *context)
+{
+    MPQ_Object *result;
+
+    if ((result = GMPy_MPQ_New(context)))
+        mpq_set(result->q, obj->q);
+
+    return result;
+}
+
 static MPZ_Object *
 GMPy_MPZ_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
 {
@@ -997,6 +1010,12 @@ GMPy_MPQ_From_Number(PyObject *obj, CTXT_Object *context)
     if (MPFR_Check(obj))
         return GMPy_MPQ_From_MPFR((MPFR_Object*)obj, context);
 
+    if (XMPQ_Check(obj))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
+    if (XMPFR_Check(obj))
+        return GMPy_MPQ_From_MPFR((MPFR_Object*)obj, context);
+
     if (PyFloat_Check(obj))
         return GMPy_MPQ_From_PyFloat(obj, context);
 
@@ -1062,6 +1081,12 @@ GMPy_MPQ_From_NumberWithType(PyObject *obj, int xtype, CTXT_Object *context)
     if (IS_TYPE_MPFR(xtype))
         return GMPy_MPQ_From_MPFR((MPFR_Object*)obj, context);
 
+    if (IS_TYPE_XMPQ(xtype))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
+    if (IS_TYPE_XMPFR(xtype))
+        return GMPy_MPQ_From_MPFR((MPFR_Object*)obj, context);
+
     if (IS_TYPE_PyFloat(xtype))
         return GMPy_MPQ_From_PyFloat(obj, context);
 
@@ -1146,6 +1171,9 @@ GMPy_MPQ_From_Rational(PyObject *obj, CTXT_Object *context)
     if (XMPZ_Check(obj))
         return GMPy_MPQ_From_XMPZ((XMPZ_Object*)obj, context);
 
+    if (XMPQ_Check(obj))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
     if (IS_FRACTION(obj))
         return GMPy_MPQ_From_Fraction(obj, context);
 
@@ -1222,6 +1250,9 @@ GMPy_MPQ_From_RationalWithType(PyObject *obj, int xtype, CTXT_Object *context)
     if (IS_TYPE_XMPZ(xtype))
         return GMPy_MPQ_From_XMPZ((XMPZ_Object*)obj, context);
 
+    if (IS_TYPE_XMPQ(xtype))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
     if (IS_TYPE_PyFraction(xtype))
         return GMPy_MPQ_From_Fraction(obj, context);
 
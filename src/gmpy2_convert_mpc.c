@@ -82,6 +82,34 @@ GMPy_MPC_From_MPC(MPC_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
     return result;
 }
 
+/* A new mpc is always returned since an xmpc can be changed later. */
+
+static MPC_Object *
+GMPy_MPC_From_XMPC(XMPC_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
+                   CTXT_Object *context)
+{
+    MPC_Object *result = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (rprec == 0)
+        rprec = GET_REAL_PREC(context);
+    else if (rprec == 1)
+        rprec = mpfr_get_prec(mpc_realref(obj->c));
+
+    if (iprec == 0)
+        iprec = GET_IMAG_PREC(context);
+    else if (iprec == 1)
+        iprec = mpfr_get_prec(mpc_imagref(obj->c));
+
+    if ((result = GMPy_MPC_New(rprec, iprec, context))) {
+        mpfr_clear_flags();
+        result->rc = mpc_set(result->c, obj->c, GET_MPC_ROUND(context));
+        _GMPy_MPC_Cleanup(&result, context);
+    }
+    return result;
+}
+
 static MPC_Object *
 GMPy_MPC_From_PyComplex(PyObject *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
                         CTXT_Object *context)
@@ -402,6 +430,15 @@ GMPy_MPC_From_ComplexWithType(PyObject* obj, int xtype, mp_prec_t rprec,
     if (IS_TYPE_PyInteger(xtype))
         return GMPy_MPC_From_PyLong(obj, rprec, iprec, context);
 
+    if (IS_TYPE_XMPC(xtype))
+        return GMPy_MPC_From_XMPC((XMPC_Object*)obj, rprec, iprec, context);
+
+    if (IS_TYPE_XMPFR(xtype))
+        return GMPy_MPC_From_MPFR((MPFR_Object*)obj, rprec, iprec, context);
+
+    if (IS_TYPE_XMPQ(xtype))
+        return GMPy_MPC_From_MPQ((MPQ_Object*)obj, rprec, iprec, context);
+
     if (IS_TYPE_PyFraction(xtype))
         return GMPy_MPC_From_Fraction(obj, rprec, iprec, context);
 
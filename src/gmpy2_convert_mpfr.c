@@ -116,6 +116,36 @@ GMPy_MPFR_From_MPFR(MPFR_Object *obj, mpfr_prec_t prec, CTXT_Object *context)
     return result;
 }
 
+/* Unlike GMPy_MPFR_From_MPFR(), a new mpfr is always returned since an xmpfr
+ * can be changed later. If prec==1, the value is copied exactly.
+ */
+
+static MPFR_Object *
+GMPy_MPFR_From_XMPFR(XMPFR_Object *obj, mpfr_prec_t prec, CTXT_Object *context)
+{
+    MPFR_Object *result = NULL;
+
+    if (prec == 1) {
+        if ((result = GMPy_MPFR_New(mpfr_get_prec(obj->f), context))) {
+            mpfr_set(result->f, obj->f, MPFR_RNDN);
+            result->rc = obj->rc;
+        }
+        return result;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (prec == 0)
+        prec = GET_MPFR_PREC(context);
+
+    if ((result = GMPy_MPFR_New(prec, context))) {
+        mpfr_clear_flags();
+        result->rc = mpfr_set(result->f, obj->f, GET_MPFR_ROUND(context));
+        _GMPy_MPFR_Cleanup(&result, context);
+    }
+    return result;
+}
+
 static MPFR_Object *
 GMPy_MPFR_From_PyLong(PyObject *obj, mpfr_prec_t prec, CTXT_Object *context)
 {
@@ -386,6 +416,12 @@ GMPy_MPFR_From_RealWithType(PyObject *obj, int xtype, mp_prec_t prec, CTXT_Objec
     if (IS_TYPE_MPZANY(xtype))
         return GMPy_MPFR_From_MPZ((MPZ_Object*)obj, prec, context);
 
+    if (IS_TYPE_XMPFR(xtype))
+        return GMPy_MPFR_From_XMPFR((XMPFR_Object*)obj, prec, context);
+
+    if (IS_TYPE_XMPQ(xtype))
+        return GMPy_MPFR_From_MPQ((MPQ_Object*)obj, prec, context);
+
     if (IS_TYPE_PyInteger(xtype))
         return GMPy_MPFR_From_PyLong(obj, prec, context);
 
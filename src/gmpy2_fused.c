@@ -686,3 +686,377 @@ PyDoc_STRVAR(GMPy_doc_function_fmms,
 GMPY_MPFR_QUADOP_TEMPLATEWT(FMMS, fmms)
 
 #endif
+
+/* Fused evaluation of related special functions of one argument.
+ *
+ * Where one function can be obtained from another by adding a small
+ * integer, only one of them is evaluated, with GMPY_FUSED_GUARD extra
+ * bits, and both results are rounded from it. mpfr_can_round() proves
+ * that the rounding is correct; if it cannot, the function is evaluated
+ * directly. The intermediate value is always chosen so that the addition
+ * does not cancel, so the fallback is rarely needed.
+ */
+
+#define GMPY_FUSED_GUARD 32
+
+/* Round t, whose error is at most 2**(EXP(t)-err), to result. Returns 0
+ * if the correctly rounded value cannot be determined.
+ */
+
+static int
+GMPy_Fused_Round(MPFR_Object *result, mpfr_srcptr t, mpfr_exp_t err, CTXT_Object *context)
+{
+    if (!mpfr_regular_p(t) ||
+        !mpfr_can_round(t, err, MPFR_RNDN, MPFR_RNDZ, mpfr_get_prec(result->f) + 1)) {
+        return 0;
+    }
+    result->rc = mpfr_set(result->f, t, GET_MPFR_ROUND(context));
+    return 1;
+}
+
+/* Round c + t (or c - t if sign is negative) to result, where t has been
+ * rounded to nearest at its precision.
+ */
+
+static int
+GMPy_Fused_Shift(MPFR_Object *result, mpfr_srcptr t, long c, int sign, CTXT_Object *context)
+{
+    mpfr_prec_t wp = mpfr_get_prec(t);
+    mpfr_t s;
+    int res = 0;
+
+    if (!mpfr_regular_p(t)) {
+        return 0;
+    }
+
+    mpfr_init2(s, wp);
+    if (sign > 0) {
+        mpfr_add_si(s, t, c, MPFR_RNDN);
+    }
+    else {
+        mpfr_si_sub(s, c, t, MPFR_RNDN);
+    }
+
+    /* Both t and s are in error by at most half an ulp. */
+
+    if (mpfr_regular_p(s)) {
+        res = GMPy_Fused_Round(result, s, (mpfr_exp_t)wp + mpfr_get_exp(s) -
+                               Py_MAX(mpfr_get_exp(s), mpfr_get_exp(t)), context);
+    }
+    mpfr_clear(s);
+    return res;
+}
+
+/* Return a tuple of the n results in r, or NULL if any of them is NULL. The
+ * references in r are stolen.
+ */
+
+static PyObject *
+GMPy_Fused_Pack(MPFR_Object **r, int n)
+{
+    PyObject *result = NULL;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (!r[i]) {
+            goto error;
+        }
+    }
+
+    if (!(result = PyTuple_New(n))) {
+        goto error;
+    }
+
+    for (i = 0; i < n; i++) {
+        PyTuple_SET_ITEM(result, i, (PyObject*)r[i]);
+    }
+    return result;
+
+  error:
+    for (i = 0; i < n; i++) {
+        Py_XDECREF((PyObject*)r[i]);
+    }
+    return NULL;
+}
+
+/* Convert x and allocate n results at the context precision. */
+
+static MPFR_Object *
+GMPy_Fused_Init(PyObject *x, int xtype, MPFR_Object **r, int n, CTXT_Object *context)
+{
+    MPFR_Object *tempx;
+    int i, fail = 0;
+
+    tempx = GMPy_MPFR_From_RealWithType(x, xtype, 1, context);
+    for (i = 0; i < n; i++) {
+        if (!(r[i] = GMPy_MPFR_New(0, context))) {
+            fail = 1;
+        }
+    }
+
+    if (!tempx || fail) {
+        Py_XDECREF((PyObject*)tempx);
+        for (i = 0; i < n; i++) {
+            Py_XDECREF((PyObject*)r[i]);
+        }
+        return NULL;
+    }
+    return tempx;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_exp_expm1,
+"exp_expm1(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing exp(x) and expm1(x). Only one of them is\n"
+"evaluated; the other is derived from it.");
+
+PyDoc_STRVAR(GMPy_doc_context_exp_expm1,
+"context.exp_expm1(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing exp(x) and expm1(x). Only one of them is\n"
+"evaluated; the other is derived from it.");
+
+static PyObject *
+GMPy_RealWithType_Exp_Expm1(PyObject *x, int xtype, CTXT_Object *context)
+{
+    MPFR_Object *r[2], *tempx;
+    mpfr_prec_t wp;
+    mpfr_t t;
+    int small;
+
+    if (!(tempx = GMPy_Fused_Init(x, xtype, r, 2, context))) {
+        return NULL;
+    }
+
+    wp = Py_MIN(GET_MPFR_PREC(context) + GMPY_FUSED_GUARD, MPFR_PREC_MAX);
+    mpfr_init2(t, wp);
+
+    /* For |x| < 1, exp(x) = 1 + expm1(x) is in (0.36, 2.72); otherwise
+     * |expm1(x)| = |exp(x) - 1| is greater than 0.63.
+     */
+
+    small = mpfr_regular_p(tempx->f) && mpfr_get_exp(tempx->f) <= 0;
+    if (mpfr_regular_p(tempx->f)) {
+        if (small) {
+            mpfr_expm1(t, tempx->f, MPFR_RNDN);
+        }
+        else {
+            mpfr_exp(t, tempx->f, MPFR_RNDN);
+        }
+    }
+
+    mpfr_clear_flags();
+    if (!(small ? GMPy_Fused_Shift(r[0], t, 1, 1, context)
+                : GMPy_Fused_Round(r[0], t, wp, context))) {
+        r[0]->rc = mpfr_exp(r[0]->f, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[0], context);
+
+    mpfr_clear_flags();
+    if (!(small ? GMPy_Fused_Round(r[1], t, wp, context)
+                : GMPy_Fused_Shift(r[1], t, -1, 1, context))) {
+        r[1]->rc = mpfr_expm1(r[1]->f, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[1], context);
+
+    mpfr_clear(t);
+    Py_DECREF((PyObject*)tempx);
+    return GMPy_Fused_Pack(r, 2);
+}
+
+GMPY_MPFR_UNIOP_TEMPLATEWT(Exp_Expm1, exp_expm1)
+
+PyDoc_STRVAR(GMPy_doc_function_log_log1p,
+"log_log1p(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing log(x) and log1p(x).");
+
+PyDoc_STRVAR(GMPy_doc_context_log_log1p,
+"context.log_log1p(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing log(x) and log1p(x).");
+
+static PyObject *
+GMPy_RealWithType_Log_Log1p(PyObject *x, int xtype, CTXT_Object *context)
+{
+    MPFR_Object *r[2], *tempx;
+
+    if (!(tempx = GMPy_Fused_Init(x, xtype, r, 2, context))) {
+        return NULL;
+    }
+
+    mpfr_clear_flags();
+    r[0]->rc = mpfr_log(r[0]->f, tempx->f, GET_MPFR_ROUND(context));
+    _GMPy_MPFR_Cleanup(&r[0], context);
+
+    mpfr_clear_flags();
+    r[1]->rc = mpfr_log1p(r[1]->f, tempx->f, GET_MPFR_ROUND(context));
+    _GMPy_MPFR_Cleanup(&r[1], context);
+
+    Py_DECREF((PyObject*)tempx);
+    return GMPy_Fused_Pack(r, 2);
+}
+
+GMPY_MPFR_UNIOP_TEMPLATEWT(Log_Log1p, log_log1p)
+
+PyDoc_STRVAR(GMPy_doc_function_gamma_lgamma,
+"gamma_lgamma(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing gamma(x) and the logarithm of the absolute\n"
+"value of gamma(x). The logarithm is derived from gamma(x) when it is\n"
+"finite.");
+
+PyDoc_STRVAR(GMPy_doc_context_gamma_lgamma,
+"context.gamma_lgamma(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing gamma(x) and the logarithm of the absolute\n"
+"value of gamma(x). The logarithm is derived from gamma(x) when it is\n"
+"finite.");
+
+static PyObject *
+GMPy_RealWithType_Gamma_Lgamma(PyObject *x, int xtype, CTXT_Object *context)
+{
+    MPFR_Object *r[2], *tempx;
+    mpfr_prec_t wp;
+    mpfr_t t, l;
+    int signp, done = 0;
+
+    if (!(tempx = GMPy_Fused_Init(x, xtype, r, 2, context))) {
+        return NULL;
+    }
+
+    wp = Py_MIN(GET_MPFR_PREC(context) + GMPY_FUSED_GUARD, MPFR_PREC_MAX);
+    mpfr_init2(t, wp);
+    mpfr_init2(l, wp);
+
+    if (mpfr_regular_p(tempx->f)) {
+        mpfr_gamma(t, tempx->f, MPFR_RNDN);
+    }
+
+    mpfr_clear_flags();
+    if (!GMPy_Fused_Round(r[0], t, wp, context)) {
+        r[0]->rc = mpfr_gamma(r[0]->f, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[0], context);
+
+    /* The relative error of t is at most 2**-wp, so the error of log|t|
+     * before rounding is at most 2**(1-wp).
+     */
+
+    mpfr_clear_flags();
+    if (mpfr_regular_p(t)) {
+        mpfr_abs(l, t, MPFR_RNDN);
+        mpfr_log(l, l, MPFR_RNDN);
+        done = mpfr_regular_p(l) && GMPy_Fused_Round(r[1], l, (mpfr_exp_t)wp + mpfr_get_exp(l) -
+                                Py_MAX(mpfr_get_exp(l), 2), context);
+    }
+    if (!done) {
+        mpfr_clear_flags();
+        r[1]->rc = mpfr_lgamma(r[1]->f, &signp, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[1], context);
+
+    mpfr_clear(t);
+    mpfr_clear(l);
+    Py_DECREF((PyObject*)tempx);
+    return GMPy_Fused_Pack(r, 2);
+}
+
+GMPY_MPFR_UNIOP_TEMPLATEWT(Gamma_Lgamma, gamma_lgamma)
+
+PyDoc_STRVAR(GMPy_doc_function_erf_erfc,
+"erf_erfc(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing erf(x) and erfc(x). Only one of them is\n"
+"evaluated; the other is derived from it.");
+
+PyDoc_STRVAR(GMPy_doc_context_erf_erfc,
+"context.erf_erfc(x, /) -> tuple[mpfr, mpfr]\n\n"
+"Return a tuple containing erf(x) and erfc(x). Only one of them is\n"
+"evaluated; the other is derived from it.");
+
+static PyObject *
+GMPy_RealWithType_Erf_Erfc(PyObject *x, int xtype, CTXT_Object *context)
+{
+    MPFR_Object *r[2], *tempx;
+    mpfr_prec_t wp;
+    mpfr_t t;
+    int small;
+
+    if (!(tempx = GMPy_Fused_Init(x, xtype, r, 2, context))) {
+        return NULL;
+    }
+
+    wp = Py_MIN(GET_MPFR_PREC(context) + GMPY_FUSED_GUARD, MPFR_PREC_MAX);
+    mpfr_init2(t, wp);
+
+    /* For x < 1/2, erfc(x) = 1 - erf(x) with erf(x) < 0.53. Otherwise
+     * erfc(x) < 0.48 and erf(x) = 1 - erfc(x). Evaluating erfc(x) for
+     * negative x would itself go through erf(x).
+     */
+
+    small = mpfr_regular_p(tempx->f) &&
+            (mpfr_signbit(tempx->f) || mpfr_get_exp(tempx->f) <= -1);
+    if (mpfr_regular_p(tempx->f)) {
+        if (small) {
+            mpfr_erf(t, tempx->f, MPFR_RNDN);
+        }
+        else {
+            mpfr_erfc(t, tempx->f, MPFR_RNDN);
+        }
+    }
+
+    mpfr_clear_flags();
+    if (!(small ? GMPy_Fused_Round(r[0], t, wp, context)
+                : GMPy_Fused_Shift(r[0], t, 1, -1, context))) {
+        r[0]->rc = mpfr_erf(r[0]->f, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[0], context);
+
+    mpfr_clear_flags();
+    if (!(small ? GMPy_Fused_Shift(r[1], t, 1, -1, context)
+                : GMPy_Fused_Round(r[1], t, wp, context))) {
+        r[1]->rc = mpfr_erfc(r[1]->f, tempx->f, GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&r[1], context);
+
+    mpfr_clear(t);
+    Py_DECREF((PyObject*)tempx);
+    return GMPy_Fused_Pack(r, 2);
+}
+
+GMPY_MPFR_UNIOP_TEMPLATEWT(Erf_Erfc, erf_erfc)
+
+PyDoc_STRVAR(GMPy_doc_function_j0_j1_y0_y1,
+"j0_j1_y0_y1(x, /) -> tuple[mpfr, mpfr, mpfr, mpfr]\n\n"
+"Return a tuple containing the Bessel functions j0(x), j1(x), y0(x)\n"
+"and y1(x).");
+
+PyDoc_STRVAR(GMPy_doc_context_j0_j1_y0_y1,
+"context.j0_j1_y0_y1(x, /) -> tuple[mpfr, mpfr, mpfr, mpfr]\n\n"
+"Return a tuple containing the Bessel functions j0(x), j1(x), y0(x)\n"
+"and y1(x).");
+
+static PyObject *
+GMPy_RealWithType_J0_J1_Y0_Y1(PyObject *x, int xtype, CTXT_Object *context)
+{
+    static int (*funcs[4])(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t) = {
+        mpfr_j0, mpfr_j1, mpfr_y0, mpfr_y1
+    };
+    MPFR_Object *r[4], *tempx;
+    int i;
+
+    if (!(tempx = GMPy_Fused_Init(x, xtype, r, 4, context))) {
+        return NULL;
+    }
+
+    for (i = 0; i < 4; i++) {
+        mpfr_clear_flags();
+        r[i]->rc = funcs[i](r[i]->f, tempx->f, GET_MPFR_ROUND(context));
+        _GMPy_MPFR_Cleanup(&r[i], context);
+        if (!r[i]) {
+            break;
+        }
+    }
+
+    Py_DECREF((PyObject*)tempx);
+    for (i++; i < 4; i++) {
+        Py_CLEAR(r[i]);
+    }
+    return GMPy_Fused_Pack(r, 4);
+}
+
+GMPY_MPFR_UNIOP_TEMPLATEWT(J0_J1_Y0_Y1, j0_j1_y0_y1)
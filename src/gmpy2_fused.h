@@ -59,6 +59,26 @@ static PyObject * GMPy_Number_FMMS(PyObject *x, PyObject *y, PyObject *z, PyObje
 static PyObject * GMPy_Context_FMMS(PyObject *self, PyObject *args);
 #endif
 
+static PyObject * GMPy_RealWithType_Exp_Expm1(PyObject *x, int xtype, CTXT_Object *context);
+static PyObject * GMPy_Number_Exp_Expm1(PyObject *x, CTXT_Object *context);
+static PyObject * GMPy_Context_Exp_Expm1(PyObject *self, PyObject *other);
+
+static PyObject * GMPy_RealWithType_Log_Log1p(PyObject *x, int xtype, CTXT_Object *context);
+static PyObject * GMPy_Number_Log_Log1p(PyObject *x, CTXT_Object *context);
+static PyObject * GMPy_Context_Log_Log1p(PyObject *self, PyObject *other);
+
+static PyObject * GMPy_RealWithType_Gamma_Lgamma(PyObject *x, int xtype, CTXT_Object *context);
+static PyObject * GMPy_Number_Gamma_Lgamma(PyObject *x, CTXT_Object *context);
+static PyObject * GMPy_Context_Gamma_Lgamma(PyObject *self, PyObject *other);
+
+static PyObject * GMPy_RealWithType_Erf_Erfc(PyObject *x, int xtype, CTXT_Object *context);
+static PyObject * GMPy_Number_Erf_Erfc(PyObject *x, CTXT_Object *context);
+static PyObject * GMPy_Context_Erf_Erfc(PyObject *self, PyObject *other);
+
+static PyObject * GMPy_RealWithType_J0_J1_Y0_Y1(PyObject *x, int xtype, CTXT_Object *context);
+static PyObject * GMPy_Number_J0_J1_Y0_Y1(PyObject *x, CTXT_Object *context);
+static PyObject * GMPy_Context_J0_J1_Y0_Y1(PyObject *self, PyObject *other);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,41 +46,54 @@ GMPy_MPZ_Hash_Slot(MPZ_Object *self)
     return (self->hash_cache = hash);
 }
 
+/* Return the inverse of a modulo PyHASH_MODULUS, using the extended
+ * Euclidean algorithm on single words. a must be nonzero and reduced.
+ */
+
+static mp_limb_t
+_hash_invert(mp_limb_t a)
+{
+    Py_hash_t r0 = (Py_hash_t)PyHASH_MODULUS, r1 = (Py_hash_t)a;
+    Py_hash_t t0 = 0, t1 = 1, q, tmp;
+
+    while (r1) {
+        q = r0 / r1;
+        tmp = r0 - q * r1; r0 = r1; r1 = tmp;
+        tmp = t0 - q * t1; t0 = t1; t1 = tmp;
+    }
+    if (t0 < 0) {
+        t0 += (Py_hash_t)PyHASH_MODULUS;
+    }
+    return (mp_limb_t)t0;
+}
+
+/* Same value as hash(fractions.Fraction): |num| * den**-1 modulo
+ * PyHASH_MODULUS, or PyHASH_INF if the modulus divides den. Both parts are
+ * reduced to a single word with mpn_mod_1(), so no mpz temporaries are
+ * needed.
+ */
+
 static Py_hash_t
 GMPy_MPQ_Hash_Slot(MPQ_Object *self)
 {
-    Py_hash_t hash = 0;
-    mpz_t temp, temp1, mask;
+    Py_hash_t hash;
+    mp_limb_t num, den, prod[2];
 
     if (self->hash_cache != -1) {
         return self->hash_cache;
     }
 
-    mpz_init(temp);
-    mpz_init(temp1);
-    mpz_init(mask);
-    mpz_set_si(mask, 1);
-    mpz_mul_2exp(mask, mask, PyHASH_BITS);
-    mpz_sub_ui(mask, mask, 1);
-
-    if (!mpz_invert(temp, mpq_denref(self->q), mask)) {
-        mpz_clear(temp);
-        mpz_clear(temp1);
-        mpz_clear(mask);
+    den = mpn_mod_1(mpq_denref(self->q)->_mp_d,
+                    (mp_size_t)mpz_size(mpq_denref(self->q)), PyHASH_MODULUS);
+    if (den == 0) {
         hash = PyHASH_INF;
-        if (mpz_sgn(mpq_numref(self->q)) < 0) {
-            hash = -hash;
-        }
-        self->hash_cache = hash;
-        return hash;
     }
-    mpz_set(temp1, mask);
-    mpz_sub_ui(temp1, temp1, 2);
-    mpz_powm(temp, mpq_denref(self->q), temp1, mask);
-
-    mpz_tdiv_r(temp1, mpq_numref(self->q), mask);
-    mpz_mul(temp, temp, temp1);
-    hash = (Py_hash_t)mpn_mod_1(temp->_mp_d, (mp_size_t)mpz_size(temp), PyHASH_MODULUS);
+    else {
+        num = mpn_mod_1(mpq_numref(self->q)->_mp_d,
+                        (mp_size_t)mpz_size(mpq_numref(self->q)), PyHASH_MODULUS);
+        prod[1] = mpn_mul_1(prod, &num, 1, _hash_invert(den));
+        hash = (Py_hash_t)mpn_mod_1(prod, 2, PyHASH_MODULUS);
+    }
 
     if (mpz_sgn(mpq_numref(self->q)) < 0) {
         hash = -hash;
@@ -88,11 +101,7 @@ GMPy_MPQ_Hash_Slot(MPQ_Object *self)
     if (hash == -1) {
         hash = -2;
     }
-    mpz_clear(temp);
-    mpz_clear(temp1);
-    mpz_clear(mask);
-    self->hash_cache = hash;
-    return hash;
+    return (self->hash_cache = hash);
 }
 
 static Py_hash_t
@@ -1995,21 +1995,232 @@ GMPy_Context_Factorial(PyObject *self, PyObject *other)
     return (PyObject*)result;
 }
 
+/* A table of mpfr_ptr built from an iterable of real numbers, as needed
+ * by mpfr_sum() and mpfr_dot(). mpfr instances and the elements of an
+ * mpfr_array are used in place; integers and floats are converted exactly.
+ * Rationals cannot be represented by an mpfr, so they are stored as an mpq
+ * with a NULL entry in tab and counted in nq. refs holds a reference to
+ * every object that owns one of the values.
+ */
+
+typedef struct {
+    Py_ssize_t size;
+    Py_ssize_t alloc;
+    Py_ssize_t nq;
+    mpfr_ptr *tab;
+    PyObject **refs;
+} GMPy_MPFR_Table;
+
+static void
+GMPy_MPFR_Table_Clear(GMPy_MPFR_Table *t)
+{
+    Py_ssize_t i;
+
+    if (t->refs) {
+        for (i = 0; i < t->size; i++) {
+            Py_DECREF(t->refs[i]);
+        }
+    }
+    PyMem_Free(t->tab);
+    PyMem_Free(t->refs);
+    t->size = t->alloc = t->nq = 0;
+    t->tab = NULL;
+    t->refs = NULL;
+}
+
+static int
+GMPy_MPFR_Table_Append(GMPy_MPFR_Table *t, mpfr_ptr value, PyObject *owner)
+{
+    if (t->size == t->alloc) {
+        Py_ssize_t alloc = t->alloc ? 2 * t->alloc : 64;
+        mpfr_ptr *tab;
+        PyObject **refs;
+
+        if (!(tab = PyMem_Realloc(t->tab, alloc * sizeof(mpfr_ptr)))) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        t->tab = tab;
+        if (!(refs = PyMem_Realloc(t->refs, alloc * sizeof(PyObject*)))) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        t->refs = refs;
+        t->alloc = alloc;
+    }
+    Py_INCREF(owner);
+    t->tab[t->size] = value;
+    t->refs[t->size] = owner;
+    t->size++;
+    if (!value) {
+        t->nq++;
+    }
+    return 0;
+}
+
+/* Remove entry i of the table by moving entry j, with j <= i, over it.
+ * Used to compact the table after the rationals have been removed.
+ */
+
+static void
+GMPy_MPFR_Table_Move(GMPy_MPFR_Table *t, Py_ssize_t j, Py_ssize_t i)
+{
+    t->tab[j] = t->tab[i];
+    t->refs[j] = t->refs[i];
+}
+
+/* Set result to the correctly rounded value of the sum of x[i], or of
+ * x[i]*y[i] if y is not NULL, plus the rational q. The sum of the mpfr
+ * values is first computed exactly, so the result is rounded only once.
+ */
+
+static int
+GMPy_MPFR_Table_Add_Q(MPFR_Object *result, mpfr_ptr *x, mpfr_ptr *y,
+                      Py_ssize_t n, mpq_srcptr q, CTXT_Object *context)
+{
+    mpfr_exp_t top = 0, bot = 0, e, b;
+    mpfr_prec_t prec = MPFR_PREC_MIN;
+    Py_ssize_t i, k;
+    int found = 0;
+    mpfr_t sum;
+
+    /* Every value is a multiple of 2**bot less than 2**top. */
+    for (i = 0; i < n; i++) {
+        if (!mpfr_regular_p(x[i]) || (y && !mpfr_regular_p(y[i]))) {
+            continue;
+        }
+        e = mpfr_get_exp(x[i]);
+        b = e - mpfr_get_prec(x[i]);
+        if (y) {
+            e += mpfr_get_exp(y[i]);
+            b += mpfr_get_exp(y[i]) - mpfr_get_prec(y[i]);
+        }
+        if (!found || e > top) {
+            top = e;
+        }
+        if (!found || b < bot) {
+            bot = b;
+        }
+        found = 1;
+    }
+
+    if (found) {
+        for (k = n; k; k >>= 1) {
+            top++;
+        }
+        if ((double)top - (double)bot > (double)(MPFR_PREC_MAX - 1)) {
+            OVERFLOW_ERROR("sum of rationals and mpfr values is too wide to compute exactly");
+            return -1;
+        }
+        prec = (mpfr_prec_t)(top - bot + 1);
+    }
+
+    mpfr_init2(sum, prec);
+    if (y) {
+        mpfr_dot(sum, x, y, (unsigned long)n, MPFR_RNDN);
+    }
+    else {
+        mpfr_sum(sum, x, (unsigned long)n, MPFR_RNDN);
+    }
+    result->rc = mpfr_add_q(result->f, sum, q, GET_MPFR_ROUND(context));
+    mpfr_clear(sum);
+    return 0;
+}
+
+/* Fill the table from obj, which may be any iterable including a
+ * generator. The items are consumed one at a time so no intermediate
+ * list is created.
+ */
+
+static int
+GMPy_MPFR_Table_Fill(GMPy_MPFR_Table *t, PyObject *obj, const char *name,
+                     CTXT_Object *context)
+{
+    PyObject *iter, *item;
+    MPFR_Object *temp;
+    MPQ_Object *tempq;
+    Py_ssize_t i;
+    int xtype;
+
+    if (MPFR_Array_Check(obj)) {
+        MPFR_Array_Object *arr = (MPFR_Array_Object*)obj;
+
+        for (i = 0; i < arr->size; i++) {
+            if (GMPy_MPFR_Table_Append(t, MPFR_ARRAY_ELEM(arr, i), obj) < 0) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    if (!(iter = PyObject_GetIter(obj))) {
+        PyErr_Format(PyExc_TypeError, "%s() argument must be an iterable", name);
+        return -1;
+    }
+
+    while ((item = PyIter_Next(iter))) {
+        xtype = GMPy_ObjectType(item);
+        if (IS_TYPE_MPFR(xtype)) {
+            temp = (MPFR_Object*)item;
+            Py_INCREF(item);
+        }
+        else if (IS_TYPE_RATIONAL_ONLY(xtype)) {
+            tempq = GMPy_MPQ_From_RationalWithType(item, xtype, context);
+            Py_DECREF(item);
+            if (!tempq || GMPy_MPFR_Table_Append(t, NULL, (PyObject*)tempq) < 0) {
+                Py_XDECREF((PyObject*)tempq);
+                Py_DECREF(iter);
+                return -1;
+            }
+            Py_DECREF((PyObject*)tempq);
+            continue;
+        }
+        else if (!IS_TYPE_REAL(xtype) ||
+                 !(temp = GMPy_MPFR_From_RealWithType(item, xtype, 1, context))) {
+            Py_DECREF(item);
+            Py_DECREF(iter);
+            if (!PyErr_Occurred() || PyErr_ExceptionMatches(PyExc_TypeError)) {
+                PyErr_Clear();
+                PyErr_Format(PyExc_TypeError,
+                             "all items in %s() argument must be real numbers", name);
+            }
+            return -1;
+        }
+        Py_DECREF(item);
+
+        if (GMPy_MPFR_Table_Append(t, temp->f, (PyObject*)temp) < 0) {
+            Py_DECREF((PyObject*)temp);
+            Py_DECREF(iter);
+            return -1;
+        }
+        Py_DECREF((PyObject*)temp);
+    }
+
+    Py_DECREF(iter);
+    return PyErr_Occurred() ? -1 : 0;
+}
+
 PyDoc_STRVAR(GMPy_doc_function_fsum,
 "fsum(iterable, /) -> mpfr\n\n"
-"Return an accurate sum of the values in the iterable.");
+"Return an accurate sum of the values in the iterable. The result is\n"
+"correctly rounded. iterable may be any iterable of real numbers,\n"
+"including a generator or an mpfr_array. Rational values are included\n"
+"exactly.");
 
 PyDoc_STRVAR(GMPy_doc_context_fsum,
 "fsum(iterable, /) -> mpfr\n\n"
-"Return an accurate sum of the values in the iterable.");
+"Return an accurate sum of the values in the iterable. The result is\n"
+"correctly rounded. iterable may be any iterable of real numbers,\n"
+"including a generator or an mpfr_array. Rational values are included\n"
+"exactly.");
 
 static PyObject *
 GMPy_Context_Fsum(PyObject *self, PyObject *other)
 {
-    MPFR_Object *temp, *result;
-    mpfr_ptr *tab;
-    int errcode;
-    Py_ssize_t i, seq_length = 0;
+    MPFR_Object *result = NULL;
+    GMPy_MPFR_Table t = {0};
+    Py_ssize_t i, j;
+    int rc;
     CTXT_Object *context = NULL;
 
     if (self && CTXT_Check(self)) {
@@ -2019,63 +2230,181 @@ GMPy_Context_Fsum(PyObject *self, PyObject *other)
         CHECK_CONTEXT(context);
     }
 
-    if (!(result = GMPy_MPFR_New(0, context))) {
-        return NULL;
+    if (GMPy_MPFR_Table_Fill(&t, other, "fsum", context) < 0) {
+        goto cleanup;
     }
 
-    if (!(other = PySequence_List(other))) {
-        Py_DECREF((PyObject*)result);
-        TYPE_ERROR("argument must be an iterable");
-        return NULL;
+    if ((size_t)t.size > ULONG_MAX) {
+        /* LCOV_EXCL_START */
+        OVERFLOW_ERROR("temporary array is too large");
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
     }
 
-    /* other contains a new list containing all the values from the
-     * iterable. Now make sure each item in the list is an mpfr.
-     */
+    if (!(result = GMPy_MPFR_New(0, context))) {
+        goto cleanup;
+    }
 
-    seq_length = PyList_GET_SIZE(other);
-    if (seq_length > LONG_MAX) {
-        OVERFLOW_ERROR("temporary array is too large");
-	Py_DECREF(other);
-	Py_DECREF((PyObject*)result);
-	return NULL;
-    }
-    for (i=0; i < seq_length; i++) {
-        if (!(temp = GMPy_MPFR_From_Real(PyList_GET_ITEM(other, i), 1, context))) {
-            Py_DECREF(other);
-            Py_DECREF((PyObject*)result);
-            TYPE_ERROR("all items in iterable must be real numbers");
-            return NULL;
+    mpfr_clear_flags();
+    if (t.nq) {
+        mpq_t q;
+
+        /* Add the rationals exactly and remove them from the table. */
+        mpq_init(q);
+        for (i = 0, j = 0; i < t.size; i++) {
+            if (t.tab[i]) {
+                GMPy_MPFR_Table_Move(&t, j++, i);
+            }
+            else {
+                mpq_add(q, q, MPQ(t.refs[i]));
+                Py_DECREF(t.refs[i]);
+            }
         }
-
-        errcode = PyList_SetItem(other, i,(PyObject*)temp);
-        if (errcode < 0) {
-            Py_DECREF(other);
-            Py_DECREF((PyObject*)result);
-            TYPE_ERROR("all items in iterable must be real numbers");
-            return NULL;
+        t.size = j;
+        t.nq = 0;
+        rc = GMPy_MPFR_Table_Add_Q(result, t.tab, NULL, t.size, q, context);
+        mpq_clear(q);
+        if (rc < 0) {
+            Py_CLEAR(result);
+            goto cleanup;
         }
     }
+    else {
+        result->rc = mpfr_sum(result->f, t.tab, (unsigned long)t.size,
+                              GET_MPFR_ROUND(context));
+    }
+    _GMPy_MPFR_Cleanup(&result, context);
+
+  cleanup:
+    GMPy_MPFR_Table_Clear(&t);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_fdot,
+"fdot(x, y, /) -> mpfr\n\n"
+"Return the correctly rounded sum of x[i]*y[i]. x and y may be any\n"
+"iterables of real numbers of the same length, including generators\n"
+"and mpfr_array instances. No intermediate products are created and\n"
+"rational values are included exactly.");
+
+PyDoc_STRVAR(GMPy_doc_context_fdot,
+"context.fdot(x, y, /) -> mpfr\n\n"
+"Return the correctly rounded sum of x[i]*y[i]. x and y may be any\n"
+"iterables of real numbers of the same length, including generators\n"
+"and mpfr_array instances. No intermediate products are created and\n"
+"rational values are included exactly.");
+
+static PyObject *
+GMPy_Context_Fdot(PyObject *self, PyObject *args)
+{
+    MPFR_Object *result = NULL;
+    GMPy_MPFR_Table tx = {0}, ty = {0};
+    Py_ssize_t i, j;
+    int rc;
+    CTXT_Object *context = NULL;
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
 
-    /* create an array of pointers to the mpfr_t field of a Pympfr object */
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("fdot() requires 2 arguments");
+        return NULL;
+    }
 
-    if (!(tab = (mpfr_ptr *)malloc((sizeof(mpfr_srcptr) * seq_length)))) {
-        Py_DECREF(other);
-        Py_DECREF((PyObject*)result);
-        return PyErr_NoMemory();
+    if (GMPy_MPFR_Table_Fill(&tx, PyTuple_GET_ITEM(args, 0), "fdot", context) < 0 ||
+        GMPy_MPFR_Table_Fill(&ty, PyTuple_GET_ITEM(args, 1), "fdot", context) < 0) {
+        goto cleanup;
     }
-    for (i=0; i < seq_length; i++) {
-        temp = (MPFR_Object*)PyList_GET_ITEM(other, i);
-        tab[i] = temp->f;
+
+    if (tx.size != ty.size) {
+        VALUE_ERROR("fdot() arguments must have the same length");
+        goto cleanup;
     }
 
-    mpfr_clear_flags();
+    if ((size_t)tx.size > ULONG_MAX) {
+        /* LCOV_EXCL_START */
+        OVERFLOW_ERROR("temporary array is too large");
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
 
-    /* The cast is safe since we have compared seq_length to LONG_MAX. */
-    result->rc = mpfr_sum(result->f, tab, (unsigned long)seq_length, GET_MPFR_ROUND(context));
-    Py_DECREF(other);
-    free(tab);
+    if (!(result = GMPy_MPFR_New(0, context))) {
+        goto cleanup;
+    }
 
+    mpfr_clear_flags();
+    if (tx.nq || ty.nq) {
+        mpfr_ptr f;
+        mpq_t q, prod;
+        mpfr_t special, temp;
+
+        /* A product involving a rational is computed exactly as an mpq,
+         * unless the other factor is an infinity or NaN; such products
+         * are summed in special, which then determines the result.
+         */
+        mpq_init(q);
+        mpq_init(prod);
+        mpfr_init2(special, MPFR_PREC_MIN);
+        mpfr_init2(temp, MPFR_PREC_MIN);
+        mpfr_set_zero(special, 1);
+        for (i = 0, j = 0; i < tx.size; i++) {
+            if (tx.tab[i] && ty.tab[i]) {
+                GMPy_MPFR_Table_Move(&tx, j, i);
+                GMPy_MPFR_Table_Move(&ty, j++, i);
+                continue;
+            }
+            if (!tx.tab[i] && !ty.tab[i]) {
+                mpq_mul(prod, MPQ(tx.refs[i]), MPQ(ty.refs[i]));
+                mpq_add(q, q, prod);
+            }
+            else {
+                f = tx.tab[i] ? tx.tab[i] : ty.tab[i];
+                if (mpfr_number_p(f)) {
+                    mpfr_get_q(prod, f);
+                    mpq_mul(prod, prod, MPQ(tx.tab[i] ? ty.refs[i] : tx.refs[i]));
+                    mpq_add(q, q, prod);
+                }
+                else {
+                    mpfr_mul_q(temp, f, MPQ(tx.tab[i] ? ty.refs[i] : tx.refs[i]), MPFR_RNDN);
+                    mpfr_add(special, special, temp, MPFR_RNDN);
+                }
+            }
+            Py_DECREF(tx.refs[i]);
+            Py_DECREF(ty.refs[i]);
+        }
+        tx.size = ty.size = j;
+        tx.nq = ty.nq = 0;
+        if (mpfr_zero_p(special)) {
+            rc = GMPy_MPFR_Table_Add_Q(result, tx.tab, ty.tab, tx.size, q, context);
+        }
+        else {
+            mpfr_dot(result->f, tx.tab, ty.tab, (unsigned long)tx.size,
+                     GET_MPFR_ROUND(context));
+            result->rc = mpfr_add(result->f, result->f, special,
+                                  GET_MPFR_ROUND(context));
+            rc = 0;
+        }
+        mpq_clear(q);
+        mpq_clear(prod);
+        mpfr_clear(special);
+        mpfr_clear(temp);
+        if (rc < 0) {
+            Py_CLEAR(result);
+            goto cleanup;
+        }
+    }
+    else {
+        result->rc = mpfr_dot(result->f, tx.tab, ty.tab, (unsigned long)tx.size,
+                              GET_MPFR_ROUND(context));
+    }
     _GMPy_MPFR_Cleanup(&result, context);
+
+  cleanup:
+    GMPy_MPFR_Table_Clear(&tx);
+    GMPy_MPFR_Table_Clear(&ty);
     return (PyObject*)result;
 }
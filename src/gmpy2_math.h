@@ -339,6 +339,7 @@ static PyObject * GMPy_Context_NextBelow(PyObject *self, PyObject *other);
 static PyObject * GMPy_Context_Factorial(PyObject *self, PyObject *other);
 
 static PyObject * GMPy_Context_Fsum(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Fdot(PyObject *self, PyObject *args);
 
 #ifdef __cplusplus
 }
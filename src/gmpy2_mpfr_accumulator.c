@@ -0,0 +1,329 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpfr_accumulator.c                                                *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Add x to the exact sum held in self. Returns -1 and sets an exception if
+ * the sum cannot be represented exactly.
+ */
+
+static int
+GMPy_MPFR_Accumulator_AddValue(MPFR_Accumulator_Object *self, mpfr_srcptr x)
+{
+    mpfr_exp_t hi, lo;
+    mpfr_prec_t prec;
+    int sign;
+
+    self->count++;
+
+    if (mpfr_zero_p(self->sum) && mpfr_regular_p(x)) {
+        mpfr_set_prec(self->sum, mpfr_get_prec(x));
+        mpfr_set(self->sum, x, MPFR_RNDN);
+        return 0;
+    }
+
+    /* If either operand is zero, Inf or NaN, the addition is exact. */
+
+    if (!mpfr_regular_p(self->sum) || !mpfr_regular_p(x)) {
+        mpfr_add(self->sum, self->sum, x, MPFR_RNDN);
+        return 0;
+    }
+
+    /* Both values are multiples of 2**lo and the magnitude of their sum is
+     * less than 2**hi, so hi - lo bits are enough to hold the sum.
+     */
+
+    hi = Py_MAX(mpfr_get_exp(self->sum), mpfr_get_exp(x)) + 1;
+    lo = Py_MIN(mpfr_get_exp(self->sum) - mpfr_get_prec(self->sum),
+                mpfr_get_exp(x) - mpfr_get_prec(x));
+    if (hi - lo > MPFR_PREC_MAX) {
+        OVERFLOW_ERROR("exponent range of the accumulated values is too large");
+        return -1;
+    }
+
+    prec = (mpfr_prec_t)(hi - lo);
+    if (prec > mpfr_get_prec(self->sum)) {
+        mpfr_prec_round(self->sum, prec, MPFR_RNDN);
+    }
+
+    mpfr_clear_flags();
+    if (mpfr_add(self->sum, self->sum, x, MPFR_RNDN) || mpfr_overflow_p()) {
+        /* LCOV_EXCL_START */
+        OVERFLOW_ERROR("accumulated sum is too large");
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* Drop the trailing zero bits left behind by cancellation. */
+
+    if (mpfr_zero_p(self->sum)) {
+        sign = mpfr_signbit(self->sum) ? -1 : 1;
+        mpfr_set_prec(self->sum, MPFR_PREC_MIN);
+        mpfr_set_zero(self->sum, sign);
+    }
+    else {
+        prec = Py_MAX(mpfr_min_prec(self->sum), MPFR_PREC_MIN);
+        if (prec < mpfr_get_prec(self->sum)) {
+            mpfr_prec_round(self->sum, prec, MPFR_RNDN);
+        }
+    }
+    return 0;
+}
+
+static int
+GMPy_MPFR_Accumulator_AddObject(MPFR_Accumulator_Object *self, PyObject *obj,
+                                CTXT_Object *context)
+{
+    MPFR_Object *temp;
+    int xtype, res;
+
+    xtype = GMPy_ObjectType(obj);
+    if (IS_TYPE_MPFR(xtype)) {
+        return GMPy_MPFR_Accumulator_AddValue(self, ((MPFR_Object*)obj)->f);
+    }
+
+    if (!IS_TYPE_REAL(xtype)) {
+        TYPE_ERROR("mpfr_accumulator only accepts real numbers");
+        return -1;
+    }
+
+    if (!(temp = GMPy_MPFR_From_RealWithType(obj, xtype, 1, context))) {
+        return -1;
+    }
+    res = GMPy_MPFR_Accumulator_AddValue(self, temp->f);
+    Py_DECREF((PyObject*)temp);
+    return res;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_accumulator,
+"mpfr_accumulator(precision=0)\n\n"
+"Return an accumulator for a correctly rounded sum of real numbers. The\n"
+"exact sum of all the values passed to add() and add_many() is kept and\n"
+"it is rounded only once, by value(), to the given precision using the\n"
+"rounding mode of the current context. precision must be at least 2; if\n"
+"it is 0, the precision of the current context is used.\n\n"
+"mpfr values are added exactly; rationals are first rounded to the\n"
+"precision of the current context. The memory used by the accumulator\n"
+"depends on the exponent range of the values added but not on their\n"
+"number.");
+
+static PyObject *
+GMPy_MPFR_Accumulator_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"precision", NULL};
+    MPFR_Accumulator_Object *result;
+    long prec = 0;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|l", kwlist, &prec)) {
+        return NULL;
+    }
+
+    if (prec == 0) {
+        prec = GET_MPFR_PREC(context);
+    }
+
+    /* value() uses GMPy_MPFR_New(), which reads a precision of 1 as the
+     * precision of the context.
+     */
+    if (prec < 2 || prec > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(MPFR_Accumulator_Object, &MPFR_Accumulator_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpfr_init2(result->sum, MPFR_PREC_MIN);
+    mpfr_set_zero(result->sum, 1);
+    result->prec = (mpfr_prec_t)prec;
+    result->count = 0;
+    return (PyObject*)result;
+}
+
+static void
+GMPy_MPFR_Accumulator_Dealloc(MPFR_Accumulator_Object *self)
+{
+    mpfr_clear(self->sum);
+    PyObject_Free(self);
+}
+
+static PyObject *
+GMPy_MPFR_Accumulator_Repr(MPFR_Accumulator_Object *self)
+{
+    return PyUnicode_FromFormat("<mpfr_accumulator precision=%ld count=%llu>",
+                                (long)self->prec, self->count);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_accumulator_add,
+"x.add(y, /) -> None\n\n"
+"Add the real number y to the accumulator.");
+
+static PyObject *
+GMPy_MPFR_Accumulator_Add(PyObject *self, PyObject *other)
+{
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (GMPy_MPFR_Accumulator_AddObject((MPFR_Accumulator_Object*)self, other, context) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_accumulator_add_many,
+"x.add_many(iterable, /) -> None\n\n"
+"Add every real number in iterable to the accumulator. iterable may be a\n"
+"generator or an mpfr_array; the values are consumed one at a time. If an\n"
+"item is not a real number, the items before it have already been added.");
+
+static PyObject *
+GMPy_MPFR_Accumulator_AddMany(PyObject *self, PyObject *other)
+{
+    MPFR_Accumulator_Object *acc = (MPFR_Accumulator_Object*)self;
+    PyObject *iter, *item;
+    Py_ssize_t i;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (MPFR_Array_Check(other)) {
+        MPFR_Array_Object *arr = (MPFR_Array_Object*)other;
+
+        for (i = 0; i < arr->size; i++) {
+            if (GMPy_MPFR_Accumulator_AddValue(acc, MPFR_ARRAY_ELEM(arr, i)) < 0) {
+                return NULL;
+            }
+        }
+        Py_RETURN_NONE;
+    }
+
+    if (!(iter = PyObject_GetIter(other))) {
+        TYPE_ERROR("add_many() argument must be an iterable");
+        return NULL;
+    }
+
+    while ((item = PyIter_Next(iter))) {
+        if (GMPy_MPFR_Accumulator_AddObject(acc, item, context) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(iter);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+
+    Py_DECREF(iter);
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_accumulator_value,
+"x.value() -> mpfr\n\n"
+"Return the sum of the values added so far, correctly rounded to the\n"
+"precision of the accumulator. The accumulator is not modified.");
+
+static PyObject *
+GMPy_MPFR_Accumulator_Value(PyObject *self, PyObject *args)
+{
+    MPFR_Accumulator_Object *acc = (MPFR_Accumulator_Object*)self;
+    MPFR_Object *result;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!(result = GMPy_MPFR_New(acc->prec, context))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpfr_clear_flags();
+    result->rc = mpfr_set(result->f, acc->sum, GET_MPFR_ROUND(context));
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_accumulator_reset,
+"x.reset() -> None\n\n"
+"Set the accumulated sum to zero and release the memory it used.");
+
+static PyObject *
+GMPy_MPFR_Accumulator_Reset(PyObject *self, PyObject *args)
+{
+    MPFR_Accumulator_Object *acc = (MPFR_Accumulator_Object*)self;
+
+    mpfr_clear(acc->sum);
+    mpfr_init2(acc->sum, MPFR_PREC_MIN);
+    mpfr_set_zero(acc->sum, 1);
+    acc->count = 0;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_MPFR_Accumulator_GetPrec(MPFR_Accumulator_Object *self, void *closure)
+{
+    return PyLong_FromSsize_t((Py_ssize_t)self->prec);
+}
+
+static PyObject *
+GMPy_MPFR_Accumulator_GetCount(MPFR_Accumulator_Object *self, void *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->count);
+}
+
+static PyMethodDef GMPy_MPFR_Accumulator_methods[] =
+{
+    { "add", GMPy_MPFR_Accumulator_Add, METH_O, GMPy_doc_mpfr_accumulator_add },
+    { "add_many", GMPy_MPFR_Accumulator_AddMany, METH_O, GMPy_doc_mpfr_accumulator_add_many },
+    { "reset", GMPy_MPFR_Accumulator_Reset, METH_NOARGS, GMPy_doc_mpfr_accumulator_reset },
+    { "value", GMPy_MPFR_Accumulator_Value, METH_NOARGS, GMPy_doc_mpfr_accumulator_value },
+    { NULL, NULL, 1 }
+};
+
+static PyGetSetDef GMPy_MPFR_Accumulator_getseters[] =
+{
+    { "count", (getter)GMPy_MPFR_Accumulator_GetCount, NULL, "number of values added", NULL },
+    { "precision", (getter)GMPy_MPFR_Accumulator_GetPrec, NULL, "precision in bits of value()", NULL },
+    { NULL }
+};
+
+static PyTypeObject MPFR_Accumulator_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.mpfr_accumulator",
+    .tp_basicsize = sizeof(MPFR_Accumulator_Object),
+    .tp_dealloc = (destructor) GMPy_MPFR_Accumulator_Dealloc,
+    .tp_repr = (reprfunc) GMPy_MPFR_Accumulator_Repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_mpfr_accumulator,
+    .tp_methods = GMPy_MPFR_Accumulator_methods,
+    .tp_getset = GMPy_MPFR_Accumulator_getseters,
+    .tp_new = GMPy_MPFR_Accumulator_NewInit,
+};
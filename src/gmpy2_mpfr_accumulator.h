@@ -0,0 +1,63 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpfr_accumulator.h                                                *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPFR_ACCUMULATOR_H
+#define GMPY_MPFR_ACCUMULATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An mpfr_accumulator keeps the exact sum of all the values added to it in
+ * a single mpfr_t. The precision of the sum is grown just enough for each
+ * addition to be exact and is trimmed back to the bits actually in use
+ * afterwards, so the memory used depends on the exponent range of the
+ * values but not on how many were added. The sum is rounded only when the
+ * value is requested.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    mpfr_t sum;                      /* exact running sum */
+    mpfr_prec_t prec;                /* precision of value() */
+    unsigned long long count;        /* number of values added */
+} MPFR_Accumulator_Object;
+
+static PyTypeObject MPFR_Accumulator_Type;
+#define MPFR_Accumulator_Check(v) (((PyObject*)v)->ob_type == &MPFR_Accumulator_Type)
+
+static PyObject * GMPy_MPFR_Accumulator_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs);
+static void       GMPy_MPFR_Accumulator_Dealloc(MPFR_Accumulator_Object *self);
+static PyObject * GMPy_MPFR_Accumulator_Repr(MPFR_Accumulator_Object *self);
+static PyObject * GMPy_MPFR_Accumulator_Add(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPFR_Accumulator_AddMany(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPFR_Accumulator_Value(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPFR_Accumulator_Reset(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPFR_Accumulator_GetPrec(MPFR_Accumulator_Object *self, void *closure);
+static PyObject * GMPy_MPFR_Accumulator_GetCount(MPFR_Accumulator_Object *self, void *closure);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
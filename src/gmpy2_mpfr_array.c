@@ -0,0 +1,917 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpfr_array.c                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Arithmetic on mpfr_array objects is done at the precision of the result
+ * array using the rounding mode of the current context. The exponent range
+ * and subnormalization settings of the context are not applied to the
+ * elements, but the MPFR flags are recorded in the context and trapped as
+ * usual. Reductions return ordinary mpfr instances and follow the context
+ * exactly like the scalar functions.
+ */
+
+typedef int (*GMPy_array_mpfr1)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+typedef int (*GMPy_array_mpfr2)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+
+static MPFR_Array_Object *
+GMPy_MPFR_Array_New(Py_ssize_t size, mpfr_prec_t prec)
+{
+    MPFR_Array_Object *result;
+    size_t limbsize;
+    Py_ssize_t i;
+    char *p;
+
+    /* GMPy_MPFR_New() reads a precision of 1 as the precision of the
+     * context, so elements of that precision could not be returned.
+     */
+    if (prec < 2 || prec > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    if (size < 0) {
+        VALUE_ERROR("mpfr_array() requires a non-negative length");
+        return NULL;
+    }
+
+    limbsize = mpfr_custom_get_size(prec);
+    if ((size_t)size > (size_t)PY_SSIZE_T_MAX / limbsize) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(MPFR_Array_Object, &MPFR_Array_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    result->size = size;
+    result->step = 1;
+    result->prec = prec;
+    result->base = NULL;
+    result->heads = PyMem_Malloc(Py_MAX(size, 1) * sizeof(__mpfr_struct));
+    result->limbs = PyMem_Malloc(Py_MAX(size, 1) * limbsize);
+    result->data = result->heads;
+
+    if (!result->heads || !result->limbs) {
+        /* LCOV_EXCL_START */
+        Py_DECREF((PyObject*)result);
+        PyErr_NoMemory();
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0, p = result->limbs; i < size; i++, p += limbsize) {
+        mpfr_custom_init(p, prec);
+        mpfr_custom_init_set(&result->heads[i], MPFR_ZERO_KIND, 0, prec, p);
+    }
+    return result;
+}
+
+static void
+GMPy_MPFR_Array_Dealloc(MPFR_Array_Object *self)
+{
+    if (self->base) {
+        Py_DECREF(self->base);
+    }
+    else {
+        PyMem_Free(self->heads);
+        PyMem_Free(self->limbs);
+    }
+    PyObject_Free(self);
+}
+
+/* Return a view of 'size' elements of self, starting at element 'start'
+ * and taking every 'step'-th element.
+ */
+
+static MPFR_Array_Object *
+GMPy_MPFR_Array_View(MPFR_Array_Object *self, Py_ssize_t start,
+                     Py_ssize_t step, Py_ssize_t size)
+{
+    MPFR_Array_Object *result;
+
+    if (!(result = PyObject_New(MPFR_Array_Object, &MPFR_Array_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    result->size = size;
+    result->step = self->step * step;
+    result->prec = self->prec;
+    result->data = size ? MPFR_ARRAY_ELEM(self, start) : self->data;
+    result->heads = NULL;
+    result->limbs = NULL;
+    result->base = self->base ? self->base : (PyObject*)self;
+    Py_INCREF(result->base);
+    return result;
+}
+
+#define MPFR_ARRAY_OWNER(a) ((a)->base ? (a)->base : (PyObject*)(a))
+
+/* Record the MPFR flags raised by an array operation in the context and
+ * raise the exception for the first trapped flag. Returns -1 if an
+ * exception was raised.
+ */
+
+static int
+GMPy_MPFR_Array_Flags(CTXT_Object *context)
+{
+    context->ctx.underflow |= mpfr_underflow_p();
+    context->ctx.overflow |= mpfr_overflow_p();
+    context->ctx.invalid |= mpfr_nanflag_p();
+    context->ctx.inexact |= mpfr_inexflag_p();
+    context->ctx.divzero |= mpfr_divby0_p();
+    if (context->ctx.traps) {
+        if ((context->ctx.traps & TRAP_UNDERFLOW) && mpfr_underflow_p()) {
+            PyErr_SetString(GMPyExc_Underflow, "underflow");
+            return -1;
+        }
+        if ((context->ctx.traps & TRAP_OVERFLOW) && mpfr_overflow_p()) {
+            PyErr_SetString(GMPyExc_Overflow, "overflow");
+            return -1;
+        }
+        if ((context->ctx.traps & TRAP_INEXACT) && mpfr_inexflag_p()) {
+            PyErr_SetString(GMPyExc_Inexact, "inexact result");
+            return -1;
+        }
+        if ((context->ctx.traps & TRAP_INVALID) && mpfr_nanflag_p()) {
+            PyErr_SetString(GMPyExc_Invalid, "invalid operation");
+            return -1;
+        }
+        if ((context->ctx.traps & TRAP_DIVZERO) && mpfr_divby0_p()) {
+            PyErr_SetString(GMPyExc_DivZero, "division by zero");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Round a real number into an element. Returns -1 and sets TypeError if
+ * obj is not a real number.
+ */
+
+static int
+GMPy_MPFR_Array_SetElem(mpfr_ptr elem, PyObject *obj, CTXT_Object *context)
+{
+    MPFR_Object *temp;
+    int xtype = GMPy_ObjectType(obj);
+
+    if (!IS_TYPE_REAL(xtype)) {
+        TYPE_ERROR("mpfr_array elements must be real numbers");
+        return -1;
+    }
+
+    if (!(temp = GMPy_MPFR_From_RealWithType(obj, xtype, 1, context))) {
+        return -1;
+    }
+
+    mpfr_set(elem, temp->f, GET_MPFR_ROUND(context));
+    Py_DECREF((PyObject*)temp);
+    return 0;
+}
+
+/* Read a one-dimensional buffer of C doubles, such as a NumPy float64
+ * array or array.array('d'). Returns 0 if obj does not export a buffer.
+ */
+
+static int
+GMPy_MPFR_Array_FromBuffer(PyObject *obj, mpfr_prec_t prec,
+                           MPFR_Array_Object **result)
+{
+    Py_buffer view;
+    const char *fmt;
+    Py_ssize_t i;
+
+    if (!PyObject_CheckBuffer(obj)) {
+        return 0;
+    }
+
+    if (PyObject_GetBuffer(obj, &view, PyBUF_RECORDS_RO) < 0) {
+        return -1;
+    }
+
+    fmt = view.format ? view.format : "B";
+    if (*fmt == '<' || *fmt == '=' || *fmt == '@') {
+        fmt++;
+    }
+
+    if (view.ndim != 1 || strcmp(fmt, "d") || view.itemsize != sizeof(double)) {
+        PyBuffer_Release(&view);
+        TYPE_ERROR("mpfr_array() requires a one-dimensional buffer of doubles");
+        return -1;
+    }
+
+    if ((*result = GMPy_MPFR_Array_New(view.shape[0], prec))) {
+        for (i = 0; i < view.shape[0]; i++) {
+            double d;
+
+            memcpy(&d, (char*)view.buf + i * view.strides[0], sizeof(double));
+            mpfr_set_d(MPFR_ARRAY_ELEM(*result, i), d, MPFR_RNDN);
+        }
+    }
+
+    PyBuffer_Release(&view);
+    return *result ? 1 : -1;
+}
+
+/* Convert an mpfr_array, a buffer of doubles or an iterable of real
+ * numbers to a new mpfr_array with the given precision.
+ */
+
+static MPFR_Array_Object *
+GMPy_MPFR_Array_From_Object(PyObject *obj, mpfr_prec_t prec, CTXT_Object *context)
+{
+    MPFR_Array_Object *result = NULL;
+    PyObject *seq;
+    Py_ssize_t i, size;
+    int res;
+
+    CHECK_CONTEXT(context);
+
+    if (prec == 0) {
+        prec = GET_MPFR_PREC(context);
+    }
+
+    if (MPFR_Array_Check(obj)) {
+        MPFR_Array_Object *other = (MPFR_Array_Object*)obj;
+
+        if ((result = GMPy_MPFR_Array_New(other->size, prec))) {
+            mpfr_clear_flags();
+            for (i = 0; i < other->size; i++) {
+                mpfr_set(MPFR_ARRAY_ELEM(result, i), MPFR_ARRAY_ELEM(other, i),
+                         GET_MPFR_ROUND(context));
+            }
+            if (GMPy_MPFR_Array_Flags(context) < 0) {
+                Py_CLEAR(result);
+            }
+        }
+        return result;
+    }
+
+    if ((res = GMPy_MPFR_Array_FromBuffer(obj, prec, &result))) {
+        return res < 0 ? NULL : result;
+    }
+
+    if (!(seq = PySequence_Fast(obj, "mpfr_array() requires a length or an iterable"))) {
+        return NULL;
+    }
+
+    size = PySequence_Fast_GET_SIZE(seq);
+    if ((result = GMPy_MPFR_Array_New(size, prec))) {
+        mpfr_clear_flags();
+        for (i = 0; i < size; i++) {
+            if (GMPy_MPFR_Array_SetElem(MPFR_ARRAY_ELEM(result, i),
+                                        PySequence_Fast_GET_ITEM(seq, i),
+                                        context) < 0) {
+                Py_CLEAR(result);
+                break;
+            }
+        }
+        if (result && GMPy_MPFR_Array_Flags(context) < 0) {
+            Py_CLEAR(result);
+        }
+    }
+
+    Py_DECREF(seq);
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array,
+"mpfr_array(n=0, /, precision=0)\n"
+"mpfr_array(iterable, /, precision=0)\n\n"
+"Return an array of n floating-point numbers initialized to zero, or an\n"
+"array containing the values of iterable. All the elements have the same\n"
+"precision, which must be at least 2; if precision is 0, the precision\n"
+"of the current context is used. iterable may also be a one-dimensional\n"
+"NumPy float64 array or any other buffer of C doubles.\n\n"
+"The significands of all the elements are stored in one contiguous block\n"
+"of memory. Arrays support len(), indexing, slicing (which returns a view\n"
+"sharing the same storage) and the elementwise operators +, -, * and /\n"
+"with another array of the same length or a real number.");
+
+static PyObject *
+GMPy_MPFR_Array_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"", "precision", NULL};
+    PyObject *arg0 = NULL;
+    long prec = 0;
+    Py_ssize_t size;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Ol", kwlist, &arg0, &prec)) {
+        return NULL;
+    }
+
+    if (prec == 0) {
+        prec = GET_MPFR_PREC(context);
+    }
+
+    if (!arg0) {
+        return (PyObject*)GMPy_MPFR_Array_New(0, (mpfr_prec_t)prec);
+    }
+
+    if (PyIndex_Check(arg0) && !MPFR_Array_Check(arg0)) {
+        size = PyNumber_AsSsize_t(arg0, PyExc_OverflowError);
+        if (size == -1 && PyErr_Occurred()) {
+            return NULL;
+        }
+        return (PyObject*)GMPy_MPFR_Array_New(size, (mpfr_prec_t)prec);
+    }
+
+    return (PyObject*)GMPy_MPFR_Array_From_Object(arg0, (mpfr_prec_t)prec, context);
+}
+
+static PyObject *
+GMPy_MPFR_Array_ToList(PyObject *self, PyObject *args)
+{
+    MPFR_Array_Object *arr = (MPFR_Array_Object*)self;
+    PyObject *result, *temp;
+    Py_ssize_t i;
+
+    if (!(result = PyList_New(arr->size))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < arr->size; i++) {
+        if (!(temp = GMPy_MPFR_Array_Item(arr, i))) {
+            /* LCOV_EXCL_START */
+            Py_DECREF(result);
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+        PyList_SET_ITEM(result, i, temp);
+    }
+    return result;
+}
+
+static PyObject *
+GMPy_MPFR_Array_Repr(MPFR_Array_Object *self)
+{
+    PyObject *lst, *result;
+
+    if (!(lst = GMPy_MPFR_Array_ToList((PyObject*)self, NULL))) {
+        return NULL;
+    }
+    result = PyUnicode_FromFormat("mpfr_array(%R, precision=%ld)",
+                                  lst, (long)self->prec);
+    Py_DECREF(lst);
+    return result;
+}
+
+static Py_ssize_t
+GMPy_MPFR_Array_Length(MPFR_Array_Object *self)
+{
+    return self->size;
+}
+
+static PyObject *
+GMPy_MPFR_Array_Item(MPFR_Array_Object *self, Py_ssize_t i)
+{
+    MPFR_Object *result;
+
+    if (i < 0 || i >= self->size) {
+        PyErr_SetString(PyExc_IndexError, "mpfr_array index out of range");
+        return NULL;
+    }
+
+    if ((result = GMPy_MPFR_New(self->prec, NULL))) {
+        mpfr_set(result->f, MPFR_ARRAY_ELEM(self, i), MPFR_RNDN);
+    }
+    return (PyObject*)result;
+}
+
+static PyObject *
+GMPy_MPFR_Array_Subscript(MPFR_Array_Object *self, PyObject *key)
+{
+    Py_ssize_t i, start, stop, step, size;
+
+    if (PyIndex_Check(key)) {
+        if ((i = PyNumber_AsSsize_t(key, PyExc_IndexError)) == -1 &&
+            PyErr_Occurred()) {
+            return NULL;
+        }
+        if (i < 0) {
+            i += self->size;
+        }
+        return GMPy_MPFR_Array_Item(self, i);
+    }
+
+    if (PySlice_Check(key)) {
+        if (PySlice_Unpack(key, &start, &stop, &step) < 0) {
+            return NULL;
+        }
+        size = PySlice_AdjustIndices(self->size, &start, &stop, step);
+        return (PyObject*)GMPy_MPFR_Array_View(self, start, step, size);
+    }
+
+    TYPE_ERROR("mpfr_array indices must be integers or slices");
+    return NULL;
+}
+
+static int
+GMPy_MPFR_Array_AssSubscript(MPFR_Array_Object *self, PyObject *key, PyObject *value)
+{
+    MPFR_Array_Object *dest, *src = NULL;
+    Py_ssize_t i;
+    int res = -1;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT_M1(context);
+
+    if (!value) {
+        TYPE_ERROR("mpfr_array elements cannot be deleted");
+        return -1;
+    }
+
+    if (PyIndex_Check(key)) {
+        if ((i = PyNumber_AsSsize_t(key, PyExc_IndexError)) == -1 &&
+            PyErr_Occurred()) {
+            return -1;
+        }
+        if (i < 0) {
+            i += self->size;
+        }
+        if (i < 0 || i >= self->size) {
+            PyErr_SetString(PyExc_IndexError, "mpfr_array assignment index out of range");
+            return -1;
+        }
+        mpfr_clear_flags();
+        if (GMPy_MPFR_Array_SetElem(MPFR_ARRAY_ELEM(self, i), value, context) < 0) {
+            return -1;
+        }
+        return GMPy_MPFR_Array_Flags(context);
+    }
+
+    if (!(dest = (MPFR_Array_Object*)GMPy_MPFR_Array_Subscript(self, key))) {
+        return -1;
+    }
+
+    mpfr_clear_flags();
+
+    if (IS_TYPE_REAL(GMPy_ObjectType(value))) {
+        /* Assign a single number to every element of the slice. */
+
+        if (dest->size > 0) {
+            if (GMPy_MPFR_Array_SetElem(MPFR_ARRAY_ELEM(dest, 0), value, context) < 0) {
+                goto cleanup;
+            }
+            for (i = 1; i < dest->size; i++) {
+                mpfr_set(MPFR_ARRAY_ELEM(dest, i), MPFR_ARRAY_ELEM(dest, 0), MPFR_RNDN);
+            }
+        }
+    }
+    else {
+        /* Always convert to a temporary array first so the source may
+         * overlap the destination.
+         */
+
+        if (!(src = GMPy_MPFR_Array_From_Object(value, self->prec, context))) {
+            goto cleanup;
+        }
+        if (src->size != dest->size) {
+            VALUE_ERROR("mpfr_array slice assignment requires the same length");
+            goto cleanup;
+        }
+        for (i = 0; i < dest->size; i++) {
+            mpfr_set(MPFR_ARRAY_ELEM(dest, i), MPFR_ARRAY_ELEM(src, i), MPFR_RNDN);
+        }
+    }
+
+    res = GMPy_MPFR_Array_Flags(context);
+
+  cleanup:
+    Py_DECREF((PyObject*)dest);
+    Py_XDECREF((PyObject*)src);
+    return res;
+}
+
+/* Apply a binary MPFR function elementwise. Either x or y may be a real
+ * number instead of an array. If inplace is nonzero, the result is stored
+ * in x, which must be an array.
+ */
+
+static PyObject *
+GMPy_MPFR_Array_Binop(PyObject *x, PyObject *y, GMPy_array_mpfr2 func, int inplace)
+{
+    MPFR_Array_Object *xa = NULL, *ya = NULL, *ycopy = NULL, *result = NULL;
+    MPFR_Object *xs = NULL, *ys = NULL;
+    mpfr_prec_t prec = 0;
+    Py_ssize_t i, size = 0;
+    int xtype = GMPy_ObjectType(x), ytype = GMPy_ObjectType(y);
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (MPFR_Array_Check(x)) {
+        xa = (MPFR_Array_Object*)x;
+        prec = xa->prec;
+        size = xa->size;
+    }
+    else if (IS_TYPE_REAL(xtype)) {
+        if (!(xs = GMPy_MPFR_From_RealWithType(x, xtype, 1, context))) {
+            return NULL;
+        }
+    }
+    else {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    if (MPFR_Array_Check(y)) {
+        ya = (MPFR_Array_Object*)y;
+        if (xa && xa->size != ya->size) {
+            VALUE_ERROR("mpfr_array operands must have the same length");
+            goto cleanup;
+        }
+        prec = Py_MAX(prec, ya->prec);
+        size = ya->size;
+    }
+    else if (IS_TYPE_REAL(ytype)) {
+        if (!(ys = GMPy_MPFR_From_RealWithType(y, ytype, 1, context))) {
+            goto cleanup;
+        }
+    }
+    else {
+        Py_XDECREF((PyObject*)xs);
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    if (inplace) {
+        /* Elements of y that overlap x must be read before x changes. */
+
+        if (ya && MPFR_ARRAY_OWNER(ya) == MPFR_ARRAY_OWNER(xa)) {
+            if (!(ycopy = GMPy_MPFR_Array_From_Object(y, ya->prec, context))) {
+                goto cleanup;
+            }
+            ya = ycopy;
+        }
+        Py_INCREF(x);
+        result = xa;
+    }
+    else if (!(result = GMPy_MPFR_Array_New(size, prec))) {
+        goto cleanup;
+    }
+
+    mpfr_clear_flags();
+    for (i = 0; i < size; i++) {
+        func(MPFR_ARRAY_ELEM(result, i),
+             xa ? MPFR_ARRAY_ELEM(xa, i) : xs->f,
+             ya ? MPFR_ARRAY_ELEM(ya, i) : ys->f,
+             GET_MPFR_ROUND(context));
+    }
+
+    if (GMPy_MPFR_Array_Flags(context) < 0) {
+        Py_CLEAR(result);
+    }
+
+  cleanup:
+    Py_XDECREF((PyObject*)xs);
+    Py_XDECREF((PyObject*)ys);
+    Py_XDECREF((PyObject*)ycopy);
+    return (PyObject*)result;
+}
+
+#define GMPY_MPFR_ARRAY_BINOP(NAME, FUNC) \
+static PyObject * \
+GMPy_MPFR_Array_##NAME(PyObject *x, PyObject *y) \
+{ \
+    return GMPy_MPFR_Array_Binop(x, y, FUNC, 0); \
+} \
+static PyObject * \
+GMPy_MPFR_Array_Inplace##NAME(PyObject *x, PyObject *y) \
+{ \
+    return GMPy_MPFR_Array_Binop(x, y, FUNC, 1); \
+}
+
+GMPY_MPFR_ARRAY_BINOP(Add, mpfr_add)
+GMPY_MPFR_ARRAY_BINOP(Sub, mpfr_sub)
+GMPY_MPFR_ARRAY_BINOP(Mul, mpfr_mul)
+GMPY_MPFR_ARRAY_BINOP(Div, mpfr_div)
+
+static PyObject *
+GMPy_MPFR_Array_Unop(PyObject *x, GMPy_array_mpfr1 func)
+{
+    MPFR_Array_Object *xa = (MPFR_Array_Object*)x, *result;
+    Py_ssize_t i;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if ((result = GMPy_MPFR_Array_New(xa->size, xa->prec))) {
+        mpfr_clear_flags();
+        for (i = 0; i < xa->size; i++) {
+            func(MPFR_ARRAY_ELEM(result, i), MPFR_ARRAY_ELEM(xa, i),
+                 GET_MPFR_ROUND(context));
+        }
+        if (GMPy_MPFR_Array_Flags(context) < 0) {
+            Py_CLEAR(result);
+        }
+    }
+    return (PyObject*)result;
+}
+
+static PyObject *
+GMPy_MPFR_Array_Neg(PyObject *x)
+{
+    return GMPy_MPFR_Array_Unop(x, mpfr_neg);
+}
+
+static PyObject *
+GMPy_MPFR_Array_Pos(PyObject *x)
+{
+    return GMPy_MPFR_Array_Unop(x, mpfr_set);
+}
+
+static PyObject *
+GMPy_MPFR_Array_Abs(PyObject *x)
+{
+    return GMPy_MPFR_Array_Unop(x, mpfr_abs);
+}
+
+/* Return a table of pointers to the elements of an array, as required by
+ * mpfr_sum() and mpfr_dot().
+ */
+
+static mpfr_ptr *
+GMPy_MPFR_Array_Ptrs(MPFR_Array_Object *self)
+{
+    mpfr_ptr *result;
+    Py_ssize_t i;
+
+    if (!(result = PyMem_Malloc(Py_MAX(self->size, 1) * sizeof(mpfr_ptr)))) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (i = 0; i < self->size; i++) {
+        result[i] = MPFR_ARRAY_ELEM(self, i);
+    }
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_tolist,
+"x.tolist() -> list\n\n"
+"Return the elements of x as a list of mpfr instances.");
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_copy,
+"x.copy() -> mpfr_array\n\n"
+"Return a new array with a copy of the elements of x.");
+
+static PyObject *
+GMPy_MPFR_Array_Copy(PyObject *self, PyObject *args)
+{
+    return (PyObject*)GMPy_MPFR_Array_From_Object(self,
+                                                  ((MPFR_Array_Object*)self)->prec,
+                                                  NULL);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_sum,
+"x.sum() -> mpfr\n\n"
+"Return the correctly rounded sum of the elements of x.");
+
+static PyObject *
+GMPy_MPFR_Array_Sum(PyObject *self, PyObject *args)
+{
+    MPFR_Object *result;
+    mpfr_ptr *tab;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!(tab = GMPy_MPFR_Array_Ptrs((MPFR_Array_Object*)self))) {
+        return NULL;
+    }
+
+    if ((result = GMPy_MPFR_New(0, context))) {
+        mpfr_clear_flags();
+        result->rc = mpfr_sum(result->f, tab,
+                              (unsigned long)((MPFR_Array_Object*)self)->size,
+                              GET_MPFR_ROUND(context));
+        _GMPy_MPFR_Cleanup(&result, context);
+    }
+
+    PyMem_Free(tab);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_dot,
+"x.dot(y, /) -> mpfr\n\n"
+"Return the correctly rounded sum of x[i]*y[i]. y must have the same\n"
+"length as x. If y is not an mpfr_array, it is first converted to one\n"
+"with the precision of x.");
+
+static PyObject *
+GMPy_MPFR_Array_Dot(PyObject *self, PyObject *other)
+{
+    MPFR_Array_Object *x = (MPFR_Array_Object*)self, *y;
+    MPFR_Object *result = NULL;
+    mpfr_ptr *xtab = NULL, *ytab = NULL;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (MPFR_Array_Check(other)) {
+        Py_INCREF(other);
+        y = (MPFR_Array_Object*)other;
+    }
+    else if (!(y = GMPy_MPFR_Array_From_Object(other, x->prec, context))) {
+        return NULL;
+    }
+
+    if (x->size != y->size) {
+        VALUE_ERROR("dot() requires arrays of the same length");
+        goto cleanup;
+    }
+
+    if (!(xtab = GMPy_MPFR_Array_Ptrs(x)) || !(ytab = GMPy_MPFR_Array_Ptrs(y))) {
+        goto cleanup;
+    }
+
+    if ((result = GMPy_MPFR_New(0, context))) {
+        mpfr_clear_flags();
+        result->rc = mpfr_dot(result->f, xtab, ytab, (unsigned long)x->size,
+                              GET_MPFR_ROUND(context));
+        _GMPy_MPFR_Cleanup(&result, context);
+    }
+
+  cleanup:
+    PyMem_Free(xtab);
+    PyMem_Free(ytab);
+    Py_DECREF((PyObject*)y);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_norm,
+"x.norm() -> mpfr\n\n"
+"Return the Euclidean norm of x. The sum of squares is rounded to 64\n"
+"extra bits before the square root is taken.");
+
+static PyObject *
+GMPy_MPFR_Array_Norm(PyObject *self, PyObject *args)
+{
+    MPFR_Array_Object *x = (MPFR_Array_Object*)self;
+    MPFR_Object *result;
+    mpfr_ptr *tab;
+    mpfr_t temp;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!(tab = GMPy_MPFR_Array_Ptrs(x))) {
+        return NULL;
+    }
+
+    if ((result = GMPy_MPFR_New(0, context))) {
+        mpfr_init2(temp, mpfr_get_prec(result->f) + 64);
+        mpfr_clear_flags();
+        mpfr_dot(temp, tab, tab, (unsigned long)x->size, MPFR_RNDN);
+        result->rc = mpfr_sqrt(result->f, temp, GET_MPFR_ROUND(context));
+        mpfr_clear(temp);
+        _GMPy_MPFR_Cleanup(&result, context);
+    }
+
+    PyMem_Free(tab);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_array_array,
+"x.__array__(dtype=None, copy=None) -> numpy.ndarray\n\n"
+"Return the elements of x as a NumPy float64 array, or as an array of\n"
+"type dtype if given.");
+
+static PyObject *
+GMPy_MPFR_Array_Array(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"dtype", "copy", NULL};
+    MPFR_Array_Object *x = (MPFR_Array_Object*)self;
+    PyObject *dtype = Py_None, *copy = Py_None, *mod, *result, *temp;
+    Py_buffer view;
+    Py_ssize_t i;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", kwlist, &dtype, &copy)) {
+        return NULL;
+    }
+
+    if (!(mod = PyImport_ImportModule("numpy"))) {
+        return NULL;
+    }
+
+    result = PyObject_CallMethod(mod, "empty", "ns", x->size, "float64");
+    Py_DECREF(mod);
+    if (!result) {
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(result, &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    for (i = 0; i < x->size; i++) {
+        ((double*)view.buf)[i] = mpfr_get_d(MPFR_ARRAY_ELEM(x, i),
+                                            GET_MPFR_ROUND(context));
+    }
+    PyBuffer_Release(&view);
+
+    if (dtype != Py_None) {
+        temp = PyObject_CallMethod(result, "astype", "O", dtype);
+        Py_DECREF(result);
+        result = temp;
+    }
+    return result;
+}
+
+static PyObject *
+GMPy_MPFR_Array_GetPrec(MPFR_Array_Object *self, void *closure)
+{
+    return PyLong_FromSsize_t((Py_ssize_t)self->prec);
+}
+
+static PyMethodDef GMPy_MPFR_Array_methods[] =
+{
+    { "__array__", (PyCFunction)GMPy_MPFR_Array_Array, METH_VARARGS | METH_KEYWORDS, GMPy_doc_mpfr_array_array },
+    { "copy", GMPy_MPFR_Array_Copy, METH_NOARGS, GMPy_doc_mpfr_array_copy },
+    { "dot", GMPy_MPFR_Array_Dot, METH_O, GMPy_doc_mpfr_array_dot },
+    { "norm", GMPy_MPFR_Array_Norm, METH_NOARGS, GMPy_doc_mpfr_array_norm },
+    { "sum", GMPy_MPFR_Array_Sum, METH_NOARGS, GMPy_doc_mpfr_array_sum },
+    { "tolist", GMPy_MPFR_Array_ToList, METH_NOARGS, GMPy_doc_mpfr_array_tolist },
+    { NULL, NULL, 1 }
+};
+
+static PyGetSetDef GMPy_MPFR_Array_getseters[] =
+{
+    { "precision", (getter)GMPy_MPFR_Array_GetPrec, NULL, "precision in bits of the elements", NULL },
+    { NULL }
+};
+
+static PyNumberMethods GMPy_MPFR_Array_as_number =
+{
+    .nb_add = GMPy_MPFR_Array_Add,
+    .nb_subtract = GMPy_MPFR_Array_Sub,
+    .nb_multiply = GMPy_MPFR_Array_Mul,
+    .nb_true_divide = GMPy_MPFR_Array_Div,
+    .nb_inplace_add = GMPy_MPFR_Array_InplaceAdd,
+    .nb_inplace_subtract = GMPy_MPFR_Array_InplaceSub,
+    .nb_inplace_multiply = GMPy_MPFR_Array_InplaceMul,
+    .nb_inplace_true_divide = GMPy_MPFR_Array_InplaceDiv,
+    .nb_negative = GMPy_MPFR_Array_Neg,
+    .nb_positive = GMPy_MPFR_Array_Pos,
+    .nb_absolute = GMPy_MPFR_Array_Abs,
+};
+
+static PySequenceMethods GMPy_MPFR_Array_as_sequence =
+{
+    .sq_length = (lenfunc) GMPy_MPFR_Array_Length,
+    .sq_item = (ssizeargfunc) GMPy_MPFR_Array_Item,
+};
+
+static PyMappingMethods GMPy_MPFR_Array_as_mapping =
+{
+    .mp_length = (lenfunc) GMPy_MPFR_Array_Length,
+    .mp_subscript = (binaryfunc) GMPy_MPFR_Array_Subscript,
+    .mp_ass_subscript = (objobjargproc) GMPy_MPFR_Array_AssSubscript,
+};
+
+static PyTypeObject MPFR_Array_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.mpfr_array",
+    .tp_basicsize = sizeof(MPFR_Array_Object),
+    .tp_dealloc = (destructor) GMPy_MPFR_Array_Dealloc,
+    .tp_repr = (reprfunc) GMPy_MPFR_Array_Repr,
+    .tp_as_number = &GMPy_MPFR_Array_as_number,
+    .tp_as_sequence = &GMPy_MPFR_Array_as_sequence,
+    .tp_as_mapping = &GMPy_MPFR_Array_as_mapping,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_mpfr_array,
+    .tp_methods = GMPy_MPFR_Array_methods,
+    .tp_getset = GMPy_MPFR_Array_getseters,
+    .tp_new = GMPy_MPFR_Array_NewInit,
+};
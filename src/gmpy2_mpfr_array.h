@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpfr_array.h                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPFR_ARRAY_H
+#define GMPY_MPFR_ARRAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An mpfr_array stores a fixed number of mpfr_t values that share a single
+ * precision. The significands of all the elements are allocated in one
+ * contiguous arena using MPFR's custom interface, and the mpfr_t headers
+ * are stored in a second array. Since the significands cannot be
+ * reallocated, the precision of the elements can never change.
+ *
+ * A slice of an mpfr_array is a view that shares the storage of the array
+ * it was taken from. Element i of any array is data[i * step]; base is
+ * NULL for an array that owns its storage and refers to the owner for a
+ * view.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t size;                 /* number of elements */
+    Py_ssize_t step;                 /* distance between elements */
+    mpfr_prec_t prec;                /* precision of every element */
+    __mpfr_struct *data;             /* first element */
+    __mpfr_struct *heads;            /* owned mpfr_t headers */
+    void *limbs;                     /* owned significands */
+    PyObject *base;                  /* owner of the storage for views */
+} MPFR_Array_Object;
+
+static PyTypeObject MPFR_Array_Type;
+#define MPFR_Array_Check(v) (((PyObject*)v)->ob_type == &MPFR_Array_Type)
+
+#define MPFR_ARRAY_ELEM(a, i) (&((a)->data[(i) * (a)->step]))
+
+static MPFR_Array_Object * GMPy_MPFR_Array_New(Py_ssize_t size, mpfr_prec_t prec);
+static MPFR_Array_Object * GMPy_MPFR_Array_From_Object(PyObject *obj, mpfr_prec_t prec, CTXT_Object *context);
+static int                 GMPy_MPFR_Array_Flags(CTXT_Object *context);
+static PyObject *          GMPy_MPFR_Array_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs);
+static void                GMPy_MPFR_Array_Dealloc(MPFR_Array_Object *self);
+static PyObject *          GMPy_MPFR_Array_Repr(MPFR_Array_Object *self);
+static Py_ssize_t          GMPy_MPFR_Array_Length(MPFR_Array_Object *self);
+static PyObject *          GMPy_MPFR_Array_Item(MPFR_Array_Object *self, Py_ssize_t i);
+static PyObject *          GMPy_MPFR_Array_Subscript(MPFR_Array_Object *self, PyObject *key);
+static int                 GMPy_MPFR_Array_AssSubscript(MPFR_Array_Object *self, PyObject *key, PyObject *value);
+static PyObject *          GMPy_MPFR_Array_ToList(PyObject *self, PyObject *args);
+static PyObject *          GMPy_MPFR_Array_Copy(PyObject *self, PyObject *args);
+static PyObject *          GMPy_MPFR_Array_Sum(PyObject *self, PyObject *args);
+static PyObject *          GMPy_MPFR_Array_Dot(PyObject *self, PyObject *other);
+static PyObject *          GMPy_MPFR_Array_Norm(PyObject *self, PyObject *args);
+static PyObject *          GMPy_MPFR_Array_Array(PyObject *self, PyObject *args, PyObject *kwargs);
+static PyObject *          GMPy_MPFR_Array_GetPrec(MPFR_Array_Object *self, void *closure);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -101,11 +101,15 @@ GMPy_Context_F2Q(PyObject *self, PyObject *args)
 
 PyDoc_STRVAR(GMPy_doc_mpfr_free_cache,
 "free_cache() -> None\n\n"
-"Free the internal cache of constants maintained by MPFR.");
+"Free the internal cache of constants maintained by MPFR, and the cache\n"
+"of constants and the table of small primes kept by gmpy2 for the current\n"
+"thread.");
 
 static PyObject *
 GMPy_MPFR_Free_Cache(PyObject *self, PyObject *args)
 {
+    GMPy_Const_Free_Cache();
+    GMPy_Primes_Free_Cache();
     mpfr_free_cache();
     Py_RETURN_NONE;
 }
@@ -153,6 +157,636 @@ GMPy_MPFR_Can_Round(PyObject *self, PyObject *args)
         Py_RETURN_FALSE;
 }
 
+/* evaluate_to() evaluates a built-in function, or a tree of built-in
+ * functions, to a correctly rounded result. The expression is parsed once
+ * into an array of nodes in post-order, so the last node is the root. The
+ * nodes are then evaluated at increasing working precisions, without the
+ * GIL, until the result can be rounded to the target precision.
+ *
+ * Every node holds an interval [lo, hi] that is guaranteed to contain its
+ * exact value: lo is computed rounding down and hi rounding up, over the
+ * operand intervals as described by the range of the function (see
+ * gmpy2_vector.h). A leaf that is an mpq (or is converted to an mpq) is
+ * rounded down and up at each working precision; all other leaves are
+ * exact. A node that cannot be bounded is set to [-inf, +inf].
+ *
+ * The result is returned once both ends of the root interval round to the
+ * same number and lie strictly on the same side of it, or once the
+ * interval is a single point, i.e. every operation was exact. A NaN is a
+ * point, and an interval from the largest finite number to an infinity is
+ * an overflow; both are returned as a single operation would.
+ */
+
+typedef struct {
+    const GMPy_VecFunc *func;   /* NULL for a leaf */
+    Py_ssize_t arg[2];          /* operand nodes of a function */
+    PyObject *leaf;             /* mpfr or mpq value of a leaf */
+    mpfr_t lo, hi;              /* valid if func or the leaf is an mpq */
+} GMPy_EvalNode;
+
+typedef struct {
+    Py_ssize_t size;
+    Py_ssize_t alloc;
+    GMPy_EvalNode *node;
+    mpfr_t a, b, z;             /* scratch values */
+    const char *unbounded;      /* a function that could not be bounded */
+} GMPy_EvalTree;
+
+#define GMPY_EVAL_VALUED(nd) ((nd).func || MPQ_Check((nd).leaf))
+
+#define GMPY_EVAL_LO(t, i) \
+    (GMPY_EVAL_VALUED((t)->node[i]) ? \
+     (mpfr_srcptr)(t)->node[i].lo : (mpfr_srcptr)MPFR((t)->node[i].leaf))
+
+#define GMPY_EVAL_HI(t, i) \
+    (GMPY_EVAL_VALUED((t)->node[i]) ? \
+     (mpfr_srcptr)(t)->node[i].hi : (mpfr_srcptr)MPFR((t)->node[i].leaf))
+
+/* An interval that is a single number, or a NaN that is known exactly. */
+
+#define GMPY_EVAL_POINT(lo, hi) \
+    ((mpfr_nan_p(lo) && mpfr_nan_p(hi)) || mpfr_equal_p(lo, hi))
+
+/* evaluate_to() rounds ties to even, independent of the rounding mode. */
+
+static const GMPy_VecFunc GMPy_Eval_Rint =
+    { "rint", .mpfr1 = mpfr_rint_roundeven, .range = GMPY_RANGE_MONOTONE };
+
+static void
+GMPy_EvalTree_Clear(GMPy_EvalTree *t)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < t->size; i++) {
+        if (GMPY_EVAL_VALUED(t->node[i])) {
+            mpfr_clear(t->node[i].lo);
+            mpfr_clear(t->node[i].hi);
+        }
+        Py_XDECREF(t->node[i].leaf);
+    }
+    PyMem_Free(t->node);
+    t->size = t->alloc = 0;
+    t->node = NULL;
+}
+
+/* Append a node and return its index. A reference to leaf is stolen. */
+
+static Py_ssize_t
+GMPy_EvalTree_Append(GMPy_EvalTree *t, const GMPy_VecFunc *func,
+                     Py_ssize_t a, Py_ssize_t b, PyObject *leaf)
+{
+    GMPy_EvalNode *nd;
+
+    if (t->size == t->alloc) {
+        Py_ssize_t alloc = t->alloc ? 2 * t->alloc : 8;
+
+        if (!(nd = PyMem_Realloc(t->node, alloc * sizeof(GMPy_EvalNode)))) {
+            Py_XDECREF(leaf);
+            PyErr_NoMemory();
+            return -1;
+        }
+        t->node = nd;
+        t->alloc = alloc;
+    }
+
+    nd = &t->node[t->size];
+    nd->func = func;
+    nd->arg[0] = a;
+    nd->arg[1] = b;
+    nd->leaf = leaf;
+    if (GMPY_EVAL_VALUED(*nd)) {
+        mpfr_init2(nd->lo, MPFR_PREC_MIN);
+        mpfr_init2(nd->hi, MPFR_PREC_MIN);
+    }
+    return t->size++;
+}
+
+static Py_ssize_t
+GMPy_EvalTree_Parse(GMPy_EvalTree *t, PyObject *obj, CTXT_Object *context)
+{
+    const GMPy_VecFunc *f;
+    Py_ssize_t n, a[2] = {-1, -1}, i;
+    PyObject *leaf = NULL;
+    int xtype;
+
+    if (!PyTuple_Check(obj)) {
+        xtype = GMPy_ObjectType(obj);
+        if (IS_TYPE_MPFR(xtype)) {
+            Py_INCREF(obj);
+            leaf = obj;
+        }
+        else if (IS_TYPE_RATIONAL_ONLY(xtype)) {
+            leaf = (PyObject*)GMPy_MPQ_From_RationalWithType(obj, xtype, context);
+        }
+        else if (IS_TYPE_REAL(xtype)) {
+            leaf = (PyObject*)GMPy_MPFR_From_RealWithType(obj, xtype, 1, context);
+        }
+        else {
+            TYPE_ERROR("evaluate_to() arguments must be real numbers or expression tuples");
+            return -1;
+        }
+        if (!leaf) {
+            return -1;
+        }
+        return GMPy_EvalTree_Append(t, NULL, -1, -1, leaf);
+    }
+
+    n = PyTuple_GET_SIZE(obj) - 1;
+    if (n < 1 || n > 2) {
+        TYPE_ERROR("evaluate_to() expression must be a tuple (func, x) or (func, x, y)");
+        return -1;
+    }
+
+    if (!(f = GMPy_Vec_Lookup(PyTuple_GET_ITEM(obj, 0), "evaluate_to"))) {
+        return -1;
+    }
+
+    if (f->mpfr1 == mpfr_rint) {
+        f = &GMPy_Eval_Rint;
+    }
+
+    if (!f->mpfr1 && !f->mpfr2) {
+        PyErr_Format(PyExc_ValueError,
+                     "evaluate_to() does not support complex function '%s'", f->name);
+        return -1;
+    }
+
+    if ((f->mpfr1 && n != 1) || (f->mpfr2 && n != 2)) {
+        PyErr_Format(PyExc_TypeError, "evaluate_to() '%s' requires %d argument%s",
+                     f->name, f->mpfr1 ? 1 : 2, f->mpfr1 ? "" : "s");
+        return -1;
+    }
+
+    if (Py_EnterRecursiveCall(" in evaluate_to()")) {
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        if ((a[i] = GMPy_EvalTree_Parse(t, PyTuple_GET_ITEM(obj, i + 1), context)) < 0) {
+            break;
+        }
+    }
+    Py_LeaveRecursiveCall();
+
+    if (i < n) {
+        return -1;
+    }
+    return GMPy_EvalTree_Append(t, f, a[0], a[1], NULL);
+}
+
+/* Widen [nd->lo, nd->hi] to enclose the function of nd at (x, y), rounded
+ * down and up. first is set for the first point. Return 0 if the function
+ * is NaN at the point.
+ */
+
+static int
+GMPy_EvalTree_Merge(GMPy_EvalTree *t, GMPy_EvalNode *nd,
+                    mpfr_srcptr x, mpfr_srcptr y, int first)
+{
+    const GMPy_VecFunc *f = nd->func;
+
+    if (f->mpfr1) {
+        f->mpfr1(t->a, x, MPFR_RNDD);
+        f->mpfr1(t->b, x, MPFR_RNDU);
+    }
+    else {
+        f->mpfr2(t->a, x, y, MPFR_RNDD);
+        f->mpfr2(t->b, x, y, MPFR_RNDU);
+    }
+    if (mpfr_nan_p(t->a) || mpfr_nan_p(t->b)) {
+        return 0;
+    }
+    if (first || mpfr_less_p(t->a, nd->lo)) {
+        mpfr_set(nd->lo, t->a, MPFR_RNDD);
+    }
+    if (first || mpfr_greater_p(t->b, nd->hi)) {
+        mpfr_set(nd->hi, t->b, MPFR_RNDU);
+    }
+    return 1;
+}
+
+/* Set [nd->lo, nd->hi] to an interval that contains the function of nd
+ * over the intervals of its operands. Return 0 if no bound is known.
+ */
+
+static int
+GMPy_EvalTree_Node(GMPy_EvalTree *t, GMPy_EvalNode *nd)
+{
+    const GMPy_VecFunc *f = nd->func;
+    mpfr_srcptr x[2], y[2] = {NULL, NULL};
+    int range = f->range, xpoint, ypoint = 1, ok = 0, i, j;
+
+    x[0] = GMPY_EVAL_LO(t, nd->arg[0]);
+    x[1] = GMPY_EVAL_HI(t, nd->arg[0]);
+    xpoint = GMPY_EVAL_POINT(x[0], x[1]);
+    if (f->mpfr2) {
+        y[0] = GMPY_EVAL_LO(t, nd->arg[1]);
+        y[1] = GMPY_EVAL_HI(t, nd->arg[1]);
+        ypoint = GMPY_EVAL_POINT(y[0], y[1]);
+    }
+
+    /* A NaN operand is known exactly. If the function is NaN at both ends
+     * of the other operand, the result is taken to be NaN.
+     */
+    if (f->mpfr2 && !(xpoint && ypoint) &&
+        (mpfr_nan_p(x[0]) || mpfr_nan_p(y[0]))) {
+        for (i = 0; i < 2; i++) {
+            f->mpfr2(t->a, x[i], y[i], MPFR_RNDN);
+            if (!mpfr_nan_p(t->a)) {
+                break;
+            }
+        }
+        if (i == 2) {
+            mpfr_set_nan(nd->lo);
+            mpfr_set_nan(nd->hi);
+            return 1;
+        }
+    }
+
+    if (xpoint && ypoint) {
+        /* A single correctly rounded operation, rounded down and up. */
+        if (f->mpfr1) {
+            f->mpfr1(nd->lo, x[0], MPFR_RNDD);
+            f->mpfr1(nd->hi, x[1], MPFR_RNDU);
+        }
+        else {
+            f->mpfr2(nd->lo, x[0], y[0], MPFR_RNDD);
+            f->mpfr2(nd->hi, x[1], y[1], MPFR_RNDU);
+        }
+        if (mpfr_nan_p(nd->lo) || mpfr_nan_p(nd->hi)) {
+            mpfr_set_nan(nd->lo);
+            mpfr_set_nan(nd->hi);
+        }
+        return 1;
+    }
+
+    switch (GMPY_RANGE_KIND(range)) {
+    case GMPY_RANGE_MONOTONE:
+        ok = GMPy_EvalTree_Merge(t, nd, x[0], NULL, 1) &&
+             GMPy_EvalTree_Merge(t, nd, x[1], NULL, 0);
+        break;
+    case GMPY_RANGE_SPLIT0:
+        ok = GMPy_EvalTree_Merge(t, nd, x[0], NULL, 1) &&
+             GMPy_EvalTree_Merge(t, nd, x[1], NULL, 0);
+        if (ok && mpfr_sgn(x[0]) <= 0 && mpfr_sgn(x[1]) >= 0) {
+            mpfr_set_zero(t->z, -1);
+            ok = GMPy_EvalTree_Merge(t, nd, t->z, NULL, 0);
+            mpfr_set_zero(t->z, 1);
+            ok = ok && GMPy_EvalTree_Merge(t, nd, t->z, NULL, 0);
+        }
+        break;
+    case GMPY_RANGE_LIPSCHITZ:
+        /* f cannot move further than half the width of the interval
+         * from the smaller and the larger of its values at the ends.
+         */
+        ok = GMPy_EvalTree_Merge(t, nd, x[0], NULL, 1) &&
+             GMPy_EvalTree_Merge(t, nd, x[1], NULL, 0);
+        if (ok) {
+            mpfr_sub(t->a, x[1], x[0], MPFR_RNDU);
+            mpfr_div_2ui(t->a, t->a, 1, MPFR_RNDU);
+            mpfr_sub(nd->lo, nd->lo, t->a, MPFR_RNDD);
+            mpfr_add(nd->hi, nd->hi, t->a, MPFR_RNDU);
+            if (mpfr_cmp_si(nd->lo, -1) < 0) {
+                mpfr_set_si(nd->lo, -1, MPFR_RNDD);
+            }
+            if (mpfr_cmp_ui(nd->hi, 1) > 0) {
+                mpfr_set_ui(nd->hi, 1, MPFR_RNDU);
+            }
+        }
+        break;
+    case GMPY_RANGE_TAN:
+    case GMPY_RANGE_COT:
+        /* Between two poles, tan is increasing and cot is decreasing. An
+         * interval shorter than 1 around a pole has ends with values of
+         * opposite sign and magnitude above cot(1), in the wrong order.
+         */
+        i = GMPY_RANGE_KIND(range) == GMPY_RANGE_COT;
+        f->mpfr1(nd->lo, x[i], MPFR_RNDD);
+        f->mpfr1(nd->hi, x[1 - i], MPFR_RNDU);
+        mpfr_sub(t->a, x[1], x[0], MPFR_RNDU);
+        ok = mpfr_cmp_ui(t->a, 1) < 0 && mpfr_lessequal_p(nd->lo, nd->hi);
+        break;
+    case GMPY_RANGE_CORNERS:
+        /* An operand that is a single point, such as an exact zero, does
+         * not need to avoid zero: the function is then monotone in the
+         * other operand alone.
+         */
+        ok = !(((range & GMPY_RANGE_X_POSITIVE) && mpfr_sgn(x[0]) <= 0) ||
+               ((range & GMPY_RANGE_X_NONZERO) && !xpoint &&
+                mpfr_sgn(x[0]) <= 0 && mpfr_sgn(x[1]) >= 0) ||
+               ((range & GMPY_RANGE_Y_POSITIVE) && mpfr_sgn(y[0]) <= 0) ||
+               ((range & GMPY_RANGE_Y_NONZERO) && !ypoint &&
+                mpfr_sgn(y[0]) <= 0 && mpfr_sgn(y[1]) >= 0));
+        for (i = 0; ok && i < 2; i++) {
+            for (j = 0; ok && j < 2; j++) {
+                ok = GMPy_EvalTree_Merge(t, nd, x[i], y[j], !i && !j);
+            }
+        }
+        break;
+    }
+    return ok;
+}
+
+/* Evaluate every node at precision wp. */
+
+static void
+GMPy_EvalTree_Run(GMPy_EvalTree *t, mpfr_prec_t wp)
+{
+    GMPy_EvalNode *nd;
+    Py_ssize_t i;
+
+    mpfr_set_prec(t->a, wp);
+    mpfr_set_prec(t->b, wp);
+    mpfr_set_prec(t->z, wp);
+    t->unbounded = NULL;
+
+    for (i = 0; i < t->size; i++) {
+        nd = &t->node[i];
+        if (nd->func) {
+            mpfr_set_prec(nd->lo, wp);
+            mpfr_set_prec(nd->hi, wp);
+            if (!GMPy_EvalTree_Node(t, nd)) {
+                mpfr_set_inf(nd->lo, -1);
+                mpfr_set_inf(nd->hi, 1);
+                if (!t->unbounded) {
+                    t->unbounded = nd->func->name;
+                }
+            }
+        }
+        else if (MPQ_Check(nd->leaf)) {
+            mpfr_set_prec(nd->lo, wp);
+            mpfr_set_prec(nd->hi, wp);
+            mpfr_set_q(nd->lo, MPQ(nd->leaf), MPFR_RNDD);
+            mpfr_set_q(nd->hi, MPQ(nd->leaf), MPFR_RNDU);
+        }
+    }
+}
+
+/* Return 1 if x is the largest finite number of its precision, in the
+ * direction of sign.
+ */
+
+static int
+GMPy_EvalTree_IsMax(mpfr_srcptr x, int sign)
+{
+    mpfr_t temp;
+    int result;
+
+    if (!mpfr_regular_p(x) || mpfr_sgn(x) != sign || mpfr_get_exp(x) != mpfr_get_emax()) {
+        return 0;
+    }
+    mpfr_init2(temp, mpfr_get_prec(x));
+    mpfr_set(temp, x, MPFR_RNDN);
+    if (sign > 0) {
+        mpfr_nextabove(temp);
+    }
+    else {
+        mpfr_nextbelow(temp);
+    }
+    result = mpfr_inf_p(temp);
+    mpfr_clear(temp);
+    return result;
+}
+
+/* Round the value in [lo, hi] to r using s, of the same precision, as
+ * scratch. Return the ternary value, or 2 if the interval does not
+ * determine the correctly rounded result.
+ */
+
+static int
+GMPy_EvalTree_Round(mpfr_ptr r, mpfr_ptr s, mpfr_srcptr lo, mpfr_srcptr hi,
+                    mpfr_rnd_t rnd)
+{
+    int rc, hi_rc;
+
+    if (mpfr_nan_p(lo) && mpfr_nan_p(hi)) {
+        mpfr_set_nan(r);
+        return 0;
+    }
+
+    /* An end that is infinite while the other end is the largest finite
+     * number means the exact value overflows, as in exp(1e10). The result
+     * is an infinity or the largest number, as for a single operation.
+     */
+    if ((mpfr_inf_p(hi) && GMPy_EvalTree_IsMax(lo, 1)) ||
+        (mpfr_inf_p(lo) && GMPy_EvalTree_IsMax(hi, -1))) {
+        int sign = mpfr_inf_p(hi) ? 1 : -1;
+
+        mpfr_clear_flags();
+        if (rnd == MPFR_RNDN || rnd == MPFR_RNDA ||
+            rnd == (sign > 0 ? MPFR_RNDU : MPFR_RNDD)) {
+            mpfr_set_inf(r, sign);
+        }
+        else {
+            mpfr_set(r, sign > 0 ? lo : hi, rnd);
+            sign = -sign;
+        }
+        mpfr_set_overflow();
+        mpfr_set_inexflag();
+        return sign;
+    }
+
+    if (mpfr_equal_p(lo, hi)) {
+        /* The value is known exactly. An exact zero such as sub(1, 1)
+         * is -0 when rounding down, as in IEEE 754.
+         */
+        mpfr_clear_flags();
+        return mpfr_set(r, rnd == MPFR_RNDD ? lo : hi, rnd);
+    }
+
+    /* Both ends must round to the same number, strictly from the same
+     * side, so the exact value cannot be that number.
+     */
+
+    hi_rc = mpfr_set(s, hi, rnd);
+    mpfr_clear_flags();
+    rc = mpfr_set(r, lo, rnd);
+    if (!mpfr_equal_p(r, s) ||
+        !((rc > 0 && hi_rc > 0) || (rc < 0 && hi_rc < 0))) {
+        return 2;
+    }
+    return rc > 0 ? 1 : -1;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_evaluate_to,
+"evaluate_to(func, precision, /, *args, max_precision=0) -> mpfr\n\n"
+"Return func(*args) correctly rounded to precision bits using the\n"
+"rounding mode of the current context. func is the name of an `mpfr`\n"
+"function supported by `vec()`, or the function itself. Instead of a\n"
+"function, func may be an expression tree of nested tuples (f, x) or\n"
+"(f, x, y), where each x or y is a real number or another tuple; no\n"
+"args are allowed in that case. If precision is 0, the precision of\n"
+"the current context is used.\n\n"
+"The expression is evaluated with interval arithmetic at increasing\n"
+"working precisions until the interval that contains the exact value\n"
+"determines the rounded result, so the result is always correctly\n"
+"rounded. A result whose exact value is a precision-bit number is\n"
+"only found if every operation is exact at some working precision, so\n"
+"mul(mpq(1,3), 3) and sub(sin(1), sin(1)) fail. Functions such as\n"
+"`gamma()` or `zeta()` are only bounded for arguments that are exact at\n"
+"the working precision. A result that overflows is an infinity, or the\n"
+"largest number when rounding towards zero, and an operation with a NaN\n"
+"operand is NaN, as for a single operation. 'rint' rounds ties to even.\n"
+"`ValueError` is raised if the result cannot be bounded or the working\n"
+"precision would exceed max_precision; the default limit is the larger\n"
+"of 16*precision and precision+4096.");
+
+PyDoc_STRVAR(GMPy_doc_context_evaluate_to,
+"context.evaluate_to(func, precision, /, *args, max_precision=0) -> mpfr\n\n"
+"Return func(*args) correctly rounded to precision bits using the\n"
+"rounding mode of the context. See `evaluate_to()`.");
+
+static PyObject *
+GMPy_Context_Evaluate_To(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"max_precision", NULL};
+    PyObject *func, *expr = NULL, *empty = NULL;
+    MPFR_Object *result = NULL;
+    GMPy_EvalTree tree = {0, 0, NULL};
+    GMPy_EvalNode *root;
+    const char *unbounded;
+    mpfr_t scratch;
+    mpfr_prec_t prec, wp;
+    long precision, max_precision = 0;
+    Py_ssize_t i, nargs;
+    int rc;
+    CTXT_Object *context = NULL;
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
+
+    nargs = PyTuple_GET_SIZE(args);
+    if (nargs < 2) {
+        TYPE_ERROR("evaluate_to() requires at least 2 arguments");
+        return NULL;
+    }
+
+    if (!(empty = PyTuple_New(0))) {
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+    if (!PyArg_ParseTupleAndKeywords(empty, kwargs, "|$l", kwlist, &max_precision)) {
+        Py_DECREF(empty);
+        return NULL;
+    }
+    Py_DECREF(empty);
+
+    func = PyTuple_GET_ITEM(args, 0);
+    precision = PyLong_AsLong(PyTuple_GET_ITEM(args, 1));
+    if (precision == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (precision == 0) {
+        precision = GET_MPFR_PREC(context);
+    }
+    if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+    prec = (mpfr_prec_t)precision;
+
+    if (max_precision == 0) {
+        max_precision = 16 * (long)prec;
+        if (max_precision < prec + 4096) {
+            max_precision = prec + 4096;
+        }
+        if (max_precision > MPFR_PREC_MAX || max_precision < prec) {
+            max_precision = MPFR_PREC_MAX;
+        }
+    }
+    else if (max_precision < prec || max_precision > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for max_precision");
+        return NULL;
+    }
+
+    /* func with args is the same as the tree (func, *args). */
+
+    if (PyTuple_Check(func)) {
+        if (nargs > 2) {
+            TYPE_ERROR("evaluate_to() takes no args with an expression tree");
+            return NULL;
+        }
+        Py_INCREF(func);
+        expr = func;
+    }
+    else {
+        if (!(expr = PyTuple_New(nargs - 1))) {
+            return NULL; /* LCOV_EXCL_LINE */
+        }
+        Py_INCREF(func);
+        PyTuple_SET_ITEM(expr, 0, func);
+        for (i = 2; i < nargs; i++) {
+            Py_INCREF(PyTuple_GET_ITEM(args, i));
+            PyTuple_SET_ITEM(expr, i - 1, PyTuple_GET_ITEM(args, i));
+        }
+    }
+
+    if (GMPy_EvalTree_Parse(&tree, expr, context) < 0) {
+        Py_DECREF(expr);
+        GMPy_EvalTree_Clear(&tree);
+        return NULL;
+    }
+    Py_DECREF(expr);
+
+    if (!(result = GMPy_MPFR_New(prec, context))) {
+        /* LCOV_EXCL_START */
+        GMPy_EvalTree_Clear(&tree);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    root = &tree.node[tree.size - 1];
+    mpfr_init2(tree.a, MPFR_PREC_MIN);
+    mpfr_init2(tree.b, MPFR_PREC_MIN);
+    mpfr_init2(tree.z, MPFR_PREC_MIN);
+    mpfr_init2(scratch, prec);
+    wp = prec + 32;
+    if (wp > max_precision) {
+        wp = max_precision;
+    }
+
+    GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+    for (;;) {
+        GMPy_EvalTree_Run(&tree, wp);
+        rc = GMPy_EvalTree_Round(result->f, scratch, root->lo, root->hi,
+                                 GET_MPFR_ROUND(context));
+        if (rc != 2 || wp >= max_precision) {
+            break;
+        }
+        wp += wp / 2;
+        if (wp > max_precision) {
+            wp = max_precision;
+        }
+    }
+    GMPY_MAYBE_END_ALLOW_THREADS(context);
+
+    unbounded = tree.unbounded;
+    mpfr_clear(tree.a);
+    mpfr_clear(tree.b);
+    mpfr_clear(tree.z);
+    mpfr_clear(scratch);
+    GMPy_EvalTree_Clear(&tree);
+
+    if (rc == 2) {
+        Py_DECREF((PyObject*)result);
+        if (unbounded) {
+            PyErr_Format(PyExc_ValueError,
+                         "evaluate_to() cannot bound '%s' for an inexact argument",
+                         unbounded);
+        }
+        else {
+            VALUE_ERROR("evaluate_to() could not round the result within max_precision");
+        }
+        return NULL;
+    }
+
+    result->rc = rc;
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+}
+
 PyDoc_STRVAR(GMPy_doc_mpfr_get_emin_min,
 "get_emin_min() -> int\n\n"
 "Return the minimum possible exponent that can be set for `mpfr`.");
@@ -200,7 +834,7 @@ GMPy_MPFR_get_exp(PyObject *self, PyObject *other)
 
     CHECK_CONTEXT(context);
 
-    if (!(MPFR_Check(other))) {
+    if (!(MPFR_Check(other) || XMPFR_Check(other))) {
         TYPE_ERROR("get_exp() requires 'mpfr' argument");
         return NULL;
     }
@@ -675,7 +1309,7 @@ GMPy_MPFR_CheckRange(PyObject *x, CTXT_Object *context)
 static PyObject *
 GMPy_Number_CheckRange(PyObject *x, CTXT_Object *context)
 {
-    if (MPFR_Check(x))
+    if (MPFR_Check(x) || XMPFR_Check(x))
         return GMPy_MPFR_CheckRange(x, context);
 
     TYPE_ERROR("check_range() argument types not supported");
@@ -0,0 +1,455 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpq_accumulator.c                                                 *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Return a reference that keeps the numerator and denominator of obj
+ * alive and store pointers to them in num and den. den is set to NULL if
+ * obj is an integer. Returns NULL and sets an exception if obj is not a
+ * rational number.
+ */
+
+static PyObject *
+GMPy_MPQ_Accumulator_Parts(PyObject *obj, mpz_srcptr *num, mpz_srcptr *den,
+                           const char *msg, CTXT_Object *context)
+{
+    PyObject *temp;
+    int xtype;
+
+    xtype = GMPy_ObjectType(obj);
+
+    if (IS_TYPE_MPQ(xtype) || IS_TYPE_XMPQ(xtype)) {
+        *num = mpq_numref(MPQ(obj));
+        *den = mpq_denref(MPQ(obj));
+        Py_INCREF(obj);
+        return obj;
+    }
+
+    if (IS_TYPE_INTEGER(xtype)) {
+        if (!(temp = (PyObject*)GMPy_MPZ_From_IntegerWithType(obj, xtype, context))) {
+            return NULL;
+        }
+        *num = MPZ(temp);
+        *den = NULL;
+        return temp;
+    }
+
+    if (!IS_TYPE_RATIONAL(xtype)) {
+        TYPE_ERROR(msg);
+        return NULL;
+    }
+
+    if (!(temp = (PyObject*)GMPy_MPQ_From_RationalWithType(obj, xtype, context))) {
+        return NULL;
+    }
+    *num = mpq_numref(MPQ(temp));
+    *den = mpq_denref(MPQ(temp));
+    return temp;
+}
+
+/* Remove the common factors of the running numerator and denominator. */
+
+static void
+GMPy_MPQ_Accumulator_Reduce(MPQ_Accumulator_Object *self)
+{
+    mpz_t g;
+    mp_bitcnt_t size;
+
+    mpz_init(g);
+    mpz_gcd(g, self->num, self->den);
+    if (mpz_cmp_ui(g, 1) != 0) {
+        mpz_divexact(self->num, self->num, g);
+        mpz_divexact(self->den, self->den, g);
+    }
+    mpz_clear(g);
+
+    size = 2 * mpz_sizeinbase(self->den, 2);
+    self->limit = Py_MAX(size, self->threshold);
+}
+
+/* Add num/den to the sum held in self. den may be NULL for an integer.
+ * Adding an integer cannot make a reduced sum reducible, so only the
+ * other cases check the threshold; a threshold of 0 reduces every time.
+ */
+
+static void
+GMPy_MPQ_Accumulator_AddValue(MPQ_Accumulator_Object *self, mpz_srcptr num,
+                              mpz_srcptr den)
+{
+    self->count++;
+
+    if (!den || mpz_cmp_ui(den, 1) == 0) {
+        mpz_addmul(self->num, num, self->den);
+        return;
+    }
+
+    if (mpz_cmp(self->den, den) == 0) {
+        mpz_add(self->num, self->num, num);
+    }
+    else if (mpz_cmp_ui(self->den, 1) == 0) {
+        mpz_mul(self->num, self->num, den);
+        mpz_add(self->num, self->num, num);
+        mpz_set(self->den, den);
+    }
+    else {
+        mpz_mul(self->num, self->num, den);
+        mpz_addmul(self->num, num, self->den);
+        mpz_mul(self->den, self->den, den);
+    }
+
+    if (!self->threshold || mpz_sizeinbase(self->den, 2) > self->limit) {
+        GMPy_MPQ_Accumulator_Reduce(self);
+    }
+}
+
+static int
+GMPy_MPQ_Accumulator_AddObject(MPQ_Accumulator_Object *self, PyObject *obj,
+                               CTXT_Object *context)
+{
+    PyObject *temp;
+    mpz_srcptr num, den;
+
+    if (!(temp = GMPy_MPQ_Accumulator_Parts(obj, &num, &den,
+                        "mpq_accumulator only accepts rational numbers", context))) {
+        return -1;
+    }
+    GMPy_MPQ_Accumulator_AddValue(self, num, den);
+    Py_DECREF(temp);
+    return 0;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_accumulator,
+"mpq_accumulator(threshold=1024)\n\n"
+"Return an accumulator for the exact sum of rational numbers. The sum is\n"
+"kept as an unreduced fraction and the common factors of its numerator\n"
+"and denominator are only removed when the denominator grows past\n"
+"threshold bits, or when value() is called. Adding many fractions is\n"
+"much faster than with repeated mpq additions, which reduce their\n"
+"result every time. threshold=0 reduces after every addition.");
+
+static PyObject *
+GMPy_MPQ_Accumulator_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"threshold", NULL};
+    MPQ_Accumulator_Object *result;
+    Py_ssize_t threshold = GMPY_MPQ_ACC_THRESHOLD;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n", kwlist, &threshold)) {
+        return NULL;
+    }
+
+    if (threshold < 0) {
+        VALUE_ERROR("threshold must be >= 0");
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(MPQ_Accumulator_Object, &MPQ_Accumulator_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpz_init_set_ui(result->num, 0);
+    mpz_init_set_ui(result->den, 1);
+    result->threshold = (mp_bitcnt_t)threshold;
+    result->limit = result->threshold;
+    result->count = 0;
+    return (PyObject*)result;
+}
+
+static void
+GMPy_MPQ_Accumulator_Dealloc(MPQ_Accumulator_Object *self)
+{
+    mpz_clear(self->num);
+    mpz_clear(self->den);
+    PyObject_Free(self);
+}
+
+static PyObject *
+GMPy_MPQ_Accumulator_Repr(MPQ_Accumulator_Object *self)
+{
+    return PyUnicode_FromFormat("<mpq_accumulator threshold=%zu count=%llu>",
+                                (size_t)self->threshold, self->count);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_accumulator_add,
+"x.add(y, /) -> None\n\n"
+"Add the rational number y to the accumulator.");
+
+static PyObject *
+GMPy_MPQ_Accumulator_Add(PyObject *self, PyObject *other)
+{
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (GMPy_MPQ_Accumulator_AddObject((MPQ_Accumulator_Object*)self, other, context) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_accumulator_add_many,
+"x.add_many(iterable, /) -> None\n\n"
+"Add every rational number in iterable to the accumulator. If an item is\n"
+"not a rational number, the items before it have already been added.");
+
+static PyObject *
+GMPy_MPQ_Accumulator_AddMany(PyObject *self, PyObject *other)
+{
+    MPQ_Accumulator_Object *acc = (MPQ_Accumulator_Object*)self;
+    PyObject *iter, *item;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!(iter = PyObject_GetIter(other))) {
+        TYPE_ERROR("add_many() argument must be an iterable");
+        return NULL;
+    }
+
+    while ((item = PyIter_Next(iter))) {
+        if (GMPy_MPQ_Accumulator_AddObject(acc, item, context) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(iter);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+
+    Py_DECREF(iter);
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_accumulator_value,
+"x.value() -> mpq\n\n"
+"Return the sum of the values added so far. The running fraction is\n"
+"reduced first, so calling value() again without adding is cheap.");
+
+static PyObject *
+GMPy_MPQ_Accumulator_Value(PyObject *self, PyObject *args)
+{
+    MPQ_Accumulator_Object *acc = (MPQ_Accumulator_Object*)self;
+    MPQ_Object *result;
+
+    if (!(result = GMPy_MPQ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    GMPy_MPQ_Accumulator_Reduce(acc);
+    mpz_set(mpq_numref(result->q), acc->num);
+    mpz_set(mpq_denref(result->q), acc->den);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_accumulator_reset,
+"x.reset() -> None\n\n"
+"Set the accumulated sum to zero.");
+
+static PyObject *
+GMPy_MPQ_Accumulator_Reset(PyObject *self, PyObject *args)
+{
+    MPQ_Accumulator_Object *acc = (MPQ_Accumulator_Object*)self;
+
+    mpz_set_ui(acc->num, 0);
+    mpz_set_ui(acc->den, 1);
+    acc->limit = acc->threshold;
+    acc->count = 0;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_MPQ_Accumulator_GetThreshold(MPQ_Accumulator_Object *self, void *closure)
+{
+    return PyLong_FromSize_t((size_t)self->threshold);
+}
+
+static PyObject *
+GMPy_MPQ_Accumulator_GetCount(MPQ_Accumulator_Object *self, void *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->count);
+}
+
+static PyMethodDef GMPy_MPQ_Accumulator_methods[] =
+{
+    { "add", GMPy_MPQ_Accumulator_Add, METH_O, GMPy_doc_mpq_accumulator_add },
+    { "add_many", GMPy_MPQ_Accumulator_AddMany, METH_O, GMPy_doc_mpq_accumulator_add_many },
+    { "reset", GMPy_MPQ_Accumulator_Reset, METH_NOARGS, GMPy_doc_mpq_accumulator_reset },
+    { "value", GMPy_MPQ_Accumulator_Value, METH_NOARGS, GMPy_doc_mpq_accumulator_value },
+    { NULL, NULL, 1 }
+};
+
+static PyGetSetDef GMPy_MPQ_Accumulator_getseters[] =
+{
+    { "count", (getter)GMPy_MPQ_Accumulator_GetCount, NULL, "number of values added", NULL },
+    { "threshold", (getter)GMPy_MPQ_Accumulator_GetThreshold, NULL, "minimum size in bits of the denominator before reducing", NULL },
+    { NULL }
+};
+
+static PyTypeObject MPQ_Accumulator_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.mpq_accumulator",
+    .tp_basicsize = sizeof(MPQ_Accumulator_Object),
+    .tp_dealloc = (destructor) GMPy_MPQ_Accumulator_Dealloc,
+    .tp_repr = (reprfunc) GMPy_MPQ_Accumulator_Repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_mpq_accumulator,
+    .tp_methods = GMPy_MPQ_Accumulator_methods,
+    .tp_getset = GMPy_MPQ_Accumulator_getseters,
+    .tp_new = GMPy_MPQ_Accumulator_NewInit,
+};
+
+/* Add the fractions num[i]/den[i] pairwise, one level of the tree at a
+ * time, so that the denominators that are multiplied together always have
+ * about the same size. The sum is left in num[0]/den[0], unreduced.
+ */
+
+static void
+GMPy_MPQ_Sum_Tree(mpz_t *num, mpz_t *den, Py_ssize_t n)
+{
+    Py_ssize_t i, k;
+
+    while (n > 1) {
+        for (i = 0, k = 0; i + 1 < n; i += 2, k++) {
+            if (mpz_cmp(den[i], den[i + 1]) == 0) {
+                mpz_add(num[k], num[i], num[i + 1]);
+                mpz_swap(den[k], den[i]);
+            }
+            else if (mpz_cmp_ui(den[i + 1], 1) == 0) {
+                mpz_addmul(num[i], num[i + 1], den[i]);
+                mpz_swap(num[k], num[i]);
+                mpz_swap(den[k], den[i]);
+            }
+            else if (mpz_cmp_ui(den[i], 1) == 0) {
+                mpz_addmul(num[i + 1], num[i], den[i + 1]);
+                mpz_swap(num[k], num[i + 1]);
+                mpz_swap(den[k], den[i + 1]);
+            }
+            else {
+                mpz_mul(num[i], num[i], den[i + 1]);
+                mpz_addmul(num[i], num[i + 1], den[i]);
+                mpz_mul(den[i], den[i], den[i + 1]);
+                mpz_swap(num[k], num[i]);
+                mpz_swap(den[k], den[i]);
+            }
+        }
+        if (i < n) {
+            mpz_swap(num[k], num[i]);
+            mpz_swap(den[k], den[i]);
+            k++;
+        }
+        n = k;
+    }
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_function_sum,
+"mpq_sum(iterable, /) -> mpq\n\n"
+"Return the exact sum of the rational numbers in iterable. The fractions\n"
+"are added pairwise in a balanced tree without reducing the partial sums,\n"
+"and the result is reduced once at the end. This is much faster than\n"
+"sum() for many fractions with different denominators.");
+
+static PyObject *
+GMPy_MPQ_Function_Sum(PyObject *self, PyObject *other)
+{
+    MPQ_Object *result = NULL;
+    PyObject *seq, *temp;
+    mpz_t *num = NULL, *den = NULL;
+    mpz_srcptr n, d;
+    Py_ssize_t i, len, done = 0;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (!(seq = PySequence_Fast(other, "mpq_sum() argument must be an iterable"))) {
+        return NULL;
+    }
+
+    len = PySequence_Fast_GET_SIZE(seq);
+
+    if (!(result = GMPy_MPQ_New(context))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(seq);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    if (len == 0) {
+        Py_DECREF(seq);
+        return (PyObject*)result;
+    }
+
+    if (!(num = PyMem_New(mpz_t, len)) || !(den = PyMem_New(mpz_t, len))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto error;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (done = 0; done < len; done++) {
+        if (!(temp = GMPy_MPQ_Accumulator_Parts(PySequence_Fast_GET_ITEM(seq, done), &n, &d,
+                                "mpq_sum() requires an iterable of rational numbers", context))) {
+            goto error;
+        }
+        mpz_init_set(num[done], n);
+        if (d) {
+            mpz_init_set(den[done], d);
+        }
+        else {
+            mpz_init_set_ui(den[done], 1);
+        }
+        Py_DECREF(temp);
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    GMPy_MPQ_Sum_Tree(num, den, len);
+    mpz_swap(mpq_numref(result->q), num[0]);
+    mpz_swap(mpq_denref(result->q), den[0]);
+    mpq_canonicalize(result->q);
+    Py_END_ALLOW_THREADS;
+
+    for (i = 0; i < len; i++) {
+        mpz_clear(num[i]);
+        mpz_clear(den[i]);
+    }
+    PyMem_Free(num);
+    PyMem_Free(den);
+    Py_DECREF(seq);
+    return (PyObject*)result;
+
+  error:
+    for (i = 0; i < done; i++) {
+        mpz_clear(num[i]);
+        mpz_clear(den[i]);
+    }
+    PyMem_Free(num);
+    PyMem_Free(den);
+    Py_DECREF(seq);
+    Py_DECREF((PyObject*)result);
+    return NULL;
+}
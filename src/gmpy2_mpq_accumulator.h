@@ -0,0 +1,68 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpq_accumulator.h                                                 *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPQ_ACCUMULATOR_H
+#define GMPY_MPQ_ACCUMULATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An mpq_accumulator keeps the sum of all the values added to it as an
+ * unreduced fraction num/den with den > 0. The gcd is only removed when the
+ * denominator grows past limit bits, or when the value is requested. After
+ * each reduction limit is reset to twice the size of the reduced
+ * denominator (but never below threshold), so a sum whose true denominator
+ * is large is not reduced after every addition.
+ */
+
+#define GMPY_MPQ_ACC_THRESHOLD 1024
+
+typedef struct {
+    PyObject_HEAD
+    mpz_t num;                       /* unreduced numerator */
+    mpz_t den;                       /* unreduced denominator, > 0 */
+    mp_bitcnt_t threshold;           /* minimum size of den before reducing */
+    mp_bitcnt_t limit;               /* size of den that triggers a reduction */
+    unsigned long long count;        /* number of values added */
+} MPQ_Accumulator_Object;
+
+static PyTypeObject MPQ_Accumulator_Type;
+#define MPQ_Accumulator_Check(v) (((PyObject*)v)->ob_type == &MPQ_Accumulator_Type)
+
+static PyObject * GMPy_MPQ_Accumulator_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs);
+static void       GMPy_MPQ_Accumulator_Dealloc(MPQ_Accumulator_Object *self);
+static PyObject * GMPy_MPQ_Accumulator_Repr(MPQ_Accumulator_Object *self);
+static PyObject * GMPy_MPQ_Accumulator_Add(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPQ_Accumulator_AddMany(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPQ_Accumulator_Value(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPQ_Accumulator_Reset(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPQ_Accumulator_GetThreshold(MPQ_Accumulator_Object *self, void *closure);
+static PyObject * GMPy_MPQ_Accumulator_GetCount(MPQ_Accumulator_Object *self, void *closure);
+static PyObject * GMPy_MPQ_Function_Sum(PyObject *self, PyObject *other);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,387 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpq_cf.c                                                          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Simulate Euclid's algorithm on the leading bits of a >= b > 0. The
+ * quotients that are certain to agree with the full computation (Knuth,
+ * TAOCP vol. 2, Algorithm 4.5.2L) are stored in q, at most maxq of them,
+ * and m is set to the cofactor matrix that maps (a, b) to the pair of
+ * remainders reached after them:
+ *
+ *     a' = m[0]*a + m[1]*b,   b' = m[2]*a + m[3]*b
+ *
+ * Returns the number of quotients found, which may be 0.
+ */
+
+static int
+_GMPy_CF_Lehmer(mpz_srcptr a, mpz_srcptr b, long m[4], unsigned long *q, int maxq)
+{
+    long x, y, A = 1, B = 0, C = 0, D = 1, qq, t;
+    size_t bits;
+    mpz_t temp;
+    int n = 0;
+
+    bits = mpz_sizeinbase(a, 2);
+    mpz_init(temp);
+    if (bits > CF_LEHMER_BITS) {
+        mpz_tdiv_q_2exp(temp, a, bits - CF_LEHMER_BITS);
+        x = (long)mpz_get_ui(temp);
+        mpz_tdiv_q_2exp(temp, b, bits - CF_LEHMER_BITS);
+        y = (long)mpz_get_ui(temp);
+    }
+    else {
+        x = (long)mpz_get_ui(a);
+        y = (long)mpz_get_ui(b);
+    }
+    mpz_clear(temp);
+
+    while (n < maxq && y + C > 0 && y + D > 0) {
+        qq = (x + A) / (y + C);
+        if (qq != (x + B) / (y + D)) {
+            break;
+        }
+        t = A - qq * C; A = C; C = t;
+        t = B - qq * D; B = D; D = t;
+        t = x - qq * y; x = y; y = t;
+        q[n++] = (unsigned long)qq;
+    }
+
+    m[0] = A; m[1] = B; m[2] = C; m[3] = D;
+    return n;
+}
+
+/* Replace (a, b) by (m[0]*a + m[1]*b, m[2]*a + m[3]*b). */
+
+static void
+_GMPy_CF_Apply(mpz_t a, mpz_t b, const long m[4], mpz_t t1, mpz_t t2)
+{
+    mpz_mul_si(t1, a, m[0]);
+    mpz_mul_si(t2, b, m[1]);
+    mpz_add(t1, t1, t2);
+    mpz_mul_si(t2, a, m[2]);
+    mpz_mul_si(b, b, m[3]);
+    mpz_add(b, b, t2);
+    mpz_swap(a, t1);
+}
+
+/* Convert a real number to an mpq, or set an exception. */
+
+static MPQ_Object *
+_GMPy_CF_ToMPQ(PyObject *obj, const char *name)
+{
+    if (!IS_REAL(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s() requires a real number", name);
+        return NULL;
+    }
+    return GMPy_MPQ_From_Number(obj, NULL);
+}
+
+static PyObject *
+_GMPy_CF_Iterator_New(PyObject *const *args, Py_ssize_t nargs, int convergents,
+                      const char *name)
+{
+    CF_Iterator_Object *result;
+    MPQ_Object *x;
+    long long limit = -1;
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 1 or 2 arguments", name);
+        return NULL;
+    }
+
+    if (nargs == 2 && args[1] != Py_None) {
+        if (!IS_INTEGER(args[1])) {
+            PyErr_Format(PyExc_TypeError, "%s() max_terms must be an integer or None", name);
+            return NULL;
+        }
+        limit = GMPy_Integer_AsLongLong(args[1]);
+        if (limit == -1 && PyErr_Occurred()) {
+            return NULL;
+        }
+        if (limit < 0) {
+            PyErr_Format(PyExc_ValueError, "%s() max_terms must be >= 0", name);
+            return NULL;
+        }
+        if (limit > PY_SSIZE_T_MAX) {
+            limit = PY_SSIZE_T_MAX;
+        }
+    }
+
+    if (!(x = _GMPy_CF_ToMPQ(args[0], name))) {
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(CF_Iterator_Object, &CF_Iterator_Type))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF((PyObject*)x);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpz_init_set(result->a, mpq_numref(x->q));
+    mpz_init_set(result->b, mpq_denref(x->q));
+    Py_DECREF((PyObject*)x);
+    mpz_init_set_ui(result->h0, 0);
+    mpz_init_set_ui(result->h1, 1);
+    mpz_init_set_ui(result->k0, 1);
+    mpz_init_set_ui(result->k1, 0);
+    result->qlen = result->qpos = 0;
+    result->started = 0;
+    result->convergents = convergents;
+    result->remaining = (Py_ssize_t)limit;
+    return (PyObject*)result;
+}
+
+static void
+GMPy_CF_Iterator_Dealloc(CF_Iterator_Object *self)
+{
+    mpz_clear(self->a);
+    mpz_clear(self->b);
+    mpz_clear(self->h0);
+    mpz_clear(self->h1);
+    mpz_clear(self->k0);
+    mpz_clear(self->k1);
+    PyObject_Free(self);
+}
+
+static PyObject *
+GMPy_CF_Iterator_Next(CF_Iterator_Object *self)
+{
+    MPZ_Object *term;
+    MPQ_Object *conv;
+    mpz_t t1, t2;
+    long m[4];
+
+    if (self->remaining == 0 ||
+        (self->qpos == self->qlen && mpz_sgn(self->b) == 0)) {
+        return NULL;
+    }
+
+    if (!(term = GMPy_MPZ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    if (self->qpos < self->qlen) {
+        mpz_set_ui(term->z, self->q[self->qpos++]);
+    }
+    else {
+        mpz_init(t1);
+        mpz_init(t2);
+        if (self->started &&
+            mpz_sizeinbase(self->a, 2) > 2 * CF_LEHMER_BITS &&
+            (self->qlen = _GMPy_CF_Lehmer(self->a, self->b, m, self->q,
+                                          CF_MAX_QUOTIENTS)) > 0) {
+            _GMPy_CF_Apply(self->a, self->b, m, t1, t2);
+            self->qpos = 1;
+            mpz_set_ui(term->z, self->q[0]);
+        }
+        else {
+            /* The first quotient is floor(a/b) and may be negative. */
+            self->qlen = self->qpos = 0;
+            mpz_fdiv_qr(term->z, t1, self->a, self->b);
+            mpz_swap(self->a, self->b);
+            mpz_swap(self->b, t1);
+            self->started = 1;
+        }
+        mpz_clear(t1);
+        mpz_clear(t2);
+    }
+
+    if (self->remaining > 0) {
+        self->remaining--;
+    }
+
+    if (!self->convergents) {
+        return (PyObject*)term;
+    }
+
+    mpz_addmul(self->h0, term->z, self->h1);
+    mpz_swap(self->h0, self->h1);
+    mpz_addmul(self->k0, term->z, self->k1);
+    mpz_swap(self->k0, self->k1);
+    Py_DECREF((PyObject*)term);
+
+    if (!(conv = GMPy_MPQ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpz_set(mpq_numref(conv->q), self->h1);
+    mpz_set(mpq_denref(conv->q), self->k1);
+    return (PyObject*)conv;
+}
+
+static PyTypeObject CF_Iterator_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.cf_iterator",
+    .tp_basicsize = sizeof(CF_Iterator_Object),
+    .tp_dealloc = (destructor) GMPy_CF_Iterator_Dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_iter = PyObject_SelfIter,
+    .tp_iternext = (iternextfunc) GMPy_CF_Iterator_Next,
+};
+
+PyDoc_STRVAR(GMPy_doc_mpq_function_continued_fraction,
+"continued_fraction(x, max_terms=None, /) -> collections.abc.Iterator\n\n"
+"Return an iterator over the terms of the continued fraction of the real\n"
+"number x, as mpz. The first term is floor(x); the others are positive.\n"
+"An mpfr or float is expanded exactly, as the binary fraction it\n"
+"represents. If max_terms is given, at most max_terms terms are returned.");
+
+static PyObject *
+GMPy_MPQ_Function_ContinuedFraction(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    return _GMPy_CF_Iterator_New(args, nargs, 0, "continued_fraction");
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_function_convergents,
+"convergents(x, max_terms=None, /) -> collections.abc.Iterator\n\n"
+"Return an iterator over the convergents of the continued fraction of the\n"
+"real number x, as mpq. The last convergent is equal to x. If max_terms\n"
+"is given, at most max_terms convergents are returned.");
+
+static PyObject *
+GMPy_MPQ_Function_Convergents(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    return _GMPy_CF_Iterator_New(args, nargs, 1, "convergents");
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_function_rational_reconstruct,
+"rational_reconstruct(a, m, /) -> mpq\n\n"
+"Return the fraction n/d with n = a*d (mod m), |n| <= N and 0 < d <= N,\n"
+"where N = isqrt((m-1)//2). If it exists, it is unique. Raises ValueError\n"
+"if there is no such fraction. m must be > 1.");
+
+static PyObject *
+GMPy_MPQ_Function_RationalReconstruct(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    MPQ_Object *result = NULL;
+    MPZ_Object *tempa = NULL, *tempm = NULL;
+    mpz_t r0, r1, s0, s1, q, bound, t1, t2;
+    size_t nbits;
+    long m[4];
+    unsigned long quot[CF_MAX_QUOTIENTS];
+    int ok;
+
+    if (nargs != 2 || !IS_INTEGER(args[0]) || !IS_INTEGER(args[1])) {
+        TYPE_ERROR("rational_reconstruct() requires 'int','int' arguments");
+        return NULL;
+    }
+
+    if (!(tempa = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempm = GMPy_MPZ_From_Integer(args[1], NULL))) {
+        /* LCOV_EXCL_START */
+        Py_XDECREF((PyObject*)tempa);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    if (mpz_cmp_ui(tempm->z, 1) <= 0) {
+        VALUE_ERROR("rational_reconstruct() requires m > 1");
+        Py_DECREF((PyObject*)tempa);
+        Py_DECREF((PyObject*)tempm);
+        return NULL;
+    }
+
+    if (!(result = GMPy_MPQ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF((PyObject*)tempa);
+        Py_DECREF((PyObject*)tempm);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpz_init_set(r0, tempm->z);
+    mpz_init(r1);
+    mpz_mod(r1, tempa->z, tempm->z);
+    mpz_init_set_ui(s0, 0);
+    mpz_init_set_ui(s1, 1);
+    mpz_init(q);
+    mpz_init(bound);
+    mpz_init(t1);
+    mpz_init(t2);
+    Py_DECREF((PyObject*)tempa);
+    Py_DECREF((PyObject*)tempm);
+
+    Py_BEGIN_ALLOW_THREADS;
+    mpz_sub_ui(bound, r0, 1);
+    mpz_tdiv_q_2exp(bound, bound, 1);
+    mpz_sqrt(bound, bound);
+    nbits = mpz_sizeinbase(bound, 2);
+
+    /* Run the extended Euclidean algorithm on (m, a) until the remainder
+     * is <= N, keeping s with r = s*a (mod m). A Lehmer step moves r0 down
+     * by fewer than CF_LEHMER_BITS + 1 bits, so it is only used while r0
+     * stays above N afterwards; r1 is then the first remainder <= N.
+     */
+
+    while (mpz_cmp(r1, bound) > 0) {
+        if (mpz_sizeinbase(r0, 2) > Py_MAX(nbits, (size_t)CF_LEHMER_BITS) + CF_LEHMER_BITS + 2 &&
+            _GMPy_CF_Lehmer(r0, r1, m, quot, CF_MAX_QUOTIENTS) > 0) {
+            _GMPy_CF_Apply(r0, r1, m, t1, t2);
+            _GMPy_CF_Apply(s0, s1, m, t1, t2);
+        }
+        else {
+            mpz_tdiv_qr(q, r0, r0, r1);
+            mpz_swap(r0, r1);
+            mpz_submul(s0, q, s1);
+            mpz_swap(s0, s1);
+        }
+    }
+
+    /* r1/s1 is the answer if |s1| <= N and gcd(r1, s1) == 1. */
+
+    ok = 0;
+    if (mpz_cmpabs(s1, bound) <= 0) {
+        mpz_gcd(q, r1, s1);
+        if (mpz_cmp_ui(q, 1) == 0) {
+            if (mpz_sgn(s1) < 0) {
+                mpz_neg(r1, r1);
+                mpz_neg(s1, s1);
+            }
+            mpz_swap(mpq_numref(result->q), r1);
+            mpz_swap(mpq_denref(result->q), s1);
+            ok = 1;
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    mpz_clear(r0);
+    mpz_clear(r1);
+    mpz_clear(s0);
+    mpz_clear(s1);
+    mpz_clear(q);
+    mpz_clear(bound);
+    mpz_clear(t1);
+    mpz_clear(t2);
+
+    if (!ok) {
+        VALUE_ERROR("rational_reconstruct() found no fraction within the bounds");
+        Py_DECREF((PyObject*)result);
+        return NULL;
+    }
+    return (PyObject*)result;
+}
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpq_cf.h                                                          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPQ_CF_H
+#define GMPY_MPQ_CF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Continued fractions and rational reconstruction are both driven by
+ * Euclid's algorithm. For large operands the quotients are found with
+ * Lehmer's method: Euclid's algorithm is simulated on the leading
+ * CF_LEHMER_BITS bits of the operands, and the resulting 2x2 cofactor
+ * matrix is applied to the full values once for a whole batch of
+ * quotients.
+ */
+
+#define CF_LEHMER_BITS (8 * (int)sizeof(long) - 3)
+#define CF_MAX_QUOTIENTS 128
+
+typedef struct {
+    PyObject_HEAD
+    mpz_t a, b;                      /* remaining fraction a/b; b == 0 when done */
+    mpz_t h0, h1, k0, k1;            /* last two convergents h/k */
+    unsigned long q[CF_MAX_QUOTIENTS]; /* quotients found by the last Lehmer step */
+    int qlen, qpos;
+    int started;                     /* first (signed) quotient returned */
+    int convergents;                 /* yield convergents instead of quotients */
+    Py_ssize_t remaining;            /* terms left, or -1 for no limit */
+} CF_Iterator_Object;
+
+static PyTypeObject CF_Iterator_Type;
+#define CF_Iterator_Check(v) (((PyObject*)v)->ob_type == &CF_Iterator_Type)
+
+static void       GMPy_CF_Iterator_Dealloc(CF_Iterator_Object *self);
+static PyObject * GMPy_CF_Iterator_Next(CF_Iterator_Object *self);
+static PyObject * GMPy_MPQ_Function_ContinuedFraction(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPQ_Function_Convergents(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPQ_Function_RationalReconstruct(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -797,3 +797,273 @@ GMPy_MPZ_hamdist(PyObject *self, PyObject *args)
     Py_XDECREF((PyObject*)tempy);
     return NULL;
 }
+
+/* popcount_many() and hamdist_many() read mpz and xmpz values in place and
+ * convert Python integers into a single scratch mpz, so no temporary
+ * objects are created for the common cases. The counting itself is done
+ * by mpz_popcount() and mpz_hamdist(); a fat build of GMP selects the
+ * fastest popcount code for the running CPU.
+ *
+ * An object that supports the buffer protocol is read as an array of
+ * unsigned words of width bytes in native byte order. When a word is a
+ * whole number of aligned limbs in the order GMP uses, mpn_popcount() and
+ * mpn_hamdist() run directly on the buffer; other words are read with
+ * mpz_import().
+ */
+
+/* Return the value of obj, converted into scratch if needed. msg is only
+ * used if obj is not an integer; a failed conversion keeps its exception.
+ */
+
+static mpz_srcptr
+GMPy_MPZ_Bitops_Item(PyObject *obj, mpz_ptr scratch, const char *msg)
+{
+    MPZ_Object *tempx;
+    int xtype;
+
+    if (CHECK_MPZANY(obj)) {
+        return MPZ(obj);
+    }
+    if (PyLong_Check(obj)) {
+        if (mpz_set_PyLong(scratch, obj)) {
+            return NULL; /* LCOV_EXCL_LINE */
+        }
+        return scratch;
+    }
+    xtype = GMPy_ObjectType(obj);
+    if (!IS_TYPE_INTEGER(xtype)) {
+        TYPE_ERROR(msg);
+        return NULL;
+    }
+    if (!(tempx = GMPy_MPZ_From_IntegerWithType(obj, xtype, NULL))) {
+        return NULL;
+    }
+    mpz_set(scratch, tempx->z);
+    Py_DECREF((PyObject*)tempx);
+    return scratch;
+}
+
+/* Return [popcount(w) for w in words], or [hamdist(x, w) for w in words]
+ * if x is not NULL. A width of 0 uses the item size of the buffer.
+ */
+
+static PyObject *
+GMPy_MPZ_Bitops_Buffer(PyObject *obj, Py_ssize_t width, mpz_srcptr x,
+                       const char *name)
+{
+    PyObject *result = NULL, *temp;
+    Py_buffer view;
+    mp_limb_t *xlimbs = NULL;
+    mp_size_t nlimbs;
+    mpz_t scratch;
+    const char *p;
+    Py_ssize_t i, len;
+    int direct;
+
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS) < 0) {
+        return NULL;
+    }
+
+    if (width == 0) {
+        width = view.itemsize;
+    }
+    if (width <= 0 || view.len % width) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s() buffer size must be a multiple of a positive width", name);
+        goto done;
+    }
+    if (x && (mpz_sgn(x) < 0 || mpz_sizeinbase(x, 2) > 8 * (size_t)width)) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s() requires 0 <= x < 2**(8*width) with a buffer", name);
+        goto done;
+    }
+
+    len = view.len / width;
+    nlimbs = (mp_size_t)((width + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t));
+    direct = width % sizeof(mp_limb_t) == 0 &&
+             (PY_LITTLE_ENDIAN || nlimbs == 1) &&
+             (uintptr_t)view.buf % sizeof(mp_limb_t) == 0;
+
+    if (direct && x) {
+        if (!(xlimbs = PyMem_Calloc(nlimbs, sizeof(mp_limb_t)))) {
+            /* LCOV_EXCL_START */
+            PyErr_NoMemory();
+            goto done;
+            /* LCOV_EXCL_STOP */
+        }
+        if (mpz_size(x)) {
+            memcpy(xlimbs, mpz_limbs_read(x), mpz_size(x) * sizeof(mp_limb_t));
+        }
+    }
+
+    if (!(result = PyList_New(len))) {
+        goto done; /* LCOV_EXCL_LINE */
+    }
+
+    mpz_init(scratch);
+    for (i = 0, p = view.buf; i < len; i++, p += width) {
+        if (direct) {
+            temp = GMPy_PyLong_FromMpBitCnt(x ?
+                       mpn_hamdist(xlimbs, (mp_srcptr)p, nlimbs) :
+                       mpn_popcount((mp_srcptr)p, nlimbs));
+        }
+        else {
+            mpz_import(scratch, 1, 1, (size_t)width, 0, 0, p);
+            temp = GMPy_PyLong_FromMpBitCnt(x ? mpz_hamdist(x, scratch) :
+                                                mpz_popcount(scratch));
+        }
+        if (!temp) {
+            /* LCOV_EXCL_START */
+            Py_CLEAR(result);
+            break;
+            /* LCOV_EXCL_STOP */
+        }
+        PyList_SET_ITEM(result, i, temp);
+    }
+    mpz_clear(scratch);
+
+  done:
+    PyMem_Free(xlimbs);
+    PyBuffer_Release(&view);
+    return result;
+}
+
+PyDoc_STRVAR(doc_popcount_many,
+"popcount_many(lst, /, width=0) -> list[int, ...]\n\n"
+"Return [popcount(x) for x in lst]. If lst supports the buffer protocol,\n"
+"such as bytes or array.array, it is read as unsigned words of width\n"
+"bytes in native byte order; the default width is the item size of the\n"
+"buffer.");
+
+static PyObject *
+GMPy_MPZ_popcount_many(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"", "width", NULL};
+    PyObject *other, *seq = NULL, *result = NULL, *temp;
+    mpz_srcptr x;
+    mpz_t scratch;
+    mp_bitcnt_t n;
+    Py_ssize_t i, len, width = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|n:popcount_many", kwlist,
+                                     &other, &width)) {
+        return NULL;
+    }
+
+    if (PyObject_CheckBuffer(other)) {
+        return GMPy_MPZ_Bitops_Buffer(other, width, NULL, "popcount_many");
+    }
+
+    if (!(seq = PySequence_Fast(other, "argument must be an iterable"))) {
+        return NULL;
+    }
+
+    len = PySequence_Fast_GET_SIZE(seq);
+    if (!(result = PyList_New(len))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(seq);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpz_init(scratch);
+    for (i = 0; i < len; i++) {
+        if (!(x = GMPy_MPZ_Bitops_Item(PySequence_Fast_GET_ITEM(seq, i), scratch,
+                                       "popcount_many() requires a sequence of integers"))) {
+            goto error;
+        }
+        n = mpz_popcount(x);
+        if (n == (mp_bitcnt_t)(-1))
+            temp = PyLong_FromLong(-1);
+        else
+            temp = GMPy_PyLong_FromMpBitCnt(n);
+        if (!temp) {
+            goto error; /* LCOV_EXCL_LINE */
+        }
+        PyList_SET_ITEM(result, i, temp);
+    }
+    mpz_clear(scratch);
+    Py_DECREF(seq);
+    return result;
+
+  error:
+    mpz_clear(scratch);
+    Py_DECREF(seq);
+    Py_DECREF(result);
+    return NULL;
+}
+
+PyDoc_STRVAR(doc_hamdist_many,
+"hamdist_many(x, lst, /, width=0) -> list[int, ...]\n\n"
+"Return [hamdist(x, y) for y in lst]. If lst supports the buffer\n"
+"protocol, it is read as unsigned words of width bytes as in\n"
+"`popcount_many()`, and x must satisfy 0 <= x < 2**(8*width).");
+
+static PyObject *
+GMPy_MPZ_hamdist_many(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"", "", "width", NULL};
+    PyObject *arg0, *other, *seq = NULL, *result = NULL, *temp;
+    MPZ_Object *tempx = NULL;
+    mpz_srcptr y;
+    mpz_t scratch;
+    Py_ssize_t i, len, width = 0;
+    int xtype;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|n:hamdist_many", kwlist,
+                                     &arg0, &other, &width)) {
+        return NULL;
+    }
+
+    xtype = GMPy_ObjectType(arg0);
+    if (!IS_TYPE_INTEGER(xtype)) {
+        TYPE_ERROR("hamdist_many() requires 'mpz' first argument");
+        return NULL;
+    }
+    if (!(tempx = GMPy_MPZ_From_IntegerWithType(arg0, xtype, NULL))) {
+        return NULL;
+    }
+
+    if (PyObject_CheckBuffer(other)) {
+        result = GMPy_MPZ_Bitops_Buffer(other, width, tempx->z, "hamdist_many");
+        Py_DECREF((PyObject*)tempx);
+        return result;
+    }
+
+    if (!(seq = PySequence_Fast(other, "argument must be an iterable"))) {
+        Py_DECREF((PyObject*)tempx);
+        return NULL;
+    }
+
+    len = PySequence_Fast_GET_SIZE(seq);
+    if (!(result = PyList_New(len))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF((PyObject*)tempx);
+        Py_DECREF(seq);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpz_init(scratch);
+    for (i = 0; i < len; i++) {
+        if (!(y = GMPy_MPZ_Bitops_Item(PySequence_Fast_GET_ITEM(seq, i), scratch,
+                                       "hamdist_many() requires a sequence of integers"))) {
+            goto error;
+        }
+        if (!(temp = GMPy_PyLong_FromMpBitCnt(mpz_hamdist(tempx->z, y)))) {
+            goto error; /* LCOV_EXCL_LINE */
+        }
+        PyList_SET_ITEM(result, i, temp);
+    }
+    mpz_clear(scratch);
+    Py_DECREF((PyObject*)tempx);
+    Py_DECREF(seq);
+    return result;
+
+  error:
+    mpz_clear(scratch);
+    Py_DECREF((PyObject*)tempx);
+    Py_DECREF(seq);
+    Py_DECREF(result);
+    return NULL;
+}
@@ -49,7 +49,9 @@ static PyObject * GMPy_MPZ_bit_flip_function(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_bit_flip_method(PyObject *self, PyObject *other);
 
 static PyObject * GMPy_MPZ_popcount(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPZ_popcount_many(PyObject *self, PyObject *args, PyObject *kwargs);
 static PyObject * GMPy_MPZ_hamdist(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_hamdist_many(PyObject *self, PyObject *args, PyObject *kwargs);
 
 static PyObject * GMPy_MPZ_Invert_Slot(MPZ_Object *self);
 static PyObject * GMPy_MPZ_And_Slot(PyObject *self, PyObject *other);
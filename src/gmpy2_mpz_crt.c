@@ -0,0 +1,461 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_crt.c                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Chinese remaindering with a precomputed basis.
+ *
+ * The product tree is built once when the basis is created. reduce() walks
+ * the tree from the root to the leaves (a remainder tree) and reconstruct()
+ * walks it from the leaves to the root, combining pairs of partial results
+ * with the products stored in the sibling nodes.
+ *
+ * The inverse coefficients c[i] = (M/m[i])^-1 mod m[i] are also computed
+ * with a top-down walk: if node v has cofactor M/P(v) mod P(v), then its
+ * left child L with sibling R has cofactor (M/P(v)) * P(R) mod P(L).
+ *
+ * All tree walks work in place on a single array of count temporaries;
+ * node i on level j+1 only depends on nodes 2i and 2i+1 on level j.
+ */
+
+#define CRT_ROOT(self) ((self)->tree[(self)->off[(self)->levels - 1]])
+
+/* Walk the remainder tree from level 'levels - 1' down to the leaves. On
+ * entry, work[0] contains the value to be reduced modulo the root. On exit,
+ * work[i] contains that value modulo leaf i. If 'sibling' is nonzero, each
+ * child is first multiplied by its sibling node before being reduced; this
+ * is used to compute the cofactors.
+ */
+
+static void
+crt_walk_down(CRTBasis_Object *self, mpz_t *work, int sibling)
+{
+    Py_ssize_t i, s;
+    mpz_t *lvl;
+    int j;
+
+    for (j = self->levels - 2; j >= 0; j--) {
+        lvl = self->tree + self->off[j];
+        for (i = self->len[j] - 1; i >= 0; i--) {
+            s = i ^ 1;
+            if (sibling && s < self->len[j]) {
+                mpz_mul(work[i], work[i >> 1], lvl[s]);
+                mpz_mod(work[i], work[i], lvl[i]);
+            }
+            else {
+                mpz_mod(work[i], work[i >> 1], lvl[i]);
+            }
+        }
+    }
+}
+
+/* Walk the tree from the leaves up to the root. On entry, work[i] contains
+ * the contribution of leaf i. On exit, work[0] contains the sum over all
+ * leaves of work[i] * M / m[i].
+ */
+
+static void
+crt_walk_up(CRTBasis_Object *self, mpz_t *work, mpz_t tmp)
+{
+    Py_ssize_t i;
+    mpz_t *lvl;
+    int j;
+
+    for (j = 0; j < self->levels - 1; j++) {
+        lvl = self->tree + self->off[j];
+        for (i = 0; 2 * i < self->len[j]; i++) {
+            if (2 * i + 1 < self->len[j]) {
+                mpz_mul(tmp, work[2 * i], lvl[2 * i + 1]);
+                mpz_mul(work[i], work[2 * i + 1], lvl[2 * i]);
+                mpz_add(work[i], work[i], tmp);
+            }
+            else {
+                mpz_swap(work[i], work[2 * i]);
+            }
+        }
+    }
+}
+
+static mpz_t *
+crt_alloc(Py_ssize_t n)
+{
+    mpz_t *result;
+    Py_ssize_t i;
+
+    if (!(result = PyMem_New(mpz_t, n))) {
+        return NULL;
+    }
+    for (i = 0; i < n; i++) {
+        mpz_init(result[i]);
+    }
+    return result;
+}
+
+static void
+crt_free(mpz_t *array, Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    if (!array) {
+        return;
+    }
+    for (i = 0; i < n; i++) {
+        mpz_clear(array[i]);
+    }
+    PyMem_Free(array);
+}
+
+PyDoc_STRVAR(GMPy_doc_crtbasis,
+"CRTBasis(moduli, /)\n\n"
+"Return a basis for Chinese remaindering with respect to the given\n"
+"sequence of pairwise coprime positive moduli. The product tree of the\n"
+"moduli and the inverse coefficients are computed once, so repeated\n"
+"conversions with the same moduli are much faster than with separate\n"
+"calls. Raises ValueError if the moduli are not pairwise coprime.");
+
+static PyObject *
+GMPy_CRTBasis_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    CRTBasis_Object *result = NULL;
+    MPZ_Object *temp;
+    PyObject *seq = NULL;
+    mpz_t *work = NULL;
+    Py_ssize_t i, n, total;
+    mpz_t *lvl, *next;
+    int j, ok = 1;
+
+    if ((kwargs && PyDict_Size(kwargs)) || PyTuple_GET_SIZE(args) != 1) {
+        TYPE_ERROR("CRTBasis() requires 1 argument");
+        return NULL;
+    }
+
+    if (!(seq = PySequence_Fast(PyTuple_GET_ITEM(args, 0),
+                                "CRTBasis() requires a sequence of moduli"))) {
+        return NULL;
+    }
+
+    n = PySequence_Fast_GET_SIZE(seq);
+    if (n == 0) {
+        VALUE_ERROR("CRTBasis() requires at least one modulus");
+        Py_DECREF(seq);
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(CRTBasis_Object, &CRTBasis_Type))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(seq);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result->count = n;
+    result->tree = NULL;
+    result->coef = NULL;
+
+    /* Compute the shape of the tree. */
+    result->levels = 0;
+    total = 0;
+    for (i = n; ; i = (i + 1) / 2) {
+        result->off[result->levels] = total;
+        result->len[result->levels] = i;
+        result->levels++;
+        total += i;
+        if (i == 1) {
+            break;
+        }
+    }
+
+    if (!(result->tree = crt_alloc(total)) ||
+        !(result->coef = crt_alloc(n)) ||
+        !(work = crt_alloc(n))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto error;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < n; i++) {
+        if (!(temp = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            TYPE_ERROR("CRTBasis() requires a sequence of integer moduli");
+            goto error;
+        }
+        if (mpz_sgn(temp->z) <= 0) {
+            Py_DECREF((PyObject*)temp);
+            VALUE_ERROR("CRTBasis() moduli must be > 0");
+            goto error;
+        }
+        mpz_set(result->tree[i], temp->z);
+        Py_DECREF((PyObject*)temp);
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    for (j = 0; j < result->levels - 1; j++) {
+        lvl = result->tree + result->off[j];
+        next = result->tree + result->off[j + 1];
+        for (i = 0; 2 * i < result->len[j]; i++) {
+            if (2 * i + 1 < result->len[j]) {
+                mpz_mul(next[i], lvl[2 * i], lvl[2 * i + 1]);
+            }
+            else {
+                mpz_set(next[i], lvl[2 * i]);
+            }
+        }
+    }
+
+    /* The cofactor of the root is 1. */
+    mpz_set_ui(work[0], 1);
+    crt_walk_down(result, work, 1);
+
+    for (i = 0; i < n; i++) {
+        if (mpz_cmp_ui(result->tree[i], 1) == 0) {
+            mpz_set_ui(result->coef[i], 0);
+        }
+        else if (!mpz_invert(result->coef[i], work[i], result->tree[i])) {
+            ok = 0;
+            break;
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    if (!ok) {
+        VALUE_ERROR("CRTBasis() moduli must be pairwise coprime");
+        goto error;
+    }
+
+    crt_free(work, n);
+    Py_DECREF(seq);
+    return (PyObject*)result;
+
+  error:
+    crt_free(work, n);
+    Py_DECREF(seq);
+    Py_DECREF((PyObject*)result);
+    return NULL;
+}
+
+static void
+GMPy_CRTBasis_Dealloc(CRTBasis_Object *self)
+{
+    crt_free(self->tree, self->off[self->levels - 1] + 1);
+    crt_free(self->coef, self->count);
+    PyObject_Free(self);
+}
+
+static PyObject *
+GMPy_CRTBasis_Repr(CRTBasis_Object *self)
+{
+    return PyUnicode_FromFormat("<gmpy2.CRTBasis with %zd moduli>", self->count);
+}
+
+static Py_ssize_t
+GMPy_CRTBasis_Length(CRTBasis_Object *self)
+{
+    return self->count;
+}
+
+PyDoc_STRVAR(GMPy_doc_crtbasis_reconstruct,
+"x.reconstruct(residues, /) -> mpz\n\n"
+"Return the unique integer 0 <= y < x.modulus such that\n"
+"y % m == r for each modulus m in x.moduli and the corresponding r in\n"
+"residues. Will always release the GIL.");
+
+static PyObject *
+GMPy_CRTBasis_Reconstruct(PyObject *self, PyObject *other)
+{
+    CRTBasis_Object *basis = (CRTBasis_Object*)self;
+    MPZ_Object *result = NULL, *temp;
+    PyObject *seq = NULL;
+    mpz_t *work = NULL;
+    Py_ssize_t i, n = basis->count;
+    mpz_t tmp;
+
+    if (!(seq = PySequence_Fast(other, "reconstruct() requires a sequence of residues"))) {
+        return NULL;
+    }
+
+    if (PySequence_Fast_GET_SIZE(seq) != n) {
+        VALUE_ERROR("reconstruct() requires one residue for each modulus");
+        goto cleanup;
+    }
+
+    if (!(work = crt_alloc(n))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < n; i++) {
+        if (!(temp = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            TYPE_ERROR("reconstruct() requires a sequence of integer residues");
+            goto cleanup;
+        }
+        mpz_set(work[i], temp->z);
+        Py_DECREF((PyObject*)temp);
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    mpz_init(tmp);
+    for (i = 0; i < n; i++) {
+        mpz_mul(work[i], work[i], basis->coef[i]);
+        mpz_mod(work[i], work[i], basis->tree[i]);
+    }
+    crt_walk_up(basis, work, tmp);
+    mpz_mod(result->z, work[0], CRT_ROOT(basis));
+    mpz_clear(tmp);
+    Py_END_ALLOW_THREADS;
+
+  cleanup:
+    crt_free(work, n);
+    Py_DECREF(seq);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_crtbasis_reduce,
+"x.reduce(y, /) -> list[mpz, ...]\n\n"
+"Return [y % m for m in x.moduli], computed with a remainder tree.\n"
+"Will always release the GIL.");
+
+static PyObject *
+GMPy_CRTBasis_Reduce(PyObject *self, PyObject *other)
+{
+    CRTBasis_Object *basis = (CRTBasis_Object*)self;
+    MPZ_Object *tempx, *temp;
+    PyObject *result = NULL;
+    mpz_t *work = NULL;
+    Py_ssize_t i, n = basis->count;
+
+    if (!(tempx = GMPy_MPZ_From_Integer(other, NULL))) {
+        TYPE_ERROR("reduce() requires an integer argument");
+        return NULL;
+    }
+
+    if (!(work = crt_alloc(n))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    mpz_mod(work[0], tempx->z, CRT_ROOT(basis));
+    crt_walk_down(basis, work, 0);
+    Py_END_ALLOW_THREADS;
+
+    if (!(result = PyList_New(n))) {
+        /* LCOV_EXCL_START */
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < n; i++) {
+        if (!(temp = GMPy_MPZ_New(NULL))) {
+            /* LCOV_EXCL_START */
+            Py_CLEAR(result);
+            goto cleanup;
+            /* LCOV_EXCL_STOP */
+        }
+        mpz_swap(temp->z, work[i]);
+        PyList_SET_ITEM(result, i, (PyObject*)temp);
+    }
+
+  cleanup:
+    crt_free(work, n);
+    Py_DECREF((PyObject*)tempx);
+    return result;
+}
+
+static PyObject *
+GMPy_CRTBasis_GetModuli(CRTBasis_Object *self, void *closure)
+{
+    MPZ_Object *temp;
+    PyObject *result;
+    Py_ssize_t i;
+
+    if (!(result = PyTuple_New(self->count))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < self->count; i++) {
+        if (!(temp = GMPy_MPZ_New(NULL))) {
+            /* LCOV_EXCL_START */
+            Py_DECREF(result);
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+        mpz_set(temp->z, self->tree[i]);
+        PyTuple_SET_ITEM(result, i, (PyObject*)temp);
+    }
+    return result;
+}
+
+static PyObject *
+GMPy_CRTBasis_GetModulus(CRTBasis_Object *self, void *closure)
+{
+    MPZ_Object *result;
+
+    if ((result = GMPy_MPZ_New(NULL))) {
+        mpz_set(result->z, CRT_ROOT(self));
+    }
+    return (PyObject*)result;
+}
+
+static PyMethodDef GMPy_CRTBasis_methods[] =
+{
+    { "reconstruct", GMPy_CRTBasis_Reconstruct, METH_O, GMPy_doc_crtbasis_reconstruct },
+    { "reduce", GMPy_CRTBasis_Reduce, METH_O, GMPy_doc_crtbasis_reduce },
+    { NULL, NULL, 1 }
+};
+
+static PyGetSetDef GMPy_CRTBasis_getseters[] =
+{
+    { "moduli", (getter)GMPy_CRTBasis_GetModuli, NULL, "the moduli of the basis", NULL },
+    { "modulus", (getter)GMPy_CRTBasis_GetModulus, NULL, "the product of the moduli", NULL },
+    { NULL }
+};
+
+static PySequenceMethods GMPy_CRTBasis_as_sequence =
+{
+    .sq_length = (lenfunc) GMPy_CRTBasis_Length,
+};
+
+static PyTypeObject CRTBasis_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.CRTBasis",
+    .tp_basicsize = sizeof(CRTBasis_Object),
+    .tp_dealloc = (destructor) GMPy_CRTBasis_Dealloc,
+    .tp_repr = (reprfunc) GMPy_CRTBasis_Repr,
+    .tp_as_sequence = &GMPy_CRTBasis_as_sequence,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_crtbasis,
+    .tp_methods = GMPy_CRTBasis_methods,
+    .tp_getset = GMPy_CRTBasis_getseters,
+    .tp_new = GMPy_CRTBasis_NewInit,
+};
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_crt.h                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPZ_CRT_H
+#define GMPY_MPZ_CRT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A CRTBasis stores the product tree of a fixed set of pairwise coprime
+ * moduli. Level 0 of the tree holds the moduli themselves; each node on
+ * level j+1 is the product of two adjacent nodes on level j, with an odd
+ * trailing node carried up unchanged. All levels are stored in a single
+ * array; level j starts at off[j] and contains len[j] nodes.
+ */
+
+#define CRT_MAX_LEVELS (8 * (int)sizeof(Py_ssize_t) + 1)
+
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t count;                /* number of moduli */
+    int levels;                      /* number of levels in the tree */
+    Py_ssize_t off[CRT_MAX_LEVELS];
+    Py_ssize_t len[CRT_MAX_LEVELS];
+    mpz_t *tree;                     /* product tree */
+    mpz_t *coef;                     /* (M/m[i])^-1 mod m[i] */
+} CRTBasis_Object;
+
+static PyTypeObject CRTBasis_Type;
+#define CRTBasis_Check(v) (((PyObject*)v)->ob_type == &CRTBasis_Type)
+
+static PyObject * GMPy_CRTBasis_NewInit(PyTypeObject *type, PyObject *args, PyObject *kwargs);
+static void       GMPy_CRTBasis_Dealloc(CRTBasis_Object *self);
+static PyObject * GMPy_CRTBasis_Repr(CRTBasis_Object *self);
+static Py_ssize_t GMPy_CRTBasis_Length(CRTBasis_Object *self);
+static PyObject * GMPy_CRTBasis_Reconstruct(PyObject *self, PyObject *other);
+static PyObject * GMPy_CRTBasis_Reduce(PyObject *self, PyObject *other);
+static PyObject * GMPy_CRTBasis_GetModuli(CRTBasis_Object *self, void *closure);
+static PyObject * GMPy_CRTBasis_GetModulus(CRTBasis_Object *self, void *closure);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
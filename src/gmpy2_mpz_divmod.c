@@ -82,23 +82,30 @@ GMPy_MPZ_c_divmod(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_c_div,
-"c_div(x, y, /) -> mpz\n\n"
+"c_div(x, y, /, out=None) -> mpz\n\n"
 "Return the quotient of x divided by y. The quotient is rounded\n"
-"towards +Inf (ceiling rounding). x and y must be integers.");
+"towards +Inf (ceiling rounding). x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_c_div(PyObject *self, PyObject *args)
+GMPy_MPZ_c_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *q = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("c_div() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(q = GMPy_MPZ_New(NULL))) {
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "c_div", &out) < 0) {
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(q = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
@@ -122,23 +129,30 @@ GMPy_MPZ_c_div(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_c_mod,
-"c_mod(x, y, /) -> mpz\n\n"
+"c_mod(x, y, /, out=None) -> mpz\n\n"
 "Return the remainder of x divided by y. The remainder will have\n"
-"the opposite sign of y. x and y must be integers.");
+"the opposite sign of y. x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_c_mod(PyObject *self, PyObject *args)
+GMPy_MPZ_c_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *r = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("c_mod() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(r = GMPy_MPZ_New(NULL))) {
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "c_mod", &out) < 0) {
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(r = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
@@ -216,23 +230,30 @@ GMPy_MPZ_f_divmod(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_f_div,
-"f_div(x, y, /) -> mpz\n\n"
+"f_div(x, y, /, out=None) -> mpz\n\n"
 "Return the quotient of x divided by y. The quotient is rounded\n"
-"towards -Inf (floor rounding). x and y must be integers.");
+"towards -Inf (floor rounding). x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_f_div(PyObject *self, PyObject *args)
+GMPy_MPZ_f_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *q = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if(PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("f_div() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(q = GMPy_MPZ_New(NULL))) {
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "f_div", &out) < 0) {
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(q = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
@@ -256,23 +277,30 @@ GMPy_MPZ_f_div(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_f_mod,
-"f_mod(x, y, /) -> mpz\n\n"
+"f_mod(x, y, /, out=None) -> mpz\n\n"
 "Return the remainder of x divided by y. The remainder will have\n"
-"the same sign as y. x and y must be integers.");
+"the same sign as y. x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_f_mod(PyObject *self, PyObject *args)
+GMPy_MPZ_f_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *r = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("f_mod() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(r = GMPy_MPZ_New(NULL))) {
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "f_mod", &out) < 0) {
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(r = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
@@ -350,26 +378,30 @@ GMPy_MPZ_t_divmod(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_t_div,
-"t_div(x, y, /) -> mpz\n\n"
+"t_div(x, y, /, out=None) -> mpz\n\n"
 "Return the quotient of x divided by y. The quotient is rounded\n"
-"towards 0. x and y must be integers.");
+"towards 0. x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_t_div(PyObject *self, PyObject *args)
+GMPy_MPZ_t_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *q = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("t_div() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "t_div", &out) < 0) {
+        return NULL;
+    }
 
-
-
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(q = GMPy_MPZ_New(NULL))) {
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(q = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
@@ -393,23 +425,30 @@ GMPy_MPZ_t_div(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_t_mod,
-"t_mod(x, y, /) -> mpz\n\n"
+"t_mod(x, y, /, out=None) -> mpz\n\n"
 "Return the remainder of x divided by y. The remainder will have\n"
-"the same sign as x. x and y must be integers.");
+"the same sign as x. x and y must be integers.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_t_mod(PyObject *self, PyObject *args)
+GMPy_MPZ_t_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames)
 {
     MPZ_Object *r = NULL, *tempx = NULL, *tempy = NULL;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("t_mod() requires 'mpz','mpz' arguments");
         return NULL;
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL)) ||
-        !(tempy = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL)) ||
-        !(r = GMPy_MPZ_New(NULL))) {
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "t_mod", &out) < 0) {
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempy = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(r = GMPy_MPZ_NewOut(out, NULL))) {
 
         goto err;
     }
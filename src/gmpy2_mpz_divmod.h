@@ -32,14 +32,14 @@ extern "C" {
 #endif
 
 static PyObject * GMPy_MPZ_c_divmod(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_c_div(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_c_mod(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_c_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_c_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_f_divmod(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_f_div(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_f_mod(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_f_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_f_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_t_divmod(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_t_div(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_t_mod(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_t_div(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_t_mod(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 
 #ifdef __cplusplus
 }
@@ -80,28 +80,35 @@ GMPy_MPZ_c_divmod_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_c_div_2exp,
-"c_div_2exp(x, n, /) -> mpz\n\n"
+"c_div_2exp(x, n, /, out=None) -> mpz\n\n"
 "Returns the quotient of x divided by 2**n. The quotient is rounded\n"
-"towards +Inf (ceiling rounding). x must be an integer. n must be >0.");
+"towards +Inf (ceiling rounding). x must be an integer. n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_c_div_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_c_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("c_div_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "c_div_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
@@ -114,28 +121,35 @@ GMPy_MPZ_c_div_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_c_mod_2exp,
-"c_mod_2exp(x, n, /) -> mpz\n\n"
+"c_mod_2exp(x, n, /, out=None) -> mpz\n\n"
 "Return the remainder of x divided by 2**n. The remainder will be\n"
-"negative. x must be an integer. n must be >0.");
+"negative. x must be an integer. n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_c_mod_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_c_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("c_mod_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "c_mod_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
@@ -198,28 +212,35 @@ GMPy_MPZ_f_divmod_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_f_div_2exp,
-"f_div_2exp(x, n, /) -> mpz\n\n"
+"f_div_2exp(x, n, /, out=None) -> mpz\n\n"
 "Return the quotient of x divided by 2**n. The quotient is rounded\n"
-"towards -Inf (floor rounding). x must be an integer. n must be >0.");
+"towards -Inf (floor rounding). x must be an integer. n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_f_div_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_f_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("f_div_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "f_div_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
@@ -232,28 +253,35 @@ GMPy_MPZ_f_div_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_f_mod_2exp,
-"f_mod_2exp(x, n, /) -> mpz\n\n"
+"f_mod_2exp(x, n, /, out=None) -> mpz\n\n"
 "Return remainder of x divided by 2**n. The remainder will be\n"
-"positive. x must be an integer. n must be >0.");
+"positive. x must be an integer. n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_f_mod_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_f_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("f_mod_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "f_mod_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
@@ -316,28 +344,35 @@ GMPy_MPZ_t_divmod_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_t_div_2exp,
-"t_div_2exp(x, n, /) -> mpz\n\n"
+"t_div_2exp(x, n, /, out=None) -> mpz\n\n"
 "Return the quotient of x divided by 2**n. The quotient is rounded\n"
-"towards zero (truncation). n must be >0.");
+"towards zero (truncation). n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_t_div_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_t_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("t_div_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "t_div_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
@@ -350,28 +385,35 @@ GMPy_MPZ_t_div_2exp(PyObject *self, PyObject *args)
 }
 
 PyDoc_STRVAR(doc_t_mod_2exp,
-"t_mod_2exp(x, n, /) -> mpz\n\n"
+"t_mod_2exp(x, n, /, out=None) -> mpz\n\n"
 "Return the remainder of x divided by 2**n. The remainder will have\n"
-"the same sign as x. x must be an integer. n must be >0.");
+"the same sign as x. x must be an integer. n must be >0.\n"
+"If out is an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_t_mod_2exp(PyObject *self, PyObject *args)
+GMPy_MPZ_t_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
     mp_bitcnt_t nbits;
     MPZ_Object *result, *tempx;
+    PyObject *out;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (nargs != 2) {
         TYPE_ERROR("t_mod_2exp() requires 'mpz','int' arguments");
         return NULL;
     }
 
-    nbits = GMPy_Integer_AsMpBitCnt(PyTuple_GET_ITEM(args, 1));
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "t_mod_2exp", &out) < 0) {
+        return NULL;
+    }
+
+    nbits = GMPy_Integer_AsMpBitCnt(args[1]);
     if (nbits == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    result = GMPy_MPZ_New(NULL);
+    tempx = GMPy_MPZ_From_Integer(args[0], NULL);
+    result = GMPy_MPZ_NewOut(out, NULL);
     if (!tempx || !result) {
         Py_XDECREF((PyObject*)result);
         Py_XDECREF((PyObject*)tempx);
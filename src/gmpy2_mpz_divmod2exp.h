@@ -32,14 +32,14 @@ extern "C" {
 #endif
 
 static PyObject * GMPy_MPZ_c_divmod_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_c_div_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_c_mod_2exp(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_c_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_c_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_f_divmod_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_f_div_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_f_mod_2exp(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_f_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_f_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_t_divmod_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_t_div_2exp(PyObject *self, PyObject *args);
-static PyObject * GMPy_MPZ_t_mod_2exp(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_t_div_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_t_mod_2exp(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 
 #ifdef __cplusplus
 }
@@ -302,18 +302,25 @@ GMPy_MPZ_NonZero_Slot(MPZ_Object *self)
 /* Miscellaneous gmpy functions */
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_gcd,
-"gcd(*integers, /) -> mpz\n\n"
-"Return the greatest common divisor of integers.");
+"gcd(*integers, out=None) -> mpz\n\n"
+"Return the greatest common divisor of integers. If out is an `xmpz`,\n"
+"the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_GCD(PyObject *self, PyObject * const *args, Py_ssize_t nargs)
+GMPy_MPZ_Function_GCD(PyObject *self, PyObject * const *args, Py_ssize_t nargs,
+                      PyObject *kwnames)
 {
     MPZ_Object *arg, *result = NULL;
     CTXT_Object *context = NULL;
+    PyObject *out;
     Py_ssize_t i;
 
     CHECK_CONTEXT(context);
 
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "gcd", &out) < 0) {
+        return NULL;
+    }
+
     if (!(result = GMPy_MPZ_New(context))) {
         /* LCOV_EXCL_START */
         return NULL;
@@ -336,22 +343,29 @@ GMPy_MPZ_Function_GCD(PyObject *self, PyObject * const *args, Py_ssize_t nargs)
 
         Py_DECREF((PyObject*)arg);
     }
-    return (PyObject*)result;
+    return GMPy_MPZ_SetOut(result, out);
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_lcm,
-"lcm(*integers, /) -> mpz\n\n"
-"Return the lowest common multiple of integers.");
+"lcm(*integers, out=None) -> mpz\n\n"
+"Return the lowest common multiple of integers. If out is an `xmpz`,\n"
+"the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_LCM(PyObject *self, PyObject * const *args, Py_ssize_t nargs)
+GMPy_MPZ_Function_LCM(PyObject *self, PyObject * const *args, Py_ssize_t nargs,
+                      PyObject *kwnames)
 {
     MPZ_Object *arg, *result = NULL;
     CTXT_Object *context = NULL;
+    PyObject *out;
     Py_ssize_t i;
 
     CHECK_CONTEXT(context);
 
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "lcm", &out) < 0) {
+        return NULL;
+    }
+
     if (!(result = GMPy_MPZ_New(context))) {
         /* LCOV_EXCL_START */
         return NULL;
@@ -374,7 +388,7 @@ GMPy_MPZ_Function_LCM(PyObject *self, PyObject * const *args, Py_ssize_t nargs)
 
         Py_DECREF((PyObject*)arg);
     }
-    return (PyObject*)result;
+    return GMPy_MPZ_SetOut(result, out);
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_gcdext,
@@ -534,81 +548,119 @@ GMPy_MPZ_Function_Divm(PyObject *self, PyObject * const *args,
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_fac,
-"fac(n, /) -> mpz\n\n"
-"Return the exact factorial of n.\n\n"
+"fac(n, /, out=None) -> mpz\n\n"
+"Return the exact factorial of n. If out is an `xmpz`, the result is\n"
+"stored in out and out is returned.\n\n"
 "See factorial(n) to get the floating-point approximation.");
 
 static PyObject *
-GMPy_MPZ_Function_Fac(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_Fac(PyObject *self, PyObject *const *args,
+                      Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long n;
 
-    n = GMPy_Integer_AsUnsignedLong(other);
+    if (nargs != 1) {
+        TYPE_ERROR("fac() requires 1 integer argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "fac", &out) < 0) {
+        return NULL;
+    }
+
+    n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_fac_ui(result->z, n);
     }
     return (PyObject*)result;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_double_fac,
-"double_fac(n, /) -> mpz\n\n"
+"double_fac(n, /, out=None) -> mpz\n\n"
 "Return the exact double factorial (n!!) of n. The double\n"
-"factorial is defined as n*(n-2)*(n-4)...");
+"factorial is defined as n*(n-2)*(n-4)... If out is an `xmpz`, the\n"
+"result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_DoubleFac(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_DoubleFac(PyObject *self, PyObject *const *args,
+                            Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long n;
 
-    n = GMPy_Integer_AsUnsignedLong(other);
+    if (nargs != 1) {
+        TYPE_ERROR("double_fac() requires 1 integer argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "double_fac", &out) < 0) {
+        return NULL;
+    }
+
+    n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_2fac_ui(result->z, n);
     }
     return (PyObject*)result;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_primorial,
-"primorial(n, /) -> mpz\n\n"
+"primorial(n, /, out=None) -> mpz\n\n"
 "Return the product of all positive prime numbers less than or\n"
-"equal to n.");
+"equal to n. If out is an `xmpz`, the result is stored in out and out\n"
+"is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_Primorial(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_Primorial(PyObject *self, PyObject *const *args,
+                            Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long n;
 
-    n = GMPy_Integer_AsUnsignedLong(other);
+    if (nargs != 1) {
+        TYPE_ERROR("primorial() requires 1 integer argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "primorial", &out) < 0) {
+        return NULL;
+    }
+
+    n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_primorial_ui(result->z, n);
     }
     return (PyObject*)result;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_multi_fac,
-"multi_fac(n,m,/) -> mpz\n\n"
+"multi_fac(n,m,/, out=None) -> mpz\n\n"
 "Return the exact m-multi factorial of n. The m-multi"
-"factorial is defined as n*(n-m)*(n-2m)...");
+"factorial is defined as n*(n-m)*(n-2m)... If out is an `xmpz`, the\n"
+"result is stored in out and out is returned.");
 
 static PyObject *
 GMPy_MPZ_Function_MultiFac(PyObject *self, PyObject *const *args,
-                           Py_ssize_t nargs)
+                           Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long n, m;
 
     if (nargs != 2) {
@@ -616,6 +668,10 @@ GMPy_MPZ_Function_MultiFac(PyObject *self, PyObject *const *args,
         return NULL;
     }
 
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "multi_fac", &out) < 0) {
+        return NULL;
+    }
+
     n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
@@ -626,27 +682,39 @@ GMPy_MPZ_Function_MultiFac(PyObject *self, PyObject *const *args,
         return NULL;
     }
 
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_mfac_uiui(result->z, n, m);
     }
     return (PyObject*)result;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_fib,
-"fib(n, /) -> mpz\n\n"
-"Return the n-th Fibonacci number.");
+"fib(n, /, out=None) -> mpz\n\n"
+"Return the n-th Fibonacci number. If out is an `xmpz`, the result is\n"
+"stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_Fib(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_Fib(PyObject *self, PyObject *const *args,
+                      Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long  n;
 
-    n = GMPy_Integer_AsUnsignedLong(other);
+    if (nargs != 1) {
+        TYPE_ERROR("fib() requires 1 integer argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "fib", &out) < 0) {
+        return NULL;
+    }
+
+    n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
     }
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_fib_ui(result->z, n);
     }
     return (PyObject*)result;
@@ -687,21 +755,33 @@ GMPy_MPZ_Function_Fib2(PyObject *self, PyObject *other)
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_lucas,
-"lucas(n, /) -> mpz\n\n"
-"Return the n-th Lucas number.");
+"lucas(n, /, out=None) -> mpz\n\n"
+"Return the n-th Lucas number. If out is an `xmpz`, the result is\n"
+"stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_Lucas(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_Lucas(PyObject *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL;
+    PyObject *out;
     unsigned long n;
 
-    n = GMPy_Integer_AsUnsignedLong(other);
+    if (nargs != 1) {
+        TYPE_ERROR("lucas() requires 1 integer argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "lucas", &out) < 0) {
+        return NULL;
+    }
+
+    n = GMPy_Integer_AsUnsignedLong(args[0]);
     if (n == (unsigned long)(-1) && PyErr_Occurred()) {
         return NULL;
     }
 
-    if ((result = GMPy_MPZ_New(NULL))) {
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
         mpz_lucnum_ui(result->z, n);
     }
     return (PyObject*)result;
@@ -742,19 +822,22 @@ GMPy_MPZ_Function_Lucas2(PyObject *self, PyObject *other)
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_bincoef,
-"bincoef(n, k, /) -> mpz\n\n"
-"Return the binomial coefficient ('n choose k'). k >= 0.");
+"bincoef(n, k, /, out=None) -> mpz\n\n"
+"Return the binomial coefficient ('n choose k'). k >= 0. If out is an\n"
+"`xmpz`, the result is stored in out and out is returned.");
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_comb,
-"comb(n, k, /) -> mpz\n\n"
+"comb(n, k, /, out=None) -> mpz\n\n"
 "Return the number of combinations of 'n things, taking k at a\n"
-"time'. k >= 0. Same as bincoef(n, k)");
+"time'. k >= 0. Same as bincoef(n, k). If out is an `xmpz`, the result\n"
+"is stored in out and out is returned.");
 
 static PyObject *
 GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject * const *args,
-                          Py_ssize_t nargs)
+                          Py_ssize_t nargs, PyObject *kwnames)
 {
     MPZ_Object *result = NULL, *tempx;
+    PyObject *out;
     unsigned long n, k;
 
     if (nargs != 2) {
@@ -762,15 +845,12 @@ GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject * const *args,
         return NULL;
     }
 
-    if (!(result = GMPy_MPZ_New(NULL))) {
-        /* LCOV_EXCL_START */
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "bincoef", &out) < 0) {
         return NULL;
-        /* LCOV_EXCL_STOP */
     }
 
     k = GMPy_Integer_AsUnsignedLong(args[1]);
     if (k == (unsigned long)(-1) && PyErr_Occurred()) {
-        Py_DECREF((PyObject*)result);
         return NULL;
     }
 
@@ -783,49 +863,747 @@ GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject * const *args,
     }
     else {
         /* Use mpz_bin_uiui which should be faster. */
-        mpz_bin_uiui(result->z, n, k);
+        if ((result = GMPy_MPZ_NewOut(out, NULL))) {
+            mpz_bin_uiui(result->z, n, k);
+        }
         return (PyObject*)result;
     }
 
     if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL))) {
-        Py_DECREF((PyObject*)result);
         return NULL;
     }
 
-    mpz_bin_ui(result->z, tempx->z, k);
+    if ((result = GMPy_MPZ_NewOut(out, NULL))) {
+        mpz_bin_ui(result->z, tempx->z, k);
+    }
+    Py_DECREF((PyObject*)tempx);
+    return (PyObject*)result;
+}
+
+/* Cached table of small primes.
+ *
+ * global.primes holds every prime <= global.primes_limit. The table is
+ * thread-local, like the object caches, so it can be read while the GIL
+ * is released. It must be extended with the GIL held.
+ *
+ * The table is owned by a capsule stored in the thread state dict, so it
+ * is released when the thread exits (or the interpreter is finalized) and
+ * by free_cache().
+ */
+
+#define PRIMES_CAPSULE "gmpy2.primes"
+
+static void
+gmpy_primes_capsule_free(PyObject *capsule)
+{
+    unsigned long *primes = PyCapsule_GetPointer(capsule, PRIMES_CAPSULE);
+
+    if (global.primes == primes) {
+        global.primes = NULL;
+        global.in_primes = 0;
+        global.primes_limit = 0;
+    }
+    PyMem_RawFree(primes);
+}
+
+static void
+GMPy_Primes_Free_Cache(void)
+{
+    PyObject *dict;
+
+    if (global.primes && (dict = PyThreadState_GetDict())) {
+        /* Deleting the capsule frees the table and resets global. */
+        if (PyDict_DelItemString(dict, PRIMES_CAPSULE) < 0) {
+            /* LCOV_EXCL_START */
+            PyErr_Clear();
+            /* LCOV_EXCL_STOP */
+        }
+    }
+}
+
+#define PRIME_TABLE_MAX (1UL << 24)
+
+static int
+gmpy_primes_upto(unsigned long limit)
+{
+    unsigned long i, j, *primes;
+    Py_ssize_t count = 0;
+    PyObject *dict, *capsule;
+    char *sieve;
+    int rc;
+
+    if (limit <= global.primes_limit)
+        return 1;
+
+    /* Grow geometrically so repeated calls share the sieving work. */
+    if (limit < 2 * global.primes_limit)
+        limit = 2 * global.primes_limit;
+    if (limit < 1024)
+        limit = 1024;
+    if (limit > PRIME_TABLE_MAX)
+        limit = PRIME_TABLE_MAX;
+
+    if (!(sieve = PyMem_Calloc(limit + 1, 1))) {
+        PyErr_NoMemory();
+        return 0;
+    }
+
+    for (i = 2; i * i <= limit; i++) {
+        if (!sieve[i]) {
+            for (j = i * i; j <= limit; j += i)
+                sieve[j] = 1;
+        }
+    }
+    for (i = 2; i <= limit; i++) {
+        if (!sieve[i])
+            count++;
+    }
+
+    if (!(primes = PyMem_RawMalloc(count * sizeof(unsigned long)))) {
+        PyMem_Free(sieve);
+        PyErr_NoMemory();
+        return 0;
+    }
+    for (i = 2, count = 0; i <= limit; i++) {
+        if (!sieve[i])
+            primes[count++] = i;
+    }
+    PyMem_Free(sieve);
+
+    if (!(dict = PyThreadState_GetDict())) {
+        /* LCOV_EXCL_START */
+        PyMem_RawFree(primes);
+        SYSTEM_ERROR("no thread state for the prime table");
+        return 0;
+        /* LCOV_EXCL_STOP */
+    }
+    if (!(capsule = PyCapsule_New(primes, PRIMES_CAPSULE, gmpy_primes_capsule_free))) {
+        /* LCOV_EXCL_START */
+        PyMem_RawFree(primes);
+        return 0;
+        /* LCOV_EXCL_STOP */
+    }
+    /* Replacing the previous capsule frees the previous table. */
+    rc = PyDict_SetItemString(dict, PRIMES_CAPSULE, capsule);
+    Py_DECREF(capsule);
+    if (rc < 0) {
+        /* LCOV_EXCL_START */
+        return 0;
+        /* LCOV_EXCL_STOP */
+    }
+
+    global.primes = primes;
+    global.in_primes = count;
+    global.primes_limit = limit;
+    return 1;
+}
+
+/* Set r to the product of the count consecutive integers start, start+1,
+ * ..., using a balanced product tree. start must be positive.
+ */
+
+#define RANGE_PRODUCT_LEAF 32
+
+static void
+range_product_tree(mpz_t r, const mpz_t start, unsigned long count)
+{
+    unsigned long x, acc, i, half;
+    mpz_t mid, tmp;
+
+    if (count <= RANGE_PRODUCT_LEAF) {
+        mpz_set_ui(r, 1);
+        if (mpz_fits_ulong_p(start) && mpz_get_ui(start) <= ULONG_MAX - count) {
+            /* Pack as many factors as possible into a single limb. */
+            x = mpz_get_ui(start);
+            for (i = 0, acc = 1; i < count; i++, x++) {
+                if (acc > ULONG_MAX / x) {
+                    mpz_mul_ui(r, r, acc);
+                    acc = 1;
+                }
+                acc *= x;
+            }
+            mpz_mul_ui(r, r, acc);
+        }
+        else {
+            mpz_init_set(tmp, start);
+            for (i = 0; i < count; i++) {
+                mpz_mul(r, r, tmp);
+                mpz_add_ui(tmp, tmp, 1);
+            }
+            mpz_clear(tmp);
+        }
+        return;
+    }
+
+    half = count / 2;
+    mpz_init(mid);
+    mpz_init(tmp);
+    mpz_add_ui(mid, start, half);
+    range_product_tree(r, start, half);
+    range_product_tree(tmp, mid, count - half);
+    mpz_mul(r, r, tmp);
+    mpz_clear(mid);
+    mpz_clear(tmp);
+}
+
+/* Set r to start * (start+1) * ... * (start+count-1) for any start. r and
+ * start may be the same variable.
+ */
+
+static void
+range_product(mpz_t r, const mpz_t start, unsigned long count)
+{
+    mpz_t first, last;
+
+    if (count == 0) {
+        mpz_set_ui(r, 1);
+        return;
+    }
+
+    mpz_init_set(first, start);
+    mpz_init(last);
+    mpz_add_ui(last, first, count - 1);
+
+    if (mpz_cmp_ui(first, 1) == 0) {
+        mpz_fac_ui(r, count);
+    }
+    else if (mpz_sgn(first) > 0) {
+        range_product_tree(r, first, count);
+    }
+    else if (mpz_sgn(last) >= 0) {
+        mpz_set_ui(r, 0);
+    }
+    else {
+        /* All factors are negative. */
+        mpz_neg(last, last);
+        range_product_tree(r, last, count);
+        if (count & 1)
+            mpz_neg(r, r);
+    }
+    mpz_clear(first);
+    mpz_clear(last);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_range_product,
+"range_product(a, b, /) -> mpz\n\n"
+"Return the product of the integers in range(a, b), computed with a\n"
+"balanced product tree. Returns 1 if the range is empty. Will always\n"
+"release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_RangeProduct(PyObject *self, PyObject * const *args,
+                               Py_ssize_t nargs)
+{
+    MPZ_Object *result = NULL, *tempa = NULL, *tempb = NULL;
+    unsigned long count = 0;
+
+    if (nargs != 2) {
+        TYPE_ERROR("range_product() requires 'mpz','mpz' arguments");
+        return NULL;
+    }
+
+    if (!(tempa = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempb = GMPy_MPZ_From_Integer(args[1], NULL))) {
+        TYPE_ERROR("range_product() requires 'mpz','mpz' arguments");
+        goto cleanup;
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL)))
+        goto cleanup;
+
+    if (mpz_cmp(tempb->z, tempa->z) > 0) {
+        mpz_sub(result->z, tempb->z, tempa->z);
+        if (!mpz_fits_ulong_p(result->z)) {
+            OVERFLOW_ERROR("range_product() range too large");
+            Py_CLEAR(result);
+            goto cleanup;
+        }
+        count = mpz_get_ui(result->z);
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    range_product(result->z, tempa->z, count);
+    Py_END_ALLOW_THREADS;
+
+  cleanup:
+    Py_XDECREF((PyObject*)tempa);
+    Py_XDECREF((PyObject*)tempb);
+    return (PyObject*)result;
+}
+
+/* Shared implementation of falling_factorial() and rising_factorial(). */
+
+static PyObject *
+falling_rising_factorial(PyObject * const *args, Py_ssize_t nargs, int falling,
+                         const char *name)
+{
+    MPZ_Object *result = NULL, *tempx;
+    unsigned long k;
+
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 'mpz','int' arguments", name);
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(args[0], NULL))) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 'mpz','int' arguments", name);
+        return NULL;
+    }
+
+    k = GMPy_Integer_AsUnsignedLong(args[1]);
+    if (k == (unsigned long)(-1) && PyErr_Occurred()) {
+        Py_DECREF((PyObject*)tempx);
+        return NULL;
+    }
+
+    if ((result = GMPy_MPZ_New(NULL))) {
+        Py_BEGIN_ALLOW_THREADS;
+        if (falling && k > 0) {
+            /* x*(x-1)*...*(x-k+1) is the product of range(x-k+1, x+1). */
+            mpz_sub_ui(result->z, tempx->z, k - 1);
+            range_product(result->z, result->z, k);
+        }
+        else {
+            range_product(result->z, tempx->z, k);
+        }
+        Py_END_ALLOW_THREADS;
+    }
     Py_DECREF((PyObject*)tempx);
     return (PyObject*)result;
 }
 
+PyDoc_STRVAR(GMPy_doc_mpz_function_falling_factorial,
+"falling_factorial(x, k, /) -> mpz\n\n"
+"Return x*(x-1)*...*(x-k+1). k >= 0. Will always release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_FallingFactorial(PyObject *self, PyObject * const *args,
+                                   Py_ssize_t nargs)
+{
+    return falling_rising_factorial(args, nargs, 1, "falling_factorial");
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_rising_factorial,
+"rising_factorial(x, k, /) -> mpz\n\n"
+"Return x*(x+1)*...*(x+k-1). k >= 0. Will always release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_RisingFactorial(PyObject *self, PyObject * const *args,
+                                  Py_ssize_t nargs)
+{
+    return falling_rising_factorial(args, nargs, 0, "rising_factorial");
+}
+
+/* Binomial coefficients modulo m.
+ *
+ * If n <= PRIME_TABLE_MAX, the exponent of every prime q <= n in
+ * C(n,k) is the number of carries when adding k and n-k in base q
+ * (Kummer), so C(n,k) mod m is computed from the cached prime table.
+ *
+ * Otherwise m is factored by trial division. Prime factors q use Lucas'
+ * theorem and prime power factors q^e use Granville's generalization,
+ * and the results are combined with the CRT. If m cannot be factored, or a
+ * prime power factor is too large, C(n,k) is computed exactly.
+ *
+ * All of this runs with the GIL released, so every path is bounded: Lucas'
+ * theorem may use at most LUCAS_MAX multiplications in total, Granville's
+ * table at most GRANVILLE_MAX entries, and the exact fallback is only used
+ * when C(n, min(k, n-k)) has at most about BINCOEF_EXACT_MAX bits. Larger
+ * arguments raise OverflowError. For n <= PRIME_TABLE_MAX the Kummer
+ * product is reduced modulo m as it grows, which is quadratic in the size
+ * of m, so for m longer than KUMMER_MAX_BITS C(n,k) is computed exactly.
+ */
+
+#define GRANVILLE_MAX (1UL << 20)
+#define LUCAS_MAX (1UL << 20)
+#define BINCOEF_EXACT_MAX (1UL << 20)
+#define KUMMER_MAX_BITS (1UL << 14)
+
+static void
+bincoef_mod_kummer(mpz_t r, unsigned long n, unsigned long k, const mpz_t m)
+{
+    unsigned long q, x, y, z, e, pw;
+    size_t limit = 2 * mpz_sizeinbase(m, 2) + 64;
+    Py_ssize_t i;
+
+    mpz_set_ui(r, 1);
+    for (i = 0; i < global.in_primes && (q = global.primes[i]) <= n; i++) {
+        e = 0;
+        for (x = n / q, y = k / q, z = (n - k) / q; x; x /= q, y /= q, z /= q)
+            e += x - y - z;
+        if (e == 0)
+            continue;
+        for (pw = q; --e > 0 && pw <= ULONG_MAX / q; )
+            pw *= q;
+        mpz_mul_ui(r, r, pw);
+        for (; e > 0; e--)
+            mpz_mul_ui(r, r, q);
+        if (mpz_sizeinbase(r, 2) > limit)
+            mpz_mod(r, r, m);
+    }
+    mpz_mod(r, r, m);
+}
+
+/* Exponent of the prime q in C(n,k), given n-k in nk. */
+
+static unsigned long
+bincoef_valuation(const mpz_t n, const mpz_t k, const mpz_t nk, const mpz_t q)
+{
+    unsigned long e = 0;
+    mpz_t x, y, z, t;
+
+    mpz_inits(x, y, z, t, NULL);
+    mpz_fdiv_q(x, n, q);
+    mpz_fdiv_q(y, k, q);
+    mpz_fdiv_q(z, nk, q);
+    while (mpz_sgn(x) > 0) {
+        /* Each step adds 1 if there is a carry into this digit. */
+        mpz_sub(t, x, y);
+        mpz_sub(t, t, z);
+        e += mpz_get_ui(t);
+        mpz_fdiv_q(x, x, q);
+        mpz_fdiv_q(y, y, q);
+        mpz_fdiv_q(z, z, q);
+    }
+    mpz_clears(x, y, z, t, NULL);
+    return e;
+}
+
+/* C(n,k) mod q for a prime q, by Lucas' theorem. Each digit costs
+ * min(ki, ni-ki) multiplications, which are charged to *work. Returns 0
+ * if the total would exceed LUCAS_MAX.
+ */
+
+static int
+bincoef_mod_lucas(mpz_t r, const mpz_t n, const mpz_t k, const mpz_t q,
+                  unsigned long *work)
+{
+    mpz_t x, y, ni, ki, num, den;
+    unsigned long j, kk;
+    int ok = 1;
+
+    mpz_inits(x, y, ni, ki, num, den, NULL);
+    mpz_set(x, n);
+    mpz_set(y, k);
+    mpz_set_ui(r, 1);
+
+    while (ok && mpz_sgn(y) > 0 && mpz_sgn(r) != 0) {
+        mpz_fdiv_qr(x, ni, x, q);
+        mpz_fdiv_qr(y, ki, y, q);
+        if (mpz_cmp(ki, ni) > 0) {
+            mpz_set_ui(r, 0);
+            break;
+        }
+        /* C(ni, ki) = C(ni, ni-ki) */
+        mpz_sub(den, ni, ki);
+        if (mpz_cmp(den, ki) < 0)
+            mpz_swap(den, ki);
+        if (!mpz_fits_ulong_p(ki) || mpz_get_ui(ki) > LUCAS_MAX - *work) {
+            ok = 0;
+            break;
+        }
+        kk = mpz_get_ui(ki);
+        *work += kk;
+        mpz_set_ui(num, 1);
+        mpz_set_ui(den, 1);
+        for (j = 0; j < kk; j++) {
+            mpz_sub_ui(ki, ni, j);
+            mpz_mul(num, num, ki);
+            mpz_mod(num, num, q);
+            mpz_mul_ui(den, den, j + 1);
+            mpz_mod(den, den, q);
+        }
+        mpz_invert(den, den, q);
+        mpz_mul(r, r, num);
+        mpz_mul(r, r, den);
+        mpz_mod(r, r, q);
+    }
+    mpz_clears(x, y, ni, ki, num, den, NULL);
+    return ok;
+}
+
+/* Product of the integers <= x that are not divisible by q, taken over
+ * x, x/q, x/q^2, ... modulo P = q^e. This is x! with all factors of q
+ * removed, modulo P. prefix[i] is the product of the integers <= i that
+ * are coprime to q, modulo P.
+ */
+
+static unsigned long long
+granville_factorial(const mpz_t x, unsigned long q, unsigned long P,
+                    const unsigned long *prefix)
+{
+    unsigned long long result = 1;
+    int neg = 0;
+    mpz_t y, b;
+
+    mpz_init_set(y, x);
+    mpz_init(b);
+    while (mpz_sgn(y) > 0) {
+        /* The product of the units modulo P is -1, except when P = 2^e
+         * with e >= 3.
+         */
+        result = result * prefix[mpz_fdiv_q_ui(b, y, P)] % P;
+        if ((q != 2 || P == 4) && mpz_odd_p(b))
+            neg ^= 1;
+        mpz_fdiv_q_ui(y, y, q);
+    }
+    mpz_clear(y);
+    mpz_clear(b);
+    return neg ? (P - result) % P : result;
+}
+
+static void
+bincoef_mod_granville(mpz_t r, const mpz_t n, const mpz_t k, const mpz_t nk,
+                      unsigned long q, unsigned long v, unsigned long P,
+                      unsigned long *prefix)
+{
+    unsigned long long num, den;
+    unsigned long i;
+    mpz_t t;
+
+    /* The table is rebuilt on every call rather than cached: it costs at
+     * most GRANVILLE_MAX multiplications, a few milliseconds, while a cache
+     * would keep up to GRANVILLE_MAX words alive in every thread.
+     */
+    prefix[0] = 1;
+    for (i = 1; i < P; i++)
+        prefix[i] = (i % q) ? (unsigned long)((unsigned long long)prefix[i - 1] * i % P)
+                            : prefix[i - 1];
+
+    num = granville_factorial(n, q, P, prefix);
+    den = granville_factorial(k, q, P, prefix) * granville_factorial(nk, q, P, prefix) % P;
+
+    mpz_init_set_ui(t, P);
+    mpz_set_ui(r, (unsigned long)den);
+    mpz_invert(r, r, t);
+    mpz_mul_ui(r, r, (unsigned long)num);
+    for (i = 0; i < v; i++)
+        mpz_mul_ui(r, r, q);
+    mpz_mod(r, r, t);
+    mpz_clear(t);
+}
+
+/* Returns 1 on success, 0 if the caller must compute C(n,k) exactly, and
+ * -1 on a memory error.
+ */
+
+static int
+bincoef_mod_factored(mpz_t r, const mpz_t n, const mpz_t k, const mpz_t m)
+{
+    mpz_t c, nk, q, qe, res, crt;
+    unsigned long *prefix = NULL, e, v, pr = 0, work = 0;
+    Py_ssize_t i;
+    int ok = 1, last = 0;
+
+    mpz_inits(c, nk, q, qe, res, crt, NULL);
+    mpz_set(c, m);
+    mpz_sub(nk, n, k);
+    mpz_set_ui(r, 0);
+    mpz_set_ui(crt, 1);
+
+    for (i = 0; ok && mpz_cmp_ui(c, 1) > 0; i++) {
+        /* Find the next prime power factor q^e of m. */
+        if (i < global.in_primes) {
+            pr = global.primes[i];
+            if (!mpz_divisible_ui_p(c, pr))
+                continue;
+            mpz_set_ui(q, pr);
+            e = (unsigned long)mpz_remove(c, c, q);
+        }
+        else if (mpz_probab_prime_p(c, 25)) {
+            mpz_swap(q, c);
+            mpz_set_ui(c, 1);
+            e = 1;
+            last = 1;
+        }
+        else {
+            ok = 0;
+            break;
+        }
+
+        mpz_pow_ui(qe, q, e);
+        v = bincoef_valuation(n, k, nk, q);
+        if (v >= e) {
+            mpz_set_ui(res, 0);
+        }
+        else if (e == 1) {
+            if (!bincoef_mod_lucas(res, n, k, q, &work)) {
+                ok = 0;
+                break;
+            }
+        }
+        else if (!last && mpz_cmp_ui(qe, GRANVILLE_MAX) <= 0) {
+            if (!(prefix = PyMem_RawMalloc(mpz_get_ui(qe) * sizeof(unsigned long)))) {
+                ok = -1;
+                break;
+            }
+            bincoef_mod_granville(res, n, k, nk, pr, v, mpz_get_ui(qe), prefix);
+            PyMem_RawFree(prefix);
+            prefix = NULL;
+        }
+        else {
+            ok = 0;
+            break;
+        }
+
+        /* Combine r mod crt with res mod qe. */
+        mpz_sub(res, res, r);
+        mpz_invert(q, crt, qe);
+        mpz_mul(res, res, q);
+        mpz_mod(res, res, qe);
+        mpz_addmul(r, res, crt);
+        mpz_mul(crt, crt, qe);
+    }
+
+    mpz_clears(c, nk, q, qe, res, crt, NULL);
+    return ok;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_bincoef_mod,
+"bincoef_mod(n, k, m, /) -> mpz\n\n"
+"Return the binomial coefficient ('n choose k') modulo m. n >= 0, k >= 0,\n"
+"and m > 0. A table of small primes is cached between calls (see\n"
+"free_cache()). Raises OverflowError if m has a large prime factor, or a\n"
+"large prime power factor, and C(n,k) is too large to compute exactly.\n"
+"Will always release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_BincoefMod(PyObject *self, PyObject * const *args,
+                             Py_ssize_t nargs)
+{
+    MPZ_Object *result = NULL, *tempn = NULL, *tempk = NULL, *tempm = NULL;
+    unsigned long n = 0, k = 0;
+    int ok = 1, small;
+
+    if (nargs != 3) {
+        TYPE_ERROR("bincoef_mod() requires 'mpz','mpz','mpz' arguments");
+        return NULL;
+    }
+
+    if (!(tempn = GMPy_MPZ_From_Integer(args[0], NULL)) ||
+        !(tempk = GMPy_MPZ_From_Integer(args[1], NULL)) ||
+        !(tempm = GMPy_MPZ_From_Integer(args[2], NULL))) {
+        TYPE_ERROR("bincoef_mod() requires 'mpz','mpz','mpz' arguments");
+        goto cleanup;
+    }
+
+    if (mpz_sgn(tempn->z) < 0 || mpz_sgn(tempk->z) < 0) {
+        VALUE_ERROR("bincoef_mod() requires n >= 0 and k >= 0");
+        goto cleanup;
+    }
+
+    if (mpz_sgn(tempm->z) <= 0) {
+        VALUE_ERROR("bincoef_mod() requires m > 0");
+        goto cleanup;
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL)))
+        goto cleanup;
+
+    if (mpz_cmp(tempk->z, tempn->z) > 0 || mpz_cmp_ui(tempm->z, 1) == 0)
+        goto cleanup;
+
+    small = mpz_cmp_ui(tempn->z, PRIME_TABLE_MAX) <= 0;
+    if (small) {
+        n = mpz_get_ui(tempn->z);
+        k = mpz_get_ui(tempk->z);
+        if (k > n - k)
+            k = n - k;
+    }
+
+    /* The prime table can only be extended while holding the GIL. */
+    if (!gmpy_primes_upto(small ? n : (1UL << 16))) {
+        Py_CLEAR(result);
+        goto cleanup;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    if (small && mpz_sizeinbase(tempm->z, 2) > KUMMER_MAX_BITS) {
+        mpz_bin_uiui(result->z, n, k);
+        mpz_mod(result->z, result->z, tempm->z);
+    }
+    else if (small) {
+        bincoef_mod_kummer(result->z, n, k, tempm->z);
+    }
+    else if ((ok = bincoef_mod_factored(result->z, tempn->z, tempk->z, tempm->z)) == 0) {
+        /* Compute C(n, min(k, n-k)) exactly if it is not too large. It has
+         * fewer than min(k, n-k) * bits(n) bits.
+         */
+        mpz_sub(result->z, tempn->z, tempk->z);
+        if (mpz_cmp(result->z, tempk->z) > 0)
+            mpz_set(result->z, tempk->z);
+        if (mpz_cmp_ui(result->z, BINCOEF_EXACT_MAX / mpz_sizeinbase(tempn->z, 2)) <= 0) {
+            mpz_bin_ui(result->z, tempn->z, mpz_get_ui(result->z));
+            mpz_mod(result->z, result->z, tempm->z);
+            ok = 1;
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    if (ok < 0) {
+        PyErr_NoMemory();
+        Py_CLEAR(result);
+    }
+    else if (ok == 0) {
+        OVERFLOW_ERROR("bincoef_mod() arguments too large");
+        Py_CLEAR(result);
+    }
+
+  cleanup:
+    Py_XDECREF((PyObject*)tempn);
+    Py_XDECREF((PyObject*)tempk);
+    Py_XDECREF((PyObject*)tempm);
+    return (PyObject*)result;
+}
+
 PyDoc_STRVAR(GMPy_doc_mpz_function_isqrt,
-"isqrt(x, /) -> mpz\n\n"
-"Return the integer square root of a non-negative integer x.");
+"isqrt(x, /, out=None) -> mpz\n\n"
+"Return the integer square root of a non-negative integer x. If out is\n"
+"an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_Isqrt(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_Isqrt(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                        PyObject *kwnames)
 {
-    MPZ_Object *result;
+    MPZ_Object *result, *tempx;
+    PyObject *other, *out;
+
+    if (nargs != 1) {
+        TYPE_ERROR("isqrt() requires 'mpz' argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "isqrt", &out) < 0) {
+        return NULL;
+    }
 
+    other = args[0];
     if (CHECK_MPZANY(other)) {
         if (mpz_sgn(MPZ(other)) < 0) {
             VALUE_ERROR("isqrt() of negative number");
             return NULL;
         }
-        if ((result = GMPy_MPZ_New(NULL))) {
+        if ((result = GMPy_MPZ_NewOut(out, NULL))) {
             mpz_sqrt(result->z, MPZ(other));
         }
     }
     else {
-        if (!(result = GMPy_MPZ_From_Integer(other, NULL))) {
+        if (!(tempx = GMPy_MPZ_From_Integer(other, NULL))) {
             TYPE_ERROR("isqrt() requires 'mpz' argument");
             return NULL;
         }
-        if (mpz_sgn(result->z) < 0) {
+        if (mpz_sgn(tempx->z) < 0) {
             VALUE_ERROR("isqrt() of negative number");
-            Py_DECREF((PyObject*)result);
+            Py_DECREF((PyObject*)tempx);
             return NULL;
         }
-        mpz_sqrt(result->z, result->z);
+        if (!out) {
+            mpz_sqrt(tempx->z, tempx->z);
+            return (PyObject*)tempx;
+        }
+        result = GMPy_MPZ_NewOut(out, NULL);
+        mpz_sqrt(result->z, tempx->z);
+        Py_DECREF((PyObject*)tempx);
     }
     return (PyObject*)result;
 }
@@ -936,15 +1714,16 @@ GMPy_MPZ_Function_Remove(PyObject *self, PyObject * const *args,
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_invert,
-"invert(x, m, /) -> mpz\n\n"
+"invert(x, m, /, out=None) -> mpz\n\n"
 "Return y such that x*y == 1 modulo m. Raises `ZeroDivisionError` if no\n"
-"inverse exists.");
+"inverse exists. If out is an `xmpz`, the result is stored in out and\n"
+"out is returned.");
 
 static PyObject *
 GMPy_MPZ_Function_Invert(PyObject *self, PyObject * const *args,
-                         Py_ssize_t nargs)
+                         Py_ssize_t nargs, PyObject *kwnames)
 {
-    PyObject *x, *y;
+    PyObject *x, *y, *out;
     MPZ_Object *result = NULL, *tempx = NULL, *tempy = NULL;
     int success;
 
@@ -953,6 +1732,13 @@ GMPy_MPZ_Function_Invert(PyObject *self, PyObject * const *args,
         return NULL;
     }
 
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "invert", &out) < 0) {
+        return NULL;
+    }
+
+    /* mpz_invert() leaves its destination undefined if there is no
+     * inverse, so out is only written on success.
+     */
     if (!(result = GMPy_MPZ_New(NULL))) {
         /* LCOV_EXCL_START */
         return NULL;
@@ -1003,7 +1789,134 @@ GMPy_MPZ_Function_Invert(PyObject *self, PyObject * const *args,
             return NULL;
         }
     }
-    return (PyObject*)result;
+    return GMPy_MPZ_SetOut(result, out);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_invert_many,
+"invert_many(lst, m, /) -> list[mpz, ...]\n\n"
+"Return [invert(x, m) for x in lst]. Montgomery's simultaneous inversion\n"
+"is used so only one modular inverse is computed. Raises\n"
+"`ZeroDivisionError` if any inverse does not exist. Will always release\n"
+"the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_InvertMany(PyObject *self, PyObject * const *args,
+                             Py_ssize_t nargs)
+{
+    PyObject *seq = NULL, *result = NULL;
+    MPZ_Object *tempx, *tempm = NULL, **res = NULL;
+    mpz_t *prefix = NULL, inv, tmp;
+    Py_ssize_t i, n = 0;
+    int success = 1;
+
+    if (nargs != 2) {
+        TYPE_ERROR("invert_many() requires 2 arguments");
+        return NULL;
+    }
+
+    if (!(tempm = GMPy_MPZ_From_Integer(args[1], NULL))) {
+        TYPE_ERROR("invert_many() requires an integer modulus");
+        return NULL;
+    }
+
+    if (mpz_sgn(tempm->z) == 0) {
+        ZERO_ERROR("invert_many() division by 0");
+        goto cleanup;
+    }
+
+    if (!(seq = PySequence_Fast(args[0], "argument must be an iterable"))) {
+        goto cleanup;
+    }
+
+    n = PySequence_Fast_GET_SIZE(seq);
+    if (!(res = PyMem_Calloc(n + 1, sizeof(MPZ_Object*))) ||
+        !(prefix = PyMem_New(mpz_t, n + 1))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* Reduce each element modulo m and store it in its result object. */
+    for (i = 0; i < n; i++) {
+        if (!(tempx = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            TYPE_ERROR("invert_many() requires a sequence of integers");
+            goto cleanup;
+        }
+        if (!(res[i] = GMPy_MPZ_New(NULL))) {
+            /* LCOV_EXCL_START */
+            Py_DECREF((PyObject*)tempx);
+            goto cleanup;
+            /* LCOV_EXCL_STOP */
+        }
+        mpz_mod(res[i]->z, tempx->z, tempm->z);
+        Py_DECREF((PyObject*)tempx);
+    }
+
+    if (n > 0) {
+        Py_BEGIN_ALLOW_THREADS;
+        for (i = 0; i < n; i++) {
+            mpz_init(prefix[i]);
+        }
+        mpz_init(inv);
+        mpz_init(tmp);
+
+        /* prefix[i] = x[0] * x[1] * ... * x[i] mod m */
+        mpz_set(prefix[0], res[0]->z);
+        for (i = 1; i < n; i++) {
+            mpz_mul(prefix[i], prefix[i - 1], res[i]->z);
+            mpz_mod(prefix[i], prefix[i], tempm->z);
+        }
+
+        if (!mpz_invert(inv, prefix[n - 1], tempm->z)) {
+            success = 0;
+        }
+        else {
+            /* Peel off one factor at a time, from the end of the list. */
+            for (i = n - 1; i > 0; i--) {
+                mpz_mul(tmp, inv, res[i]->z);
+                mpz_mul(res[i]->z, inv, prefix[i - 1]);
+                mpz_mod(res[i]->z, res[i]->z, tempm->z);
+                mpz_mod(inv, tmp, tempm->z);
+            }
+            mpz_swap(res[0]->z, inv);
+        }
+
+        for (i = 0; i < n; i++) {
+            mpz_clear(prefix[i]);
+        }
+        mpz_clear(inv);
+        mpz_clear(tmp);
+        Py_END_ALLOW_THREADS;
+    }
+
+    if (!success) {
+        ZERO_ERROR("invert_many() no inverse exists");
+        goto cleanup;
+    }
+
+    if (!(result = PyList_New(n))) {
+        /* LCOV_EXCL_START */
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (i = 0; i < n; i++) {
+        PyList_SET_ITEM(result, i, (PyObject*)res[i]);
+        res[i] = NULL;
+    }
+
+  cleanup:
+    if (res) {
+        for (i = 0; i < n; i++) {
+            Py_XDECREF((PyObject*)res[i]);
+        }
+    }
+    PyMem_Free(res);
+    PyMem_Free(prefix);
+    Py_XDECREF(seq);
+    Py_DECREF((PyObject*)tempm);
+    return result;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_divexact,
@@ -1491,16 +2404,29 @@ GMPy_MPZ_Method_IsProbabPrime(PyObject *self, PyObject *const *args,
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_function_next_prime,
-"next_prime(x, /) -> mpz\n\n"
-"Return the next *probable* prime number > x.");
+"next_prime(x, /, out=None) -> mpz\n\n"
+"Return the next *probable* prime number > x. If out is an `xmpz`, the\n"
+"result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *other)
+GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *const *args,
+                            Py_ssize_t nargs, PyObject *kwnames)
 {
-    MPZ_Object *result;
+    MPZ_Object *result, *tempx;
+    PyObject *other, *out;
 
+    if (nargs != 1) {
+        TYPE_ERROR("next_prime() requires 'mpz' argument");
+        return NULL;
+    }
+
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "next_prime", &out) < 0) {
+        return NULL;
+    }
+
+    other = args[0];
     if(MPZ_Check(other)) {
-        if(!(result = GMPy_MPZ_New(NULL))) {
+        if(!(result = GMPy_MPZ_NewOut(out, NULL))) {
             /* LCOV_EXCL_START */
             return NULL;
             /* LCOV_EXCL_STOP */
@@ -1508,13 +2434,18 @@ GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *other)
         mpz_nextprime(result->z, MPZ(other));
     }
     else {
-        if (!(result = GMPy_MPZ_From_Integer(other, NULL))) {
+        if (!(tempx = GMPy_MPZ_From_Integer(other, NULL))) {
             TYPE_ERROR("next_prime() requires 'mpz' argument");
             return NULL;
         }
-        else {
-            mpz_nextprime(result->z, result->z);
+        if (!out) {
+            mpz_nextprime(tempx->z, tempx->z);
+            return (PyObject*)tempx;
         }
+        if ((result = GMPy_MPZ_NewOut(out, NULL))) {
+            mpz_nextprime(result->z, tempx->z);
+        }
+        Py_DECREF((PyObject*)tempx);
     }
     return (PyObject*)result;
 }
@@ -1634,6 +2565,512 @@ GMPy_MPZ_Function_Legendre(PyObject *self, PyObject * const *args,
     return PyLong_FromLong(res);
 }
 
+/* Modular square roots.
+ *
+ * sqrtmod_prime() selects the algorithm by the 2-adic valuation s of p-1:
+ * p = 3 mod 4 and p = 5 mod 8 (Atkin) use a single exponentiation,
+ * Tonelli-Shanks is used while its O(s^2) inner loop is cheap compared to
+ * an exponentiation, and Cipolla's method, whose cost does not depend on s,
+ * is used otherwise. sqrtmod_prime_power() lifts a root modulo p to a root
+ * modulo p**k with Newton iteration (or bit by bit for p = 2).
+ *
+ * p must be prime, but it is not tested: a primality test would cost
+ * several times more than the exponentiation itself. Instead the search
+ * for a non-residue is capped at SQRTMOD_MAX_TRIES(bits) candidates, which
+ * exceeds the 2*ln(p)^2 bound on the least non-residue that holds under
+ * GRH, and every root is verified before it is returned. For a prime p
+ * neither check can fail, so a failure means that p is composite. Both
+ * helpers return 1 on success, 0 if no square root exists, and -1 if p was
+ * found to be composite. The root returned is the smaller of r and -r.
+ */
+
+#define SQRTMOD_MAX_TRIES(bits) (2 * (bits) * (bits) + 16)
+
+static int
+sqrtmod_prime(mpz_t r, const mpz_t a, const mpz_t p)
+{
+    mpz_t aa, q, z, c, t, b, x, y, d, tmp;
+    mp_bitcnt_t s, m, i, bits, tries;
+    int ok = 0;
+
+    mpz_init(aa);
+    mpz_mod(aa, a, p);
+
+    if (mpz_cmp_ui(p, 2) == 0 || mpz_sgn(aa) == 0) {
+        mpz_swap(r, aa);
+        mpz_clear(aa);
+        return 1;
+    }
+
+    /* An even p > 2 is composite, and a Jacobi symbol of 0 means that a
+     * shares a factor with p.
+     */
+    if (mpz_even_p(p) || (ok = mpz_jacobi(aa, p)) != 1) {
+        mpz_clear(aa);
+        return ok == -1 ? 0 : -1;
+    }
+    ok = -1;
+
+    mpz_inits(q, z, c, t, b, x, y, d, tmp, NULL);
+
+    mpz_sub_ui(q, p, 1);
+    s = mpz_scan1(q, 0);
+    bits = mpz_sizeinbase(p, 2);
+
+    if (s == 1) {
+        /* r = a^((p+1)/4) */
+        mpz_add_ui(q, p, 1);
+        mpz_fdiv_q_2exp(q, q, 2);
+        mpz_powm(r, aa, q, p);
+    }
+    else if (s == 2) {
+        /* Atkin: v = (2a)^((p-5)/8), i = 2a*v^2, r = a*v*(i-1) */
+        mpz_sub_ui(q, p, 5);
+        mpz_fdiv_q_2exp(q, q, 3);
+        mpz_mul_2exp(t, aa, 1);
+        mpz_powm(x, t, q, p);
+        mpz_mul(y, x, x);
+        mpz_mul(y, y, t);
+        mpz_sub_ui(y, y, 1);
+        mpz_mul(y, y, x);
+        mpz_mul(y, y, aa);
+        mpz_mod(r, y, p);
+    }
+    else if (s * s <= 8 * bits) {
+        /* Tonelli-Shanks with p-1 = q * 2^s. */
+        mpz_fdiv_q_2exp(q, q, s);
+        for (mpz_set_ui(z, 2), tries = 0; ; mpz_add_ui(z, z, 1)) {
+            if (mpz_cmp(z, p) >= 0 || ++tries > SQRTMOD_MAX_TRIES(bits)) {
+                ok = -1;
+                goto done;
+            }
+            if (mpz_jacobi(z, p) == -1)
+                break;
+        }
+
+        mpz_powm(c, z, q, p);
+        mpz_powm(t, aa, q, p);
+        mpz_add_ui(q, q, 1);
+        mpz_fdiv_q_2exp(q, q, 1);
+        mpz_powm(r, aa, q, p);
+        m = s;
+
+        while (mpz_cmp_ui(t, 1) != 0) {
+            mpz_set(tmp, t);
+            for (i = 0; i < m && mpz_cmp_ui(tmp, 1) != 0; i++) {
+                mpz_mul(tmp, tmp, tmp);
+                mpz_mod(tmp, tmp, p);
+            }
+            if (i == 0 || i == m)
+                goto done;
+
+            mpz_set(b, c);
+            for (; m > i + 1; m--) {
+                mpz_mul(b, b, b);
+                mpz_mod(b, b, p);
+            }
+            m = i;
+            mpz_mul(c, b, b);
+            mpz_mod(c, c, p);
+            mpz_mul(t, t, c);
+            mpz_mod(t, t, p);
+            mpz_mul(r, r, b);
+            mpz_mod(r, r, p);
+        }
+    }
+    else {
+        /* Cipolla: find z with d = z^2 - a a non-residue, then
+         * r = (z + w)^((p+1)/2) in GF(p)[w]/(w^2 - d).
+         */
+        for (mpz_set_ui(z, 1), tries = 0; ; mpz_add_ui(z, z, 1)) {
+            if (mpz_cmp(z, p) >= 0 || ++tries > SQRTMOD_MAX_TRIES(bits)) {
+                ok = -1;
+                goto done;
+            }
+            mpz_mul(d, z, z);
+            mpz_sub(d, d, aa);
+            mpz_mod(d, d, p);
+            if (mpz_jacobi(d, p) == -1)
+                break;
+        }
+
+        mpz_add_ui(q, p, 1);
+        mpz_fdiv_q_2exp(q, q, 1);
+        mpz_set_ui(x, 1);
+        mpz_set_ui(y, 0);
+        for (i = mpz_sizeinbase(q, 2); i-- > 0; ) {
+            /* (x + y*w)^2 = (x^2 + d*y^2) + 2*x*y*w */
+            mpz_mul(tmp, x, y);
+            mpz_mul(x, x, x);
+            mpz_mul(y, y, y);
+            mpz_mul(y, y, d);
+            mpz_add(x, x, y);
+            mpz_mod(x, x, p);
+            mpz_mul_2exp(y, tmp, 1);
+            mpz_mod(y, y, p);
+            if (mpz_tstbit(q, i)) {
+                /* (x + y*w)(z + w) = (x*z + d*y) + (x + y*z)*w */
+                mpz_mul(tmp, y, d);
+                mpz_mul(y, y, z);
+                mpz_add(y, y, x);
+                mpz_mod(y, y, p);
+                mpz_mul(x, x, z);
+                mpz_add(x, x, tmp);
+                mpz_mod(x, x, p);
+            }
+        }
+        mpz_swap(r, x);
+    }
+
+    /* Verify the root and return the smaller of r and p-r. */
+    mpz_mul(tmp, r, r);
+    mpz_sub(tmp, tmp, aa);
+    if (mpz_divisible_p(tmp, p)) {
+        mpz_fdiv_q_2exp(tmp, p, 1);
+        if (mpz_cmp(r, tmp) > 0)
+            mpz_sub(r, p, r);
+        ok = 1;
+    }
+
+  done:
+    mpz_clears(aa, q, z, c, t, b, x, y, d, tmp, NULL);
+    return ok;
+}
+
+static int
+sqrtmod_prime_power(mpz_t r, const mpz_t a, const mpz_t p, unsigned long k)
+{
+    mpz_t pk, aa, b, s, cur, next, tmp;
+    unsigned long v, kk, i;
+    int ok = 0;
+
+    mpz_inits(pk, aa, b, s, cur, next, tmp, NULL);
+    mpz_pow_ui(pk, p, k);
+    mpz_mod(aa, a, pk);
+
+    if (mpz_sgn(aa) == 0) {
+        mpz_set_ui(r, 0);
+        ok = 1;
+        goto done;
+    }
+
+    /* a = p^v * b with b a unit; a root exists only if v is even. */
+    v = (unsigned long)mpz_remove(b, aa, p);
+    if (v & 1)
+        goto done;
+    kk = k - v;
+
+    if (mpz_cmp_ui(p, 2) == 0) {
+        if ((kk >= 2 && mpz_fdiv_ui(b, 4) != 1) ||
+            (kk >= 3 && mpz_fdiv_ui(b, 8) != 1))
+            goto done;
+
+        /* If s^2 = b mod 2^i but not mod 2^(i+1), add 2^(i-1). */
+        mpz_set_ui(s, 1);
+        for (i = 3; i < kk; i++) {
+            mpz_mul(tmp, s, s);
+            mpz_sub(tmp, tmp, b);
+            if (mpz_tstbit(tmp, i))
+                mpz_setbit(s, i - 1);
+        }
+    }
+    else {
+        if ((ok = sqrtmod_prime(s, b, p)) != 1)
+            goto done;
+
+        /* 2s is invertible modulo p^i unless p is composite. */
+        ok = -1;
+
+        /* Newton iteration doubles the number of correct p-adic digits. */
+        mpz_mod(b, b, pk);
+        mpz_set(cur, p);
+        for (i = 1; i < kk; i *= 2) {
+            if (2 * i < kk)
+                mpz_mul(next, cur, cur);
+            else
+                mpz_pow_ui(next, p, kk);
+            mpz_mul_2exp(tmp, s, 1);
+            if (!mpz_invert(tmp, tmp, next))
+                goto done;
+            mpz_mul(cur, s, s);
+            mpz_sub(cur, cur, b);
+            mpz_mul(cur, cur, tmp);
+            mpz_sub(s, s, cur);
+            mpz_mod(s, s, next);
+            mpz_swap(cur, next);
+        }
+    }
+
+    /* Multiply by p^(v/2), verify, and return the smaller of r and p^k-r.
+     * The verification only fails if p is composite.
+     */
+    ok = -1;
+    mpz_pow_ui(tmp, p, v / 2);
+    mpz_mul(r, s, tmp);
+    mpz_mod(r, r, pk);
+    mpz_mul(tmp, r, r);
+    mpz_sub(tmp, tmp, aa);
+    if (mpz_divisible_p(tmp, pk)) {
+        mpz_fdiv_q_2exp(tmp, pk, 1);
+        if (mpz_cmp(r, tmp) > 0)
+            mpz_sub(r, pk, r);
+        ok = 1;
+    }
+
+  done:
+    mpz_clears(pk, aa, b, s, cur, next, tmp, NULL);
+    return ok;
+}
+
+/* Common argument parsing for the sqrtmod() family. On success, returns a
+ * new reference to p as an mpz and stores k in *k (if k is not NULL).
+ */
+
+static MPZ_Object *
+sqrtmod_check_args(PyObject *p, PyObject *k, unsigned long *kval, const char *name)
+{
+    MPZ_Object *tempp;
+
+    if (!(tempp = GMPy_MPZ_From_Integer(p, NULL))) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 'mpz' arguments", name);
+        return NULL;
+    }
+
+    if (mpz_cmp_ui(tempp->z, 2) < 0) {
+        PyErr_Format(PyExc_ValueError, "%s() requires p to be prime", name);
+        Py_DECREF((PyObject*)tempp);
+        return NULL;
+    }
+
+    if (k) {
+        *kval = GMPy_Integer_AsUnsignedLong(k);
+        if (*kval == (unsigned long)(-1) && PyErr_Occurred()) {
+            Py_DECREF((PyObject*)tempp);
+            return NULL;
+        }
+        if (*kval == 0) {
+            PyErr_Format(PyExc_ValueError, "%s() requires k > 0", name);
+            Py_DECREF((PyObject*)tempp);
+            return NULL;
+        }
+    }
+    return tempp;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_sqrtmod,
+"sqrtmod(a, p, /) -> mpz\n\n"
+"Return the smallest r >= 0 such that r*r == a modulo p. p must be\n"
+"prime; it is not tested, but `ValueError` is raised if p is found to be\n"
+"composite while computing the root, or if no square root exists.");
+
+static PyObject *
+GMPy_MPZ_Function_Sqrtmod(PyObject *self, PyObject * const *args,
+                          Py_ssize_t nargs)
+{
+    MPZ_Object *result = NULL, *tempa = NULL, *tempp = NULL;
+
+    if (nargs != 2) {
+        TYPE_ERROR("sqrtmod() requires 'mpz','mpz' arguments");
+        return NULL;
+    }
+
+    if (!(tempp = sqrtmod_check_args(args[1], NULL, NULL, "sqrtmod")))
+        return NULL;
+
+    if (!(tempa = GMPy_MPZ_From_Integer(args[0], NULL))) {
+        TYPE_ERROR("sqrtmod() requires 'mpz','mpz' arguments");
+        goto cleanup;
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL)))
+        goto cleanup;
+
+    switch (sqrtmod_prime(result->z, tempa->z, tempp->z)) {
+    case 0:
+        VALUE_ERROR("sqrtmod() no square root exists");
+        Py_CLEAR(result);
+        break;
+    case -1:
+        VALUE_ERROR("sqrtmod() requires p to be prime");
+        Py_CLEAR(result);
+        break;
+    }
+
+  cleanup:
+    Py_XDECREF((PyObject*)tempa);
+    Py_DECREF((PyObject*)tempp);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_sqrtmod_prime_power,
+"sqrtmod_prime_power(a, p, k, /) -> mpz\n\n"
+"Return r such that r*r == a modulo p**k and 0 <= r <= p**k/2. p must\n"
+"be prime; it is not tested, but `ValueError` is raised if p is found to\n"
+"be composite while computing the root, or if no square root exists.");
+
+static PyObject *
+GMPy_MPZ_Function_SqrtmodPrimePower(PyObject *self, PyObject * const *args,
+                                    Py_ssize_t nargs)
+{
+    MPZ_Object *result = NULL, *tempa = NULL, *tempp = NULL;
+    unsigned long k;
+
+    if (nargs != 3) {
+        TYPE_ERROR("sqrtmod_prime_power() requires 'mpz','mpz','int' arguments");
+        return NULL;
+    }
+
+    if (!(tempp = sqrtmod_check_args(args[1], args[2], &k, "sqrtmod_prime_power")))
+        return NULL;
+
+    if (!(tempa = GMPy_MPZ_From_Integer(args[0], NULL))) {
+        TYPE_ERROR("sqrtmod_prime_power() requires 'mpz','mpz','int' arguments");
+        goto cleanup;
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL)))
+        goto cleanup;
+
+    switch (sqrtmod_prime_power(result->z, tempa->z, tempp->z, k)) {
+    case 0:
+        VALUE_ERROR("sqrtmod_prime_power() no square root exists");
+        Py_CLEAR(result);
+        break;
+    case -1:
+        VALUE_ERROR("sqrtmod_prime_power() requires p to be prime");
+        Py_CLEAR(result);
+        break;
+    }
+
+  cleanup:
+    Py_XDECREF((PyObject*)tempa);
+    Py_DECREF((PyObject*)tempp);
+    return (PyObject*)result;
+}
+
+/* Shared implementation of sqrtmod_list() and sqrtmod_prime_power_list().
+ * A k of 0 selects sqrtmod_prime().
+ */
+
+static PyObject *
+sqrtmod_list(PyObject *lst, MPZ_Object *tempp, unsigned long k, const char *name)
+{
+    PyObject *seq = NULL, *result = NULL;
+    MPZ_Object *tempa, **res = NULL;
+    Py_ssize_t i, n = 0;
+    int ok = 1;
+
+    if (!(seq = PySequence_Fast(lst, "argument must be an iterable")))
+        return NULL;
+
+    n = PySequence_Fast_GET_SIZE(seq);
+    if (!(res = PyMem_Calloc(n + 1, sizeof(MPZ_Object*)))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
+        goto cleanup;
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* The input values are stored in the result objects. */
+    for (i = 0; i < n; i++) {
+        if (!(tempa = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            PyErr_Format(PyExc_TypeError, "%s() requires a sequence of integers", name);
+            goto cleanup;
+        }
+        if (!(res[i] = GMPy_MPZ_New(NULL))) {
+            /* LCOV_EXCL_START */
+            Py_DECREF((PyObject*)tempa);
+            goto cleanup;
+            /* LCOV_EXCL_STOP */
+        }
+        mpz_set(res[i]->z, tempa->z);
+        Py_DECREF((PyObject*)tempa);
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    for (i = 0; ok == 1 && i < n; i++) {
+        if (k)
+            ok = sqrtmod_prime_power(res[i]->z, res[i]->z, tempp->z, k);
+        else
+            ok = sqrtmod_prime(res[i]->z, res[i]->z, tempp->z);
+    }
+    Py_END_ALLOW_THREADS;
+
+    if (ok != 1) {
+        PyErr_Format(PyExc_ValueError, ok ? "%s() requires p to be prime"
+                                          : "%s() no square root exists", name);
+        goto cleanup;
+    }
+
+    if (!(result = PyList_New(n)))
+        goto cleanup;
+
+    for (i = 0; i < n; i++) {
+        PyList_SET_ITEM(result, i, (PyObject*)res[i]);
+        res[i] = NULL;
+    }
+
+  cleanup:
+    if (res) {
+        for (i = 0; i < n; i++)
+            Py_XDECREF((PyObject*)res[i]);
+    }
+    PyMem_Free(res);
+    Py_DECREF(seq);
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_sqrtmod_list,
+"sqrtmod_list(lst, p, /) -> list[mpz, ...]\n\n"
+"Return [sqrtmod(a, p) for a in lst]. Raises `ValueError` if any square\n"
+"root does not exist. Will always release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_SqrtmodList(PyObject *self, PyObject * const *args,
+                              Py_ssize_t nargs)
+{
+    MPZ_Object *tempp;
+    PyObject *result;
+
+    if (nargs != 2) {
+        TYPE_ERROR("sqrtmod_list() requires 2 arguments");
+        return NULL;
+    }
+
+    if (!(tempp = sqrtmod_check_args(args[1], NULL, NULL, "sqrtmod_list")))
+        return NULL;
+
+    result = sqrtmod_list(args[0], tempp, 0, "sqrtmod_list");
+    Py_DECREF((PyObject*)tempp);
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_sqrtmod_prime_power_list,
+"sqrtmod_prime_power_list(lst, p, k, /) -> list[mpz, ...]\n\n"
+"Return [sqrtmod_prime_power(a, p, k) for a in lst]. Raises `ValueError`\n"
+"if any square root does not exist. Will always release the GIL.");
+
+static PyObject *
+GMPy_MPZ_Function_SqrtmodPrimePowerList(PyObject *self, PyObject * const *args,
+                                        Py_ssize_t nargs)
+{
+    MPZ_Object *tempp;
+    PyObject *result;
+    unsigned long k;
+
+    if (nargs != 3) {
+        TYPE_ERROR("sqrtmod_prime_power_list() requires 3 arguments");
+        return NULL;
+    }
+
+    if (!(tempp = sqrtmod_check_args(args[1], args[2], &k, "sqrtmod_prime_power_list")))
+        return NULL;
+
+    result = sqrtmod_list(args[0], tempp, k, "sqrtmod_prime_power_list");
+    Py_DECREF((PyObject*)tempp);
+    return result;
+}
+
 PyDoc_STRVAR(GMPy_doc_mpz_function_kronecker,
 "kronecker(x, y, /) -> mpz\n\n"
 "Return the Kronecker-Jacobi symbol (x|y).");
@@ -64,23 +64,29 @@ static PyObject * GMPy_MPZ_Method_Array(PyObject *self, PyObject *const *args, P
 static PyObject * GMPy_MPZ_Function_NumDigits(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_Iroot(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_IrootRem(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_GCD(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_LCM(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static void       GMPy_Primes_Free_Cache(void);
+static PyObject * GMPy_MPZ_Function_BincoefMod(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_RangeProduct(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_FallingFactorial(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_RisingFactorial(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_GCD(PyObject *self, PyObject * const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_LCM(PyObject *self, PyObject * const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_Function_GCDext(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_Divm(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_Fac(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_Primorial(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_DoubleFac(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_MultiFac(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_Fib(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPZ_Function_Fac(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_Primorial(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_DoubleFac(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_MultiFac(PyObject *self, PyObject * const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_Fib(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_Function_Fib2(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_Lucas(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPZ_Function_Lucas(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_Function_Lucas2(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_Isqrt(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPZ_Function_Isqrt(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_MPZ_Function_IsqrtRem(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_Remove(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_Invert(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_Invert(PyObject *self, PyObject * const *args, Py_ssize_t nargs, PyObject *kwnames);
+static PyObject * GMPy_MPZ_Function_InvertMany(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_Divexact(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_IsSquare(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_IsDivisible(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
@@ -88,12 +94,16 @@ static PyObject * GMPy_MPZ_Function_IsCongruent(PyObject *self, PyObject * const
 static PyObject * GMPy_MPZ_Function_IsPower(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_IsProbabPrime(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
-static PyObject * GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 #if (__GNU_MP_VERSION > 6) || (__GNU_MP_VERSION == 6 &&  __GNU_MP_VERSION_MINOR >= 3)
 static PyObject * GMPy_MPZ_Function_PrevPrime(PyObject *self, PyObject *other);
 #endif
 static PyObject * GMPy_MPZ_Function_Jacobi(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_Legendre(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_Sqrtmod(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_SqrtmodPrimePower(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_SqrtmodList(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
+static PyObject * GMPy_MPZ_Function_SqrtmodPrimePowerList(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_Kronecker(PyObject *self, PyObject * const *args, Py_ssize_t nargs);
 static PyObject * GMPy_MPZ_Function_IsEven(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_IsOdd(PyObject *self, PyObject *other);
@@ -0,0 +1,684 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_poly.c                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000 - 2009 Alex Martelli                                     *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Polynomial evaluation.
+ *
+ * The coefficients and the argument are converted once to the most
+ * general type among them. Integer and rational polynomials are evaluated
+ * exactly. Real and complex polynomials are evaluated by Horner's rule
+ * using mpfr_fma()/mpc_fma() on a single temporary with a few guard bits,
+ * while a rigorous bound on the accumulated error is kept alongside (see
+ * GMPy_Poly_AddRoundErr()). The result is rounded to the precision and
+ * rounding mode of the context only when mpfr_can_round() shows that the
+ * rounding is correct; otherwise the working precision is raised and the
+ * evaluation repeated (Ziv's strategy). The ternary value is therefore
+ * exact, and it is 0 only if every operation was exact.
+ *
+ * Long integer polynomials are split as p(x) = h(x)*x**m + l(x), with m a
+ * power of two, so that the multiplications are between numbers of
+ * similar size and can use GMP's subquadratic algorithms.
+ */
+
+#define GMPY_POLY_GUARD 16
+#define GMPY_POLY_SPLIT 16
+
+static int
+GMPy_Poly_Kind(int xtype)
+{
+    if (IS_TYPE_INTEGER(xtype))
+        return GMPY_POLY_INTEGER;
+    if (IS_TYPE_RATIONAL(xtype))
+        return GMPY_POLY_RATIONAL;
+    if (IS_TYPE_REAL(xtype))
+        return GMPY_POLY_REAL;
+    if (IS_TYPE_COMPLEX(xtype))
+        return GMPY_POLY_COMPLEX;
+    return 0;
+}
+
+static PyObject *
+GMPy_Poly_Convert(PyObject *obj, int kind, CTXT_Object *context)
+{
+    int xtype = GMPy_ObjectType(obj);
+
+    switch (kind) {
+        case GMPY_POLY_INTEGER:
+            return (PyObject*)GMPy_MPZ_From_IntegerWithType(obj, xtype, context);
+        case GMPY_POLY_RATIONAL:
+            return (PyObject*)GMPy_MPQ_From_RationalWithType(obj, xtype, context);
+        case GMPY_POLY_REAL:
+            return (PyObject*)GMPy_MPFR_From_RealWithType(obj, xtype, 1, context);
+        default:
+            return (PyObject*)GMPy_MPC_From_ComplexWithType(obj, xtype, 1, 1, context);
+    }
+}
+
+/* Return the kind needed for all the items of seq, a sequence returned by
+ * PySequence_Fast(), or -1 if an item is not a number.
+ */
+
+static int
+GMPy_Poly_SeqKind(PyObject *seq, const char *name)
+{
+    Py_ssize_t i;
+    int kind = GMPY_POLY_INTEGER, k;
+
+    for (i = 0; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        if (!(k = GMPy_Poly_Kind(GMPy_ObjectType(PySequence_Fast_GET_ITEM(seq, i))))) {
+            PyErr_Format(PyExc_TypeError, "%s() requires numeric arguments", name);
+            return -1;
+        }
+        kind = Py_MAX(kind, k);
+    }
+    return kind;
+}
+
+static void
+GMPy_Poly_Clear(GMPy_Poly *p)
+{
+    Py_ssize_t i;
+
+    if (p->c) {
+        for (i = 0; i < p->n; i++) {
+            Py_XDECREF(p->c[i]);
+        }
+        PyMem_Free(p->c);
+        p->c = NULL;
+    }
+}
+
+static int
+GMPy_Poly_Init(GMPy_Poly *p, PyObject *seq, int kind, CTXT_Object *context)
+{
+    Py_ssize_t i;
+
+    p->n = PySequence_Fast_GET_SIZE(seq);
+    p->kind = kind;
+    if (!(p->c = PyMem_Calloc(Py_MAX(p->n, 1), sizeof(PyObject*)))) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    for (i = 0; i < p->n; i++) {
+        if (!(p->c[i] = GMPy_Poly_Convert(PySequence_Fast_GET_ITEM(seq, i), kind, context))) {
+            GMPy_Poly_Clear(p);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void
+GMPy_Poly_Horner_MPZ(mpz_ptr r, PyObject **c, Py_ssize_t n, mpz_srcptr x)
+{
+    Py_ssize_t i;
+
+    mpz_set(r, MPZ(c[0]));
+    for (i = 1; i < n; i++) {
+        mpz_mul(r, r, x);
+        mpz_add(r, r, MPZ(c[i]));
+    }
+}
+
+/* Evaluate the n coefficients in c at x, where pw[k] = x**(2**k). */
+
+static void
+GMPy_Poly_Split_MPZ(mpz_ptr r, PyObject **c, Py_ssize_t n, mpz_t *pw)
+{
+    Py_ssize_t m = 1;
+    int k = 0;
+    mpz_t t;
+
+    if (n <= GMPY_POLY_SPLIT) {
+        GMPy_Poly_Horner_MPZ(r, c, n, pw[0]);
+        return;
+    }
+
+    while (2 * m < n) {
+        m *= 2;
+        k++;
+    }
+
+    mpz_init(t);
+    GMPy_Poly_Split_MPZ(t, c, n - m, pw);
+    mpz_mul(t, t, pw[k]);
+    GMPy_Poly_Split_MPZ(r, c + n - m, m, pw);
+    mpz_add(r, r, t);
+    mpz_clear(t);
+}
+
+static void
+GMPy_Poly_Eval_MPZ(mpz_ptr r, GMPy_Poly *p, mpz_srcptr x)
+{
+    mpz_t pw[8 * sizeof(Py_ssize_t)];
+    Py_ssize_t m = 1;
+    int k, levels = 1;
+
+    if (p->n <= GMPY_POLY_SPLIT || mpz_size(x) < 2) {
+        GMPy_Poly_Horner_MPZ(r, p->c, p->n, x);
+        return;
+    }
+
+    mpz_init_set(pw[0], x);
+    while (2 * m < p->n) {
+        mpz_init(pw[levels]);
+        mpz_mul(pw[levels], pw[levels - 1], pw[levels - 1]);
+        m *= 2;
+        levels++;
+    }
+
+    GMPy_Poly_Split_MPZ(r, p->c, p->n, pw);
+
+    for (k = 0; k < levels; k++) {
+        mpz_clear(pw[k]);
+    }
+}
+
+static void
+GMPy_Poly_Eval_MPQ(mpq_ptr r, GMPy_Poly *p, mpq_srcptr x)
+{
+    Py_ssize_t i;
+
+    mpq_set(r, MPQ(p->c[0]));
+    for (i = 1; i < p->n; i++) {
+        mpq_mul(r, r, x);
+        mpq_add(r, r, MPQ(p->c[i]));
+    }
+}
+
+/* Add a bound on the rounding error of the last operation, which stored
+ * the value t rounded to nearest with ternary value inex, to err. The error
+ * is at most half an ulp of t; a zero t can only be inexact through
+ * underflow, in which case the error is below 2**emin.
+ */
+
+static void
+GMPy_Poly_AddRoundErr(mpfr_ptr err, mpfr_srcptr t, int inex, mpfr_ptr u)
+{
+    if (!inex) {
+        return;
+    }
+    if (mpfr_regular_p(t)) {
+        mpfr_set_ui_2exp(u, 1, mpfr_get_exp(t) - (mpfr_exp_t)mpfr_get_prec(t) - 1, MPFR_RNDU);
+    }
+    else {
+        mpfr_set_ui_2exp(u, 1, mpfr_get_emin(), MPFR_RNDU);
+    }
+    mpfr_add(err, err, u, MPFR_RNDU);
+}
+
+/* Return 1 if t, whose error is at most err, can be rounded correctly to
+ * prec bits in rounding mode rnd (with a correct ternary value).
+ */
+
+static int
+GMPy_Poly_CanRound(mpfr_srcptr t, mpfr_srcptr err, mpfr_prec_t prec, mpfr_rnd_t rnd)
+{
+    if (mpfr_zero_p(err)) {
+        return 1;
+    }
+    if (!mpfr_regular_p(t) || !mpfr_regular_p(err) ||
+        mpfr_get_exp(t) <= mpfr_get_exp(err)) {
+        return 0;
+    }
+    return mpfr_can_round(t, mpfr_get_exp(t) - mpfr_get_exp(err), MPFR_RNDN,
+                          MPFR_RNDZ, prec + (rnd == MPFR_RNDN));
+}
+
+/* The working precision for the next attempt of Ziv's loop, or 0 if the
+ * precision cannot be raised any further.
+ */
+
+static mpfr_prec_t
+GMPy_Poly_NextPrec(mpfr_prec_t wp)
+{
+    if (wp >= MPFR_PREC_MAX) {
+        return 0;
+    }
+    return (mpfr_prec_t)Py_MIN((double)wp + Py_MAX(wp / 2, 64), (double)MPFR_PREC_MAX);
+}
+
+/* Evaluate p at x into r, correctly rounded with rounding mode rnd. The
+ * evaluation starts with guard extra bits. Returns the ternary value.
+ *
+ * If the exact Horner value at step i is v[i] = v[i-1]*x + c[i] and the
+ * computed value is t[i], then |t[i] - v[i]| <= |x|*|t[i-1] - v[i-1]| plus
+ * the rounding error of the fma, which gives the running bound err.
+ */
+
+static int
+GMPy_Poly_Eval_MPFR(mpfr_ptr r, GMPy_Poly *p, mpfr_srcptr x, mpfr_prec_t guard,
+                    mpfr_rnd_t rnd)
+{
+    mpfr_prec_t prec = mpfr_get_prec(r), wp;
+    mpfr_t t, err, u, xa;
+    mpfr_flags_t flags;
+    Py_ssize_t i;
+    int inex;
+
+    wp = Py_MIN(prec + guard, MPFR_PREC_MAX);
+    mpfr_init2(t, wp);
+    mpfr_init2(err, 32);
+    mpfr_init2(u, 2);
+    mpfr_init2(xa, mpfr_get_prec(x));
+    mpfr_abs(xa, x, MPFR_RNDN);
+
+    for (;;) {
+        mpfr_set_zero(err, 1);
+        inex = mpfr_set(t, MPFR(p->c[0]), MPFR_RNDN);
+        GMPy_Poly_AddRoundErr(err, t, inex, u);
+        for (i = 1; i < p->n; i++) {
+            mpfr_mul(err, err, xa, MPFR_RNDU);
+            inex = mpfr_fma(t, t, x, MPFR(p->c[i]), MPFR_RNDN);
+            GMPy_Poly_AddRoundErr(err, t, inex, u);
+        }
+
+        /* Inf and NaN results do not improve with more precision. */
+        if ((!mpfr_regular_p(t) && !mpfr_zero_p(t)) ||
+            GMPy_Poly_CanRound(t, err, prec, rnd) ||
+            !(wp = GMPy_Poly_NextPrec(wp))) {
+            break;
+        }
+        mpfr_set_prec(t, wp);
+    }
+
+    /* Only the final rounding decides the inexact and underflow flags. */
+    flags = mpfr_flags_save();
+    mpfr_flags_clear(MPFR_FLAGS_INEXACT | MPFR_FLAGS_UNDERFLOW);
+    inex = mpfr_set(r, t, rnd);
+    mpfr_flags_set(flags & ~(MPFR_FLAGS_INEXACT | MPFR_FLAGS_UNDERFLOW) & MPFR_FLAGS_ALL);
+
+    mpfr_clear(t);
+    mpfr_clear(err);
+    mpfr_clear(u);
+    mpfr_clear(xa);
+    return inex;
+}
+
+/* The same for complex polynomials, with separate error bounds for the
+ * real and imaginary parts. Writing t*x = (a*c - b*d) + (a*d + b*c)*i,
+ * the error of the real part grows by |c|*ea + |d|*eb and that of the
+ * imaginary part by |d|*ea + |c|*eb.
+ */
+
+static int
+GMPy_Poly_Eval_MPC(mpc_ptr r, GMPy_Poly *p, mpc_srcptr x, mpfr_prec_t guard,
+                   mpc_rnd_t rnd)
+{
+    mpfr_prec_t rprec, iprec, rwp, iwp;
+    mpfr_t ea, eb, na, nb, u, xc, xd;
+    mpfr_flags_t flags;
+    mpc_t t;
+    Py_ssize_t i;
+    int inex;
+
+    mpc_get_prec2(&rprec, &iprec, r);
+    rwp = Py_MIN(rprec + guard, MPFR_PREC_MAX);
+    iwp = Py_MIN(iprec + guard, MPFR_PREC_MAX);
+    mpc_init3(t, rwp, iwp);
+    mpfr_inits2(32, ea, eb, na, nb, (mpfr_ptr)0);
+    mpfr_init2(u, 2);
+    mpfr_init2(xc, mpfr_get_prec(mpc_realref(x)));
+    mpfr_init2(xd, mpfr_get_prec(mpc_imagref(x)));
+    mpfr_abs(xc, mpc_realref(x), MPFR_RNDN);
+    mpfr_abs(xd, mpc_imagref(x), MPFR_RNDN);
+
+    for (;;) {
+        mpfr_set_zero(ea, 1);
+        mpfr_set_zero(eb, 1);
+        inex = mpc_set(t, MPC(p->c[0]), MPC_RNDNN);
+        GMPy_Poly_AddRoundErr(ea, mpc_realref(t), MPC_INEX_RE(inex), u);
+        GMPy_Poly_AddRoundErr(eb, mpc_imagref(t), MPC_INEX_IM(inex), u);
+        for (i = 1; i < p->n; i++) {
+            mpfr_mul(na, xc, ea, MPFR_RNDU);
+            mpfr_mul(u, xd, eb, MPFR_RNDU);
+            mpfr_add(na, na, u, MPFR_RNDU);
+            mpfr_mul(nb, xd, ea, MPFR_RNDU);
+            mpfr_mul(u, xc, eb, MPFR_RNDU);
+            mpfr_add(eb, nb, u, MPFR_RNDU);
+            mpfr_swap(ea, na);
+            inex = mpc_fma(t, t, x, MPC(p->c[i]), MPC_RNDNN);
+            GMPy_Poly_AddRoundErr(ea, mpc_realref(t), MPC_INEX_RE(inex), u);
+            GMPy_Poly_AddRoundErr(eb, mpc_imagref(t), MPC_INEX_IM(inex), u);
+        }
+
+        if ((!mpfr_regular_p(mpc_realref(t)) && !mpfr_zero_p(mpc_realref(t))) ||
+            (!mpfr_regular_p(mpc_imagref(t)) && !mpfr_zero_p(mpc_imagref(t))) ||
+            (GMPy_Poly_CanRound(mpc_realref(t), ea, rprec, MPC_RND_RE(rnd)) &&
+             GMPy_Poly_CanRound(mpc_imagref(t), eb, iprec, MPC_RND_IM(rnd))) ||
+            !(rwp = GMPy_Poly_NextPrec(rwp)) || !(iwp = GMPy_Poly_NextPrec(iwp))) {
+            break;
+        }
+        mpfr_set_prec(mpc_realref(t), rwp);
+        mpfr_set_prec(mpc_imagref(t), iwp);
+    }
+
+    flags = mpfr_flags_save();
+    mpfr_flags_clear(MPFR_FLAGS_INEXACT | MPFR_FLAGS_UNDERFLOW);
+    inex = mpc_set(r, t, rnd);
+    mpfr_flags_set(flags & ~(MPFR_FLAGS_INEXACT | MPFR_FLAGS_UNDERFLOW) & MPFR_FLAGS_ALL);
+
+    mpc_clear(t);
+    mpfr_clears(ea, eb, na, nb, (mpfr_ptr)0);
+    mpfr_clear(u);
+    mpfr_clear(xc);
+    mpfr_clear(xd);
+    return inex;
+}
+
+static mpfr_prec_t
+GMPy_Poly_Guard(GMPy_Poly *p)
+{
+    mpfr_prec_t guard = GMPY_POLY_GUARD;
+    Py_ssize_t n;
+
+    for (n = p->n; n > 1; n >>= 1) {
+        guard++;
+    }
+    return guard;
+}
+
+/* Evaluate p at x, which has already been converted to p->kind. A zero
+ * of the right type is returned for an empty polynomial.
+ */
+
+static PyObject *
+GMPy_Poly_Eval(GMPy_Poly *p, PyObject *x, CTXT_Object *context)
+{
+    mpfr_prec_t guard = GMPy_Poly_Guard(p);
+
+    if (p->kind == GMPY_POLY_INTEGER) {
+        MPZ_Object *result;
+
+        if ((result = GMPy_MPZ_New(context))) {
+            if (p->n == 0) {
+                mpz_set_ui(result->z, 0);
+            }
+            else {
+                GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+                GMPy_Poly_Eval_MPZ(result->z, p, MPZ(x));
+                GMPY_MAYBE_END_ALLOW_THREADS(context);
+            }
+        }
+        return (PyObject*)result;
+    }
+
+    if (p->kind == GMPY_POLY_RATIONAL) {
+        MPQ_Object *result;
+
+        if ((result = GMPy_MPQ_New(context))) {
+            if (p->n == 0) {
+                mpq_set_ui(result->q, 0, 1);
+            }
+            else {
+                GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+                GMPy_Poly_Eval_MPQ(result->q, p, MPQ(x));
+                GMPY_MAYBE_END_ALLOW_THREADS(context);
+            }
+        }
+        return (PyObject*)result;
+    }
+
+    if (p->kind == GMPY_POLY_REAL) {
+        MPFR_Object *result;
+
+        if (!(result = GMPy_MPFR_New(0, context))) {
+            /* LCOV_EXCL_START */
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+
+        mpfr_clear_flags();
+        if (p->n == 0) {
+            mpfr_set_zero(result->f, 1);
+            result->rc = 0;
+        }
+        else {
+            GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+            result->rc = GMPy_Poly_Eval_MPFR(result->f, p, MPFR(x), guard, GET_MPFR_ROUND(context));
+            GMPY_MAYBE_END_ALLOW_THREADS(context);
+        }
+        _GMPy_MPFR_Cleanup(&result, context);
+        return (PyObject*)result;
+    }
+    else {
+        MPC_Object *result;
+
+        if (!(result = GMPy_MPC_New(0, 0, context))) {
+            /* LCOV_EXCL_START */
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+
+        mpfr_clear_flags();
+        if (p->n == 0) {
+            mpc_set_ui(result->c, 0, MPC_RNDNN);
+            result->rc = 0;
+        }
+        else {
+            GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+            result->rc = GMPy_Poly_Eval_MPC(result->c, p, MPC(x), guard, GET_MPC_ROUND(context));
+            GMPY_MAYBE_END_ALLOW_THREADS(context);
+        }
+        _GMPy_MPC_Cleanup(&result, context);
+        return (PyObject*)result;
+    }
+}
+
+PyDoc_STRVAR(GMPy_doc_function_polyval,
+"polyval(coeffs, x, /) -> mpz | mpq | mpfr | mpc\n\n"
+"Return the value at x of the polynomial with coefficients coeffs, given\n"
+"from the highest degree to the constant term. The result has the most\n"
+"general type of x and the coefficients. Integer and rational results\n"
+"are exact; real and complex results are correctly rounded using the\n"
+"current context.");
+
+PyDoc_STRVAR(GMPy_doc_context_polyval,
+"context.polyval(coeffs, x, /) -> mpz | mpq | mpfr | mpc\n\n"
+"Return the value at x of the polynomial with coefficients coeffs, given\n"
+"from the highest degree to the constant term. The result has the most\n"
+"general type of x and the coefficients. Integer and rational results\n"
+"are exact; real and complex results are correctly rounded using the\n"
+"context.");
+
+static PyObject *
+GMPy_Context_Polyval(PyObject *self, PyObject *args)
+{
+    PyObject *seq, *x, *tempx, *result = NULL;
+    GMPy_Poly p = {0};
+    int kind, xkind;
+    CTXT_Object *context = NULL;
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("polyval() requires 2 arguments");
+        return NULL;
+    }
+
+    x = PyTuple_GET_ITEM(args, 1);
+    if (!(xkind = GMPy_Poly_Kind(GMPy_ObjectType(x)))) {
+        TYPE_ERROR("polyval() requires numeric arguments");
+        return NULL;
+    }
+
+    if (!(seq = PySequence_Fast(PyTuple_GET_ITEM(args, 0),
+                                "polyval() coefficients must be a sequence"))) {
+        return NULL;
+    }
+
+    if ((kind = GMPy_Poly_SeqKind(seq, "polyval")) < 0) {
+        Py_DECREF(seq);
+        return NULL;
+    }
+    kind = Py_MAX(kind, xkind);
+
+    if (GMPy_Poly_Init(&p, seq, kind, context) < 0) {
+        Py_DECREF(seq);
+        return NULL;
+    }
+    Py_DECREF(seq);
+
+    if ((tempx = GMPy_Poly_Convert(x, kind, context))) {
+        result = GMPy_Poly_Eval(&p, tempx, context);
+        Py_DECREF(tempx);
+    }
+    GMPy_Poly_Clear(&p);
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_polyval_many,
+"polyval_many(coeffs, xs, /) -> list | mpfr_array\n\n"
+"Return the values of the polynomial with coefficients coeffs at each\n"
+"number in xs. The coefficients are converted once and the results are\n"
+"computed as by polyval(). If xs is an mpfr_array and the coefficients\n"
+"are real, an mpfr_array with the precision of the current context is\n"
+"returned.");
+
+PyDoc_STRVAR(GMPy_doc_context_polyval_many,
+"context.polyval_many(coeffs, xs, /) -> list | mpfr_array\n\n"
+"Return the values of the polynomial with coefficients coeffs at each\n"
+"number in xs. The coefficients are converted once and the results are\n"
+"computed as by polyval(). If xs is an mpfr_array and the coefficients\n"
+"are real, an mpfr_array with the precision of the context is returned.");
+
+static PyObject *
+GMPy_Poly_Eval_Array(GMPy_Poly *p, MPFR_Array_Object *xs, CTXT_Object *context)
+{
+    MPFR_Array_Object *result;
+    mpfr_rnd_t rnd = GET_MPFR_ROUND(context);
+    mpfr_prec_t guard = GMPy_Poly_Guard(p);
+    Py_ssize_t i;
+
+    if (!(result = GMPy_MPFR_Array_New(xs->size, GET_MPFR_PREC(context)))) {
+        return NULL;
+    }
+
+    mpfr_clear_flags();
+    if (p->n == 0) {
+        for (i = 0; i < xs->size; i++) {
+            mpfr_set_zero(MPFR_ARRAY_ELEM(result, i), 1);
+        }
+    }
+    else {
+        GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+        for (i = 0; i < xs->size; i++) {
+            GMPy_Poly_Eval_MPFR(MPFR_ARRAY_ELEM(result, i), p,
+                                MPFR_ARRAY_ELEM(xs, i), guard, rnd);
+        }
+        GMPY_MAYBE_END_ALLOW_THREADS(context);
+    }
+
+    if (GMPy_MPFR_Array_Flags(context) < 0) {
+        Py_DECREF((PyObject*)result);
+        return NULL;
+    }
+    return (PyObject*)result;
+}
+
+static PyObject *
+GMPy_Context_Polyval_Many(PyObject *self, PyObject *args)
+{
+    PyObject *seq, *xseq = NULL, *xs, *tempx, *temp, *result = NULL;
+    GMPy_Poly p = {0};
+    Py_ssize_t i;
+    int kind, xkind;
+    CTXT_Object *context = NULL;
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("polyval_many() requires 2 arguments");
+        return NULL;
+    }
+
+    if (!(seq = PySequence_Fast(PyTuple_GET_ITEM(args, 0),
+                                "polyval_many() coefficients must be a sequence"))) {
+        return NULL;
+    }
+
+    if ((kind = GMPy_Poly_SeqKind(seq, "polyval_many")) < 0) {
+        goto cleanup;
+    }
+
+    xs = PyTuple_GET_ITEM(args, 1);
+    if (MPFR_Array_Check(xs)) {
+        if (kind == GMPY_POLY_COMPLEX) {
+            TYPE_ERROR("polyval_many() does not support complex coefficients with mpfr_array");
+            goto cleanup;
+        }
+        if (GMPy_Poly_Init(&p, seq, GMPY_POLY_REAL, context) == 0) {
+            result = GMPy_Poly_Eval_Array(&p, (MPFR_Array_Object*)xs, context);
+        }
+        goto cleanup;
+    }
+
+    if (!(xseq = PySequence_Fast(xs, "polyval_many() argument must be a sequence"))) {
+        goto cleanup;
+    }
+
+    if ((xkind = GMPy_Poly_SeqKind(xseq, "polyval_many")) < 0) {
+        goto cleanup;
+    }
+    kind = Py_MAX(kind, xkind);
+
+    if (GMPy_Poly_Init(&p, seq, kind, context) < 0) {
+        goto cleanup;
+    }
+
+    if (!(result = PyList_New(PySequence_Fast_GET_SIZE(xseq)))) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < PySequence_Fast_GET_SIZE(xseq); i++) {
+        temp = NULL;
+        if ((tempx = GMPy_Poly_Convert(PySequence_Fast_GET_ITEM(xseq, i), kind, context))) {
+            temp = GMPy_Poly_Eval(&p, tempx, context);
+            Py_DECREF(tempx);
+        }
+        if (!temp) {
+            Py_CLEAR(result);
+            goto cleanup;
+        }
+        PyList_SET_ITEM(result, i, temp);
+    }
+
+  cleanup:
+    GMPy_Poly_Clear(&p);
+    Py_XDECREF(xseq);
+    Py_DECREF(seq);
+    return result;
+}
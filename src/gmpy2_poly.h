@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_poly.h                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000 - 2009 Alex Martelli                                     *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_POLY_H
+#define GMPY_POLY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Kinds of polynomial evaluation, in order of increasing generality. */
+
+#define GMPY_POLY_INTEGER   1
+#define GMPY_POLY_RATIONAL  2
+#define GMPY_POLY_REAL      3
+#define GMPY_POLY_COMPLEX   4
+
+/* The coefficients of a polynomial, highest degree first, converted to
+ * the type used for the evaluation.
+ */
+
+typedef struct {
+    Py_ssize_t n;                    /* number of coefficients */
+    int kind;                        /* GMPY_POLY_INTEGER ... COMPLEX */
+    PyObject **c;                    /* converted coefficients */
+} GMPy_Poly;
+
+static PyObject * GMPy_Context_Polyval(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_Polyval_Many(PyObject *self, PyObject *args);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -45,6 +45,17 @@
 static PyObject *
 GMPy_Integer_PowWithType(PyObject *b, int btype, PyObject *e, int etype,
                          PyObject *m, CTXT_Object *context)
+{
+    return GMPy_Integer_PowWithTypeOut(b, btype, e, etype, m, NULL, context);
+}
+
+/* As GMPy_Integer_PowWithType() but stores the result in out if out is
+ * not NULL. Only powmod() passes out, so the modulus is always present.
+ */
+
+static PyObject *
+GMPy_Integer_PowWithTypeOut(PyObject *b, int btype, PyObject *e, int etype,
+                            PyObject *m, PyObject *out, CTXT_Object *context)
 {
     MPZ_Object *result = NULL, *tempb = NULL, *tempe = NULL, *tempm = NULL;
     int has_mod, mtype;
@@ -70,7 +81,7 @@ GMPy_Integer_PowWithType(PyObject *b, int btype, PyObject *e, int etype,
         }
     }
 
-    if (!(result = GMPy_MPZ_New(context)) ||
+    if (!(result = GMPy_MPZ_NewOut(out, context)) ||
         !(tempb = GMPy_MPZ_From_IntegerWithType(b, btype, context)) ||
         !(tempe = GMPy_MPZ_From_IntegerWithType(e, etype, context))) {
         goto err;
@@ -149,20 +160,19 @@ GMPy_Integer_PowWithType(PyObject *b, int btype, PyObject *e, int etype,
             if (has_inverse) {
                 mpz_abs(exp, tempe->z);
                 mpz_powm(result->z, base, exp, mm);
+
+                /* Python uses a rather peculiar convention for negative
+                 * modulos. If the modulo is negative, result should be in
+                 * the interval m < r <= 0 .
+                 */
+                if ((sign < 0) && (mpz_sgn(result->z) > 0)) {
+                    mpz_add(result->z, result->z, tempm->z);
+                }
             }
             mpz_clear(base);
             mpz_clear(exp);
             mpz_clear(mm);
 
-            /* Python uses a rather peculiar convention for negative modulos
-            * If the modulo is negative, result should be in the interval
-            * m < r <= 0 .
-            */
-            if ((sign < 0) && (mpz_sgn(result->z) > 0)) {
-                mpz_add(result->z, result->z, tempm->z);
-            }
-
-
             if (!has_inverse) {
                 VALUE_ERROR("pow() base not invertible");
                 goto err;
@@ -642,24 +652,30 @@ GMPy_Complex_PowWithType(PyObject *base, int btype, PyObject *exp, int etype,
 }
 
 PyDoc_STRVAR(GMPy_doc_integer_powmod,
-"powmod(x, y, m, /) -> mpz\n\n"
+"powmod(x, y, m, /, out=None) -> mpz\n\n"
 "Return (x**y) mod m. Same as the three argument version of Python's\n"
-"built-in `pow`, but converts all three arguments to `mpz`.");
+"built-in `pow`, but converts all three arguments to `mpz`. If out is\n"
+"an `xmpz`, the result is stored in out and out is returned.");
 
 static PyObject *
-GMPy_Integer_PowMod(PyObject *self, PyObject *args)
+GMPy_Integer_PowMod(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames)
 {
-    PyObject *x, *y, *m;
+    PyObject *x, *y, *m, *out;
     int xtype, ytype, mtype;
 
-    if (PyTuple_GET_SIZE(args) != 3) {
+    if (nargs != 3) {
         TYPE_ERROR("powmod() requires 3 arguments.");
         return NULL;
     }
 
-    x = PyTuple_GET_ITEM(args, 0);
-    y = PyTuple_GET_ITEM(args, 1);
-    m = PyTuple_GET_ITEM(args, 2);
+    if (GMPy_XMPZ_ParseOut(args, nargs, kwnames, "powmod", &out) < 0) {
+        return NULL;
+    }
+
+    x = args[0];
+    y = args[1];
+    m = args[2];
 
     xtype = GMPy_ObjectType(x);
     ytype = GMPy_ObjectType(y);
@@ -668,7 +684,7 @@ GMPy_Integer_PowMod(PyObject *self, PyObject *args)
     if (IS_TYPE_INTEGER(xtype) &&
         IS_TYPE_INTEGER(ytype) &&
         IS_TYPE_INTEGER(mtype)) {
-        return GMPy_Integer_PowWithType(x, xtype, y, ytype, m, NULL);
+        return GMPy_Integer_PowWithTypeOut(x, xtype, y, ytype, m, out, NULL);
     }
 
     TYPE_ERROR("powmod() argument types not supported");
@@ -36,10 +36,11 @@ extern "C" {
 static PyObject * GMPy_Number_Pow_Slot(PyObject *base, PyObject *exp, PyObject *mod);
 
 static PyObject * GMPy_Integer_PowWithType(PyObject *base, int btype, PyObject *exp, int etype, PyObject *mod, CTXT_Object *context);
+static PyObject * GMPy_Integer_PowWithTypeOut(PyObject *base, int btype, PyObject *exp, int etype, PyObject *mod, PyObject *out, CTXT_Object *context);
 static PyObject * GMPy_Rational_PowWithType(PyObject *base, int btype, PyObject *exp, int etype, PyObject *mod, CTXT_Object *context);
 static PyObject * GMPy_Real_PowWithType(PyObject *base, int btype, PyObject *exp, int etype, PyObject *mod, CTXT_Object *context);
 static PyObject * GMPy_Complex_PowWithType(PyObject *base, int btype, PyObject *exp, int etype, PyObject *mod, CTXT_Object *context);
-static PyObject * GMPy_Integer_PowMod(PyObject *self, PyObject *args);
+static PyObject * GMPy_Integer_PowMod(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 static PyObject * GMPy_Integer_PowMod_Sec(PyObject *self, PyObject *args);
 
 static PyObject * GMPy_Context_Pow(PyObject *self, PyObject *args);
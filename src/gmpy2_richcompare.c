@@ -53,6 +53,18 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
     atype = GMPy_ObjectType(a);
     btype = GMPy_ObjectType(b);
 
+    /* Comparisons only read their operands so the mutable types can use the
+     * code paths of the immutable types.
+     */
+
+    if (IS_TYPE_XMPQ(atype)) atype = OBJ_TYPE_MPQ;
+    else if (IS_TYPE_XMPFR(atype)) atype = OBJ_TYPE_MPFR;
+    else if (IS_TYPE_XMPC(atype)) atype = OBJ_TYPE_MPC;
+
+    if (IS_TYPE_XMPQ(btype)) btype = OBJ_TYPE_MPQ;
+    else if (IS_TYPE_XMPFR(btype)) btype = OBJ_TYPE_MPFR;
+    else if (IS_TYPE_XMPC(btype)) btype = OBJ_TYPE_MPC;
+
     if (IS_TYPE_MPZANY(atype)) {
         if (IS_TYPE_PyInteger(btype)) {
             int error;
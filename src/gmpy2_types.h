@@ -40,6 +40,7 @@ typedef struct {
 typedef struct {
     PyObject_HEAD
     mpz_t z;
+    struct gmpy_rank_dir *rank;  /* rank/select directory or NULL */
 } XMPZ_Object;
 
 typedef struct {
@@ -48,6 +49,17 @@ typedef struct {
     Py_hash_t  hash_cache;
 } MPQ_Object;
 
+/* The mutable types share the layout of the immutable types so the MPQ(),
+ * MPFR() and MPC() macros and the conversion functions apply to both. The
+ * hash_cache field is never used.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    mpq_t q;
+    Py_hash_t  hash_cache;
+} XMPQ_Object;
+
 typedef struct {
     PyObject_HEAD
     mpfr_t f;
@@ -55,6 +67,13 @@ typedef struct {
     int rc;
 } MPFR_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpfr_t f;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPFR_Object;
+
 typedef struct {
     PyObject_HEAD
     mpc_t c;
@@ -62,6 +81,13 @@ typedef struct {
     int rc;
 } MPC_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpc_t c;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPC_Object;
+
 typedef struct {
     PyObject_HEAD
     gmp_randstate_t state;
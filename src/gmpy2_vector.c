@@ -24,88 +24,318 @@
  * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-/* The following code was a test case for creating a gmpy2 function that would
- * apply an MPFR function to all the elements of a list. It was slightly faster
- * than map(gmpy2.list, <<list>>) but not enough to justify the effort. The
- * code is left for possible future use.
+/* vec() applies an MPFR or MPC function to every element of one or two
+ * sequences in a single call. All the arguments are converted and all the
+ * result objects are allocated before any computation is done, so the
+ * computation itself runs without the GIL and can be split across several
+ * threads when MPFR is built to be thread-safe.
  */
 
-PyDoc_STRVAR(GMPy_doc_function_vector,
-"vector(iterable, /) -> list\n\n"
-"Template for applying a function to an iterable.");
+static const GMPy_VecFunc GMPy_vec_funcs[] = {
+    { "abs", .mpfr1 = mpfr_abs, .range = GMPY_RANGE_SPLIT0 },
+    { "acos", .mpfr1 = mpfr_acos, .mpc1 = mpc_acos,
+      .range = GMPY_RANGE_MONOTONE },
+    { "acosh", .mpfr1 = mpfr_acosh, .mpc1 = mpc_acosh,
+      .range = GMPY_RANGE_MONOTONE },
+    { "add", .mpfr2 = mpfr_add, .mpc2 = mpc_add, .range = GMPY_RANGE_CORNERS },
+    { "agm", .mpfr2 = mpfr_agm,
+      .range = GMPY_RANGE_CORNERS | GMPY_RANGE_X_POSITIVE | GMPY_RANGE_Y_POSITIVE },
+    { "ai", .mpfr1 = mpfr_ai },
+    { "asin", .mpfr1 = mpfr_asin, .mpc1 = mpc_asin,
+      .range = GMPY_RANGE_MONOTONE },
+    { "asinh", .mpfr1 = mpfr_asinh, .mpc1 = mpc_asinh,
+      .range = GMPY_RANGE_MONOTONE },
+    { "atan", .mpfr1 = mpfr_atan, .mpc1 = mpc_atan,
+      .range = GMPY_RANGE_MONOTONE },
+    { "atan2", .mpfr2 = mpfr_atan2,
+      .range = GMPY_RANGE_CORNERS | GMPY_RANGE_X_NONZERO | GMPY_RANGE_Y_NONZERO },
+    { "atanh", .mpfr1 = mpfr_atanh, .mpc1 = mpc_atanh,
+      .range = GMPY_RANGE_MONOTONE },
+    { "cbrt", .mpfr1 = mpfr_cbrt, .range = GMPY_RANGE_MONOTONE },
+    { "copy_sign", .mpfr2 = mpfr_copysign },
+    { "cos", .mpfr1 = mpfr_cos, .mpc1 = mpc_cos,
+      .range = GMPY_RANGE_LIPSCHITZ },
+    { "cosh", .mpfr1 = mpfr_cosh, .mpc1 = mpc_cosh,
+      .range = GMPY_RANGE_SPLIT0 },
+    { "cot", .mpfr1 = mpfr_cot, .range = GMPY_RANGE_COT },
+    { "coth", .mpfr1 = mpfr_coth, .range = GMPY_RANGE_SPLIT0 },
+    { "csc", .mpfr1 = mpfr_csc },
+    { "csch", .mpfr1 = mpfr_csch, .range = GMPY_RANGE_SPLIT0 },
+    { "digamma", .mpfr1 = mpfr_digamma },
+    { "div", .mpfr2 = mpfr_div, .mpc2 = mpc_div,
+      .range = GMPY_RANGE_CORNERS | GMPY_RANGE_Y_NONZERO },
+    { "eint", .mpfr1 = mpfr_eint, .range = GMPY_RANGE_SPLIT0 },
+    { "erf", .mpfr1 = mpfr_erf, .range = GMPY_RANGE_MONOTONE },
+    { "erfc", .mpfr1 = mpfr_erfc, .range = GMPY_RANGE_MONOTONE },
+    { "exp", .mpfr1 = mpfr_exp, .mpc1 = mpc_exp,
+      .range = GMPY_RANGE_MONOTONE },
+    { "exp10", .mpfr1 = mpfr_exp10, .range = GMPY_RANGE_MONOTONE },
+    { "exp2", .mpfr1 = mpfr_exp2, .range = GMPY_RANGE_MONOTONE },
+    { "expm1", .mpfr1 = mpfr_expm1, .range = GMPY_RANGE_MONOTONE },
+    { "fmod", .mpfr2 = mpfr_fmod },
+    { "frac", .mpfr1 = mpfr_frac },
+    { "gamma", .mpfr1 = mpfr_gamma },
+    { "gamma_inc", .mpfr2 = mpfr_gamma_inc },
+    { "hypot", .mpfr2 = mpfr_hypot,
+      .range = GMPY_RANGE_CORNERS | GMPY_RANGE_X_NONZERO | GMPY_RANGE_Y_NONZERO },
+    { "j0", .mpfr1 = mpfr_j0 },
+    { "j1", .mpfr1 = mpfr_j1 },
+    { "li2", .mpfr1 = mpfr_li2 },
+    { "lngamma", .mpfr1 = mpfr_lngamma },
+    { "log", .mpfr1 = mpfr_log, .mpc1 = mpc_log,
+      .range = GMPY_RANGE_MONOTONE },
+    { "log10", .mpfr1 = mpfr_log10, .mpc1 = mpc_log10,
+      .range = GMPY_RANGE_MONOTONE },
+    { "log1p", .mpfr1 = mpfr_log1p, .range = GMPY_RANGE_MONOTONE },
+    { "log2", .mpfr1 = mpfr_log2, .range = GMPY_RANGE_MONOTONE },
+    { "maxnum", .mpfr2 = mpfr_max, .range = GMPY_RANGE_CORNERS },
+    { "minnum", .mpfr2 = mpfr_min, .range = GMPY_RANGE_CORNERS },
+    { "mul", .mpfr2 = mpfr_mul, .mpc2 = mpc_mul, .range = GMPY_RANGE_CORNERS },
+    { "neg", .mpfr1 = mpfr_neg, .mpc1 = mpc_neg,
+      .range = GMPY_RANGE_MONOTONE },
+    { "pow", .mpfr2 = mpfr_pow, .mpc2 = mpc_pow,
+      .range = GMPY_RANGE_CORNERS | GMPY_RANGE_X_POSITIVE },
+    { "proj", .mpc1 = mpc_proj },
+    { "rec_sqrt", .mpfr1 = mpfr_rec_sqrt, .range = GMPY_RANGE_MONOTONE },
+    { "remainder", .mpfr2 = mpfr_remainder },
+    { "rint", .mpfr1 = mpfr_rint },
+    { "rint_ceil", .mpfr1 = mpfr_rint_ceil, .range = GMPY_RANGE_MONOTONE },
+    { "rint_floor", .mpfr1 = mpfr_rint_floor, .range = GMPY_RANGE_MONOTONE },
+    { "rint_round", .mpfr1 = mpfr_rint_round, .range = GMPY_RANGE_MONOTONE },
+    { "rint_trunc", .mpfr1 = mpfr_rint_trunc, .range = GMPY_RANGE_MONOTONE },
+    { "sec", .mpfr1 = mpfr_sec },
+    { "sech", .mpfr1 = mpfr_sech, .range = GMPY_RANGE_SPLIT0 },
+    { "sin", .mpfr1 = mpfr_sin, .mpc1 = mpc_sin,
+      .range = GMPY_RANGE_LIPSCHITZ },
+    { "sinh", .mpfr1 = mpfr_sinh, .mpc1 = mpc_sinh,
+      .range = GMPY_RANGE_MONOTONE },
+    { "sqrt", .mpfr1 = mpfr_sqrt, .mpc1 = mpc_sqrt,
+      .range = GMPY_RANGE_MONOTONE },
+    { "square", .mpfr1 = mpfr_sqr, .mpc1 = mpc_sqr,
+      .range = GMPY_RANGE_SPLIT0 },
+    { "sub", .mpfr2 = mpfr_sub, .mpc2 = mpc_sub, .range = GMPY_RANGE_CORNERS },
+    { "tan", .mpfr1 = mpfr_tan, .mpc1 = mpc_tan, .range = GMPY_RANGE_TAN },
+    { "tanh", .mpfr1 = mpfr_tanh, .mpc1 = mpc_tanh,
+      .range = GMPY_RANGE_MONOTONE },
+    { "y0", .mpfr1 = mpfr_y0 },
+    { "y1", .mpfr1 = mpfr_y1 },
+    { "zeta", .mpfr1 = mpfr_zeta },
+    { NULL }
+};
+
+/* The smallest number of elements handed to a worker thread. */
+
+#define VEC_MIN_CHUNK 64
+
+/* One contiguous slice of the work. The y arguments are indexed with
+ * i * ystep so a single scalar can be broadcast by setting ystep to 0.
+ */
 
-PyDoc_STRVAR(GMPy_doc_context_vector,
-"vector(iterable, /) -> list\n\n"
-"Template for applying a function to an iterable.");
+typedef struct {
+    const GMPy_VecFunc *func;
+    int complex;
+    mpfr_ptr *r;
+    mpfr_srcptr *x, *y;
+    mpc_ptr *cr;
+    mpc_srcptr *cx, *cy;
+    int *rc;
+    Py_ssize_t start, stop, ystep;
+    mpfr_rnd_t rnd;
+    mpc_rnd_t crnd;
+    mpfr_flags_t flags;
+    PyThread_type_lock done;
+} GMPy_VecTask;
+
+/* Return the entry for func, which may be a name or a gmpy2 function.
+ * caller is the name of the Python function used in error messages.
+ */
 
-static PyObject *
-GMPy_Context_Vector(PyObject *self, PyObject *other)
+static const GMPy_VecFunc *
+GMPy_Vec_Lookup(PyObject *func, const char *caller)
 {
-    PyObject *result, *tempres;
-    Py_ssize_t i, seq_length;
-
-    CTXT_Object *context = NULL;
+    const GMPy_VecFunc *f;
+    PyObject *name = NULL;
+    const char *cname;
 
-    if (self && CTXT_Check(self)) {
-        context = (CTXT_Object*)self;
+    if (PyUnicode_Check(func)) {
+        Py_INCREF(func);
+        name = func;
     }
-    else {
-        CHECK_CONTEXT(context);
+    else if (PyCFunction_Check(func)) {
+        /* Accept gmpy2.sin or context.sin, but not e.g. math.sin. */
+        PyObject *owner = PyCFunction_GET_SELF(func);
+
+        if (owner && (CTXT_Check(owner) ||
+                      (PyModule_Check(owner) &&
+                       !strncmp(PyModule_GetName(owner), "gmpy2", 5)))) {
+            name = PyObject_GetAttrString(func, "__name__");
+        }
     }
 
-    if (!(other = PySequence_List(other))) {
-        TYPE_ERROR("argument must be an iterable");
+    if (!name) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() requires a function name or a gmpy2 function", caller);
+        }
         return NULL;
     }
 
-    /* other contains a new list containing all the values from the
-     * iterable. Create a list to store the results.
-     */
-
-    seq_length = PyList_GET_SIZE(other);
-    if (!(result = PyList_New(seq_length))) {
-        Py_DECREF(other);
+    if (!(cname = PyUnicode_AsUTF8(name))) {
+        Py_DECREF(name);
         return NULL;
     }
 
-    /* Iterate through the list. */
-
-    for (i=0; i < seq_length; i++) {
-        if (!(tempres = GMPy_Number_Sin(PyList_GET_ITEM(other, i), context))) {
-            Py_DECREF(other);
-            Py_DECREF(result);
-            TYPE_ERROR("all items in iterable must be numbers");
-            return NULL;
+    for (f = GMPy_vec_funcs; f->name; f++) {
+        if (!strcmp(f->name, cname)) {
+            Py_DECREF(name);
+            return f;
         }
+    }
 
-        if (PyList_SetItem(result, i, tempres) < 0) {
-            Py_DECREF(other);
-            Py_DECREF(result);
-            return NULL;
+    PyErr_Format(PyExc_ValueError, "%s() does not support '%s'", caller, cname);
+    Py_DECREF(name);
+    return NULL;
+}
+
+static void
+GMPy_Vec_Run(GMPy_VecTask *t)
+{
+    const GMPy_VecFunc *f = t->func;
+    Py_ssize_t i;
+
+    if (t->complex) {
+        if (f->mpc2) {
+            for (i = t->start; i < t->stop; i++) {
+                t->rc[i] = f->mpc2(t->cr[i], t->cx[i], t->cy[i * t->ystep], t->crnd);
+            }
+        }
+        else {
+            for (i = t->start; i < t->stop; i++) {
+                t->rc[i] = f->mpc1(t->cr[i], t->cx[i], t->crnd);
+            }
         }
     }
+    else {
+        if (f->mpfr2) {
+            for (i = t->start; i < t->stop; i++) {
+                t->rc[i] = f->mpfr2(t->r[i], t->x[i], t->y[i * t->ystep], t->rnd);
+            }
+        }
+        else {
+            for (i = t->start; i < t->stop; i++) {
+                t->rc[i] = f->mpfr1(t->r[i], t->x[i], t->rnd);
+            }
+        }
+    }
+}
 
-    Py_DECREF(other);
+/* Entry point for the worker threads. The MPFR flags are thread-local so
+ * they are saved for the calling thread to merge.
+ */
 
-    return (PyObject*)result;
-}
+static void
+GMPy_Vec_Worker(void *arg)
+{
+    GMPy_VecTask *t = (GMPy_VecTask*)arg;
 
-PyDoc_STRVAR(GMPy_doc_function_vector2,
-"vector2(iterable, iterable, /) -> list\n\n"
-"Template for applying a function to a pair of iterables.");
+    mpfr_clear_flags();
+    GMPy_Vec_Run(t);
+    t->flags = mpfr_flags_save();
+    mpfr_free_cache2(MPFR_FREE_LOCAL_CACHE);
+    PyThread_release_lock(t->done);
+}
 
-PyDoc_STRVAR(GMPy_doc_context_vector2,
-"vector2(iterable, /) -> list\n\n"
-"Template for applying a function to a pair of iterables.");
+/* Split the work described by base across nthreads tasks. The calling
+ * thread always processes the first slice itself. Must be called without
+ * the GIL; on return the MPFR flags of the calling thread include the
+ * flags raised by every slice.
+ */
 
-static PyObject *
-GMPy_Context_Vector2(PyObject *self, PyObject *args)
+static void
+GMPy_Vec_Compute(GMPy_VecTask *base, GMPy_VecTask *tasks, Py_ssize_t n,
+                 int nthreads)
 {
-    PyObject *arg1, *arg2, *result;
-    MPFR_Object *tempres;
+    Py_ssize_t chunk = (n + nthreads - 1) / nthreads;
+    int i;
+
+    mpfr_clear_flags();
+
+    for (i = 0; i < nthreads; i++) {
+        tasks[i] = *base;
+        tasks[i].start = i * chunk;
+        tasks[i].stop = Py_MIN(n, (i + 1) * chunk);
+        tasks[i].done = NULL;
+        if (i == 0) {
+            continue;
+        }
+        if (!(tasks[i].done = PyThread_allocate_lock())) {
+            continue;
+        }
+        PyThread_acquire_lock(tasks[i].done, WAIT_LOCK);
+        if (PyThread_start_new_thread(GMPy_Vec_Worker, &tasks[i]) ==
+            PYTHREAD_INVALID_THREAD_ID) {
+            PyThread_release_lock(tasks[i].done);
+            PyThread_free_lock(tasks[i].done);
+            tasks[i].done = NULL;
+        }
+    }
 
-    Py_ssize_t i, seq_length;
+    /* Slices that could not be handed to a thread are done here. */
 
+    for (i = 0; i < nthreads; i++) {
+        if (!tasks[i].done) {
+            GMPy_Vec_Run(&tasks[i]);
+        }
+    }
+
+    for (i = 1; i < nthreads; i++) {
+        if (tasks[i].done) {
+            PyThread_acquire_lock(tasks[i].done, WAIT_LOCK);
+            PyThread_free_lock(tasks[i].done);
+            mpfr_flags_set(tasks[i].flags);
+        }
+    }
+}
+
+PyDoc_STRVAR(GMPy_doc_function_vec,
+"vec(func, x, y=None, /, *, out=None, threads=1) -> list\n\n"
+"Return [func(a) for a in x], or [func(a, b) for a, b in zip(x, y)] if\n"
+"func is a binary function, computed in a single call. func is either\n"
+"a gmpy2 function such as gmpy2.sin or its name. x and y are iterables\n"
+"of numbers; y may also be a single number that is used for every\n"
+"element of x. If any argument is complex, the MPC version of func is\n"
+"used, otherwise the MPFR version. Real arguments are never promoted to\n"
+"complex results, regardless of context.allow_complex.\n\n"
+"All the arguments are checked and converted before any computation is\n"
+"done. x, y and out may also be mpfr_array instances, which are used in\n"
+"place. If x or y is an mpfr_array, the result is a new mpfr_array.\n"
+"If out is given, it must be a list or an mpfr_array of the same length\n"
+"as x; the results are stored in it and it is returned. Results have the\n"
+"precision of the context, or of out if it is an mpfr_array.\n\n"
+"If threads is greater than 1 and MPFR is thread-safe, the computation\n"
+"is split across that many threads. The GIL is released if threads is\n"
+"greater than 1 or if context.allow_release_gil is True.");
+
+PyDoc_STRVAR(GMPy_doc_context_vec,
+"context.vec(func, x, y=None, /, *, out=None, threads=1) -> list\n\n"
+"Return [func(a) for a in x], or [func(a, b) for a, b in zip(x, y)] if\n"
+"func is a binary function, computed in a single call using the\n"
+"precision and rounding of the context. See gmpy2.vec() for details.");
+
+static PyObject *
+GMPy_Context_Vec(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"", "", "", "out", "threads", NULL};
+    PyObject *func, *x, *y = NULL, *out = Py_None, *result = NULL;
+    PyObject *xseq = NULL, *yseq = NULL;
+    PyObject **tempx = NULL, **res = NULL;
+    MPFR_Array_Object *xa = NULL, *ya = NULL, *resarr = NULL;
+    void **ptrs = NULL;
+    int *rc = NULL, *xtypes = NULL, is_complex = 0;
+    int threads = 1, nthreads;
+    Py_ssize_t i, n, ny = 0;
+    const GMPy_VecFunc *f;
+    GMPy_VecTask base, *tasks = NULL;
     CTXT_Object *context = NULL;
 
     if (self && CTXT_Check(self)) {
@@ -115,70 +345,280 @@ GMPy_Context_Vector2(PyObject *self, PyObject *args)
         CHECK_CONTEXT(context);
     }
 
-    if (PyTuple_GET_SIZE(args) != 2) {
-        TYPE_ERROR("vector2() requires 2 arguments");
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O$Oi", kwlist,
+                                     &func, &x, &y, &out, &threads)) {
         return NULL;
     }
 
-    if (!(arg1 = PySequence_List(PyTuple_GET_ITEM(args, 0)))) {
-        TYPE_ERROR("argument must be an iterable");
-        return NULL;
+    if (y == Py_None) {
+        y = NULL;
     }
 
-    if (!(arg2 = PySequence_List(PyTuple_GET_ITEM(args, 1)))) {
-        Py_DECREF(arg1);
-        TYPE_ERROR("argument must be an iterable");
+    if (threads < 1) {
+        VALUE_ERROR("vec() requires threads >= 1");
         return NULL;
     }
 
+    if (!(f = GMPy_Vec_Lookup(func, "vec"))) {
+        return NULL;
+    }
 
-    /* other contains a new list containing all the values from the
-     * iterable. Create a list to store the results.
-     */
-
-    if (PyList_GET_SIZE(arg1) != PyList_GET_SIZE(arg2)) {
-        Py_DECREF(arg1);
-        Py_DECREF(arg2);
-        TYPE_ERROR("arguments must be the same length");
+    if ((f->mpfr2 || f->mpc2) && !y) {
+        PyErr_Format(PyExc_TypeError, "vec() '%s' requires 2 arguments", f->name);
         return NULL;
     }
 
-    seq_length = PyList_GET_SIZE(arg1);
-    if (!(result = PyList_New(seq_length))) {
-        Py_DECREF(arg1);
-        Py_DECREF(arg2);
+    if ((f->mpfr1 || f->mpc1) && y) {
+        PyErr_Format(PyExc_TypeError, "vec() '%s' requires 1 argument", f->name);
         return NULL;
     }
 
-    /* Iterate through the list. */
-
-    for (i=0; i < seq_length; i++) {
-        //~ if (!(tempres = GMPy_Number_Mul(PyList_GET_ITEM(arg1, i),
-                                        //~ PyList_GET_ITEM(arg2, i),
-                                        //~ context))) {
-            //~ Py_DECREF(arg1);
-            //~ Py_DECREF(arg2);
-            //~ Py_DECREF(result);
-            //~ TYPE_ERROR("all items in iterable must be numbers");
-            //~ return NULL;
-        //~ }
-
-        tempres = GMPy_MPFR_New(0, context);
-        tempres->rc = mpfr_mul(tempres->f,
-                               MPFR(PyList_GET_ITEM(arg1, i)),
-                               MPFR(PyList_GET_ITEM(arg2, i)),
-                               GET_MPFR_ROUND(context));
-
-        if (PyList_SetItem(result, i, (PyObject*)tempres) < 0) {
-            Py_DECREF(arg1);
-            Py_DECREF(arg2);
-            Py_DECREF(result);
+    /* mpfr_array arguments are used in place. Everything else is first
+     * converted to a sequence.
+     */
+
+    if (MPFR_Array_Check(x)) {
+        xa = (MPFR_Array_Object*)x;
+        n = xa->size;
+    }
+    else {
+        if (!(xseq = PySequence_Fast(x, "vec() argument must be an iterable"))) {
             return NULL;
         }
+        n = PySequence_Fast_GET_SIZE(xseq);
     }
 
-    Py_DECREF(arg1);
-    Py_DECREF(arg2);
+    if (y) {
+        if (MPFR_Array_Check(y)) {
+            ya = (MPFR_Array_Object*)y;
+            ny = ya->size;
+        }
+        else if (IS_TYPE_COMPLEX(GMPy_ObjectType(y))) {
+            if (!(yseq = PyTuple_Pack(1, y))) {
+                goto cleanup;
+            }
+            ny = 1;
+        }
+        else {
+            if (!(yseq = PySequence_Fast(y, "vec() argument must be an iterable"))) {
+                goto cleanup;
+            }
+            ny = PySequence_Fast_GET_SIZE(yseq);
+        }
+        if (ny != n && (ya || ny != 1 || PySequence_Check(y))) {
+            VALUE_ERROR("vec() arguments must be the same length");
+            goto cleanup;
+        }
+    }
 
-    return (PyObject*)result;
+    if (MPFR_Array_Check(out)) {
+        Py_INCREF(out);
+        resarr = (MPFR_Array_Object*)out;
+    }
+    else if (out != Py_None && !PyList_Check(out)) {
+        TYPE_ERROR("vec() out must be a list or an mpfr_array");
+        goto cleanup;
+    }
+    if (out != Py_None && PyObject_Length(out) != n) {
+        VALUE_ERROR("vec() out must have the same length as x");
+        goto cleanup;
+    }
+
+    /* Check the types of all the arguments first. */
+
+    if (!(xtypes = PyMem_Calloc(n + ny + 1, sizeof(int)))) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    for (i = 0; i < n + ny; i++) {
+        PyObject *item;
+
+        if ((i < n) ? !xseq : !yseq) {
+            continue;
+        }
+        item = (i < n) ? PySequence_Fast_GET_ITEM(xseq, i)
+                       : PySequence_Fast_GET_ITEM(yseq, i - n);
+        xtypes[i] = GMPy_ObjectType(item);
+        if (IS_TYPE_REAL(xtypes[i])) {
+            continue;
+        }
+        if (IS_TYPE_COMPLEX(xtypes[i])) {
+            is_complex = 1;
+            continue;
+        }
+        TYPE_ERROR("vec() argument type not supported");
+        goto cleanup;
+    }
+
+    if (is_complex && (xa || ya || resarr)) {
+        TYPE_ERROR("vec() does not support complex arguments with mpfr_array");
+        goto cleanup;
+    }
+
+    if (is_complex ? !(f->mpc1 || f->mpc2) : !(f->mpfr1 || f->mpfr2)) {
+        PyErr_Format(PyExc_TypeError, "vec() '%s' does not support %s arguments",
+                     f->name, is_complex ? "complex" : "real");
+        goto cleanup;
+    }
+
+    /* Convert the arguments and allocate the results. The results are
+     * stored in a new mpfr_array if any argument is an mpfr_array.
+     */
+
+    if (!resarr && out == Py_None && (xa || ya)) {
+        if (!(resarr = GMPy_MPFR_Array_New(n, GET_MPFR_PREC(context)))) {
+            goto cleanup;
+        }
+    }
+
+    if (!(tempx = PyMem_Calloc(2 * n + ny + 1, sizeof(PyObject*))) ||
+        !(ptrs = PyMem_Calloc(2 * n + ny + 1, sizeof(void*))) ||
+        !(rc = PyMem_Calloc(n + 1, sizeof(int)))) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+    res = tempx + n + ny;
+
+    for (i = 0; i < n + ny; i++) {
+        PyObject *item;
+
+        if (i < n && xa) {
+            ptrs[i] = MPFR_ARRAY_ELEM(xa, i);
+            continue;
+        }
+        if (i >= n && ya) {
+            ptrs[i] = MPFR_ARRAY_ELEM(ya, i - n);
+            continue;
+        }
+        item = (i < n) ? PySequence_Fast_GET_ITEM(xseq, i)
+                       : PySequence_Fast_GET_ITEM(yseq, i - n);
+        if (is_complex) {
+            if (!(tempx[i] = (PyObject*)GMPy_MPC_From_ComplexWithType(item, xtypes[i], 1, 1, context))) {
+                goto cleanup;
+            }
+            ptrs[i] = MPC(tempx[i]);
+        }
+        else {
+            if (!(tempx[i] = (PyObject*)GMPy_MPFR_From_RealWithType(item, xtypes[i], 1, context))) {
+                goto cleanup;
+            }
+            ptrs[i] = MPFR(tempx[i]);
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        if (resarr) {
+            ptrs[n + ny + i] = MPFR_ARRAY_ELEM(resarr, i);
+        }
+        else if (is_complex) {
+            if (!(res[i] = (PyObject*)GMPy_MPC_New(0, 0, context))) {
+                goto cleanup;
+            }
+            ptrs[n + ny + i] = MPC(res[i]);
+        }
+        else {
+            if (!(res[i] = (PyObject*)GMPy_MPFR_New(0, context))) {
+                goto cleanup;
+            }
+            ptrs[n + ny + i] = MPFR(res[i]);
+        }
+    }
+
+    memset(&base, 0, sizeof(base));
+    base.func = f;
+    base.complex = is_complex;
+    base.x = (mpfr_srcptr*)ptrs;
+    base.y = (mpfr_srcptr*)(ptrs + n);
+    base.r = (mpfr_ptr*)(ptrs + n + ny);
+    base.cx = (mpc_srcptr*)ptrs;
+    base.cy = (mpc_srcptr*)(ptrs + n);
+    base.cr = (mpc_ptr*)(ptrs + n + ny);
+    base.rc = rc;
+    base.ystep = (ny == 1) ? 0 : 1;
+    base.rnd = GET_MPFR_ROUND(context);
+    base.crnd = GET_MPC_ROUND(context);
+
+#ifdef MPFR_USE_THREAD_SAFE
+    nthreads = (int)Py_MIN((Py_ssize_t)threads, (n + VEC_MIN_CHUNK - 1) / VEC_MIN_CHUNK);
+    nthreads = Py_MAX(nthreads, 1);
+#else
+    nthreads = 1;
+#endif
+
+    if (!(tasks = PyMem_Calloc(nthreads, sizeof(GMPy_VecTask)))) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    if (nthreads > 1) {
+        Py_BEGIN_ALLOW_THREADS;
+        GMPy_Vec_Compute(&base, tasks, n, nthreads);
+        Py_END_ALLOW_THREADS;
+    }
+    else {
+        GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+        GMPy_Vec_Compute(&base, tasks, n, 1);
+        GMPY_MAYBE_END_ALLOW_THREADS(context);
+    }
+
+    if (resarr) {
+        if (GMPy_MPFR_Array_Flags(context) == 0) {
+            result = (PyObject*)resarr;
+            resarr = NULL;
+        }
+        goto cleanup;
+    }
+
+    /* The flags of every slice are now set, so the usual cleanup applies
+     * range checking and subnormalization, records the flags in the
+     * context and raises any trapped exception.
+     */
+
+    for (i = 0; i < n; i++) {
+        if (is_complex) {
+            MPC_Object *temp = (MPC_Object*)res[i];
+            temp->rc = rc[i];
+            _GMPy_MPC_Cleanup(&temp, context);
+            res[i] = (PyObject*)temp;
+        }
+        else {
+            MPFR_Object *temp = (MPFR_Object*)res[i];
+            temp->rc = rc[i];
+            _GMPy_MPFR_Cleanup(&temp, context);
+            res[i] = (PyObject*)temp;
+        }
+        if (!res[i]) {
+            goto cleanup;
+        }
+    }
+
+    if (out != Py_None) {
+        Py_INCREF(out);
+        result = out;
+    }
+    else if (!(result = PyList_New(n))) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < n; i++) {
+        PyList_SetItem(result, i, res[i]);
+        res[i] = NULL;
+    }
+
+  cleanup:
+    if (tempx) {
+        for (i = 0; i < 2 * n + ny; i++) {
+            Py_XDECREF(tempx[i]);
+        }
+    }
+    PyMem_Free(tempx);
+    PyMem_Free(ptrs);
+    PyMem_Free(rc);
+    PyMem_Free(xtypes);
+    PyMem_Free(tasks);
+    Py_XDECREF(xseq);
+    Py_XDECREF(yseq);
+    Py_XDECREF((PyObject*)resarr);
+    return result;
 }
@@ -31,8 +31,49 @@
 extern "C" {
 #endif
 
-static PyObject * GMPy_Context_Vector(PyObject *self, PyObject *other);
-static PyObject * GMPy_Context_Vector2(PyObject *self, PyObject *args);
+typedef int (*GMPy_vec_mpfr1)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+typedef int (*GMPy_vec_mpfr2)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+typedef int (*GMPy_vec_mpc1)(mpc_ptr, mpc_srcptr, mpc_rnd_t);
+typedef int (*GMPy_vec_mpc2)(mpc_ptr, mpc_srcptr, mpc_srcptr, mpc_rnd_t);
+
+/* How evaluate_to() encloses the values of an mpfr function over intervals
+ * of arguments. A function is evaluated at the interval endpoints (and at
+ * the extra points noted below), rounding down and up. GMPY_RANGE_POINT
+ * functions are only bounded for exact arguments.
+ */
+
+#define GMPY_RANGE_POINT      0     /* exact arguments only */
+#define GMPY_RANGE_MONOTONE   1     /* monotone on its domain */
+#define GMPY_RANGE_SPLIT0     2     /* monotone on either side of zero */
+#define GMPY_RANGE_LIPSCHITZ  3     /* |f(x) - f(y)| <= |x - y|, |f| <= 1 */
+#define GMPY_RANGE_TAN        4     /* increasing between poles pi apart */
+#define GMPY_RANGE_COT        5     /* decreasing between poles pi apart */
+#define GMPY_RANGE_CORNERS    6     /* monotone in each argument */
+#define GMPY_RANGE_KIND(r)    ((r) & 0x0f)
+
+/* Conditions on the arguments of a GMPY_RANGE_CORNERS function. */
+
+#define GMPY_RANGE_X_NONZERO  0x10
+#define GMPY_RANGE_X_POSITIVE 0x20
+#define GMPY_RANGE_Y_NONZERO  0x40
+#define GMPY_RANGE_Y_POSITIVE 0x80
+
+/* A unary function sets mpfr1 and/or mpc1; a binary function sets mpfr2
+ * and/or mpc2. A NULL entry means the function does not support that
+ * domain.
+ */
+
+typedef struct {
+    const char *name;
+    GMPy_vec_mpfr1 mpfr1;
+    GMPy_vec_mpfr2 mpfr2;
+    GMPy_vec_mpc1 mpc1;
+    GMPy_vec_mpc2 mpc2;
+    int range;
+} GMPy_VecFunc;
+
+static const GMPy_VecFunc * GMPy_Vec_Lookup(PyObject *func, const char *caller);
+static PyObject * GMPy_Context_Vec(PyObject *self, PyObject *args, PyObject *kwargs);
 
 #ifdef __cplusplus
 }
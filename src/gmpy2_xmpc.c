@@ -0,0 +1,349 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpc.c                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+PyDoc_STRVAR(GMPy_doc_xmpc,
+"xmpc(c=0, /, precision=0)\n"
+"xmpc(c=0, /, precision, context)\n"
+"xmpc(real, /, imag=0, precision=0)\n"
+"xmpc(real, /, imag, precision, context)\n"
+"xmpc(s, /, precision=0, base=10)\n"
+"xmpc(s, /, precision, base, context)\n\n"
+"Return a mutable complex floating-point number.  Every input, that\n"
+"is accepted by the `mpc` type constructor is also accepted.\n\n"
+"Note: The augmented assignments +=, -=, *= and /= update an `xmpc`\n"
+"in place and round the result to the precision of the `xmpc`, not\n"
+"the precision of the current context.  Other operations return a new\n"
+"`mpc`.  `xmpc` objects cannot be used as dictionary keys.");
+
+/* str, repr and format are delegated to a temporary mpc. */
+
+static PyObject *
+GMPy_XMPC_Str_Slot(XMPC_Object *self)
+{
+    PyObject *result;
+    MPC_Object *temp;
+
+    if (!(temp = GMPy_MPC_From_XMPC(self, 1, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = GMPy_MPC_Str_Slot(temp);
+    Py_DECREF((PyObject*)temp);
+    return result;
+}
+
+static PyObject *
+GMPy_XMPC_Repr_Slot(XMPC_Object *self)
+{
+    PyObject *result = NULL, *temp;
+    MPC_Object *tempx;
+
+    if (!(tempx = GMPy_MPC_From_XMPC(self, 1, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    temp = GMPy_MPC_Repr_Slot(tempx);
+    Py_DECREF((PyObject*)tempx);
+    if (temp) {
+        result = PyUnicode_FromFormat("x%U", temp);
+        Py_DECREF(temp);
+    }
+    return result;
+}
+
+static PyObject *
+GMPy_XMPC_Format(PyObject *self, PyObject *args)
+{
+    PyObject *result;
+    MPC_Object *temp;
+
+    if (!(temp = GMPy_MPC_From_XMPC((XMPC_Object*)self, 1, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = GMPy_MPC_Format((PyObject*)temp, args);
+    Py_DECREF((PyObject*)temp);
+    return result;
+}
+
+/* As with xmpz, negation modifies x and returns None. The absolute value
+ * of a complex number is real so abs() returns a new mpfr.
+ */
+
+static PyObject *
+GMPy_XMPC_Neg_Slot(XMPC_Object *self)
+{
+    self->rc = mpc_neg(self->c, self->c, MPC_RNDNN);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPC_Pos_Slot(XMPC_Object *self)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPC_Abs_Slot(XMPC_Object *self)
+{
+    return GMPy_Complex_AbsWithType((PyObject*)self, OBJ_TYPE_XMPC, NULL);
+}
+
+/* Inplace arithmetic. The result is rounded once to the precision of x.
+ * Rational operands are applied to each part with the mpfr_*_q functions.
+ * Other real operands are converted exactly to an mpfr and passed to the
+ * mixed MPC functions. Other complex operands are converted exactly to an
+ * mpc.
+ */
+
+typedef int (*xmpc_c_func)(mpc_ptr, mpc_srcptr, mpc_srcptr, mpc_rnd_t);
+typedef int (*xmpc_fr_func)(mpc_ptr, mpc_srcptr, mpfr_srcptr, mpc_rnd_t);
+
+static const xmpc_c_func xmpc_c_ops[] = { mpc_add, mpc_sub, mpc_mul, mpc_div };
+static const xmpc_fr_func xmpc_fr_ops[] = { mpc_add_fr, mpc_sub_fr, mpc_mul_fr, mpc_div_fr };
+
+/* MPC_INEX() evaluates its arguments more than once. */
+
+static int
+_GMPy_XMPC_IOp_Q(mpc_ptr x, mpq_srcptr q, int op, mpc_rnd_t rnd)
+{
+    mpfr_ptr re = mpc_realref(x), im = mpc_imagref(x);
+    mpfr_rnd_t rnd_re = MPC_RND_RE(rnd), rnd_im = MPC_RND_IM(rnd);
+    int inex_re, inex_im = 0;
+
+    switch (op) {
+    case GMPY_XOP_ADD:
+        inex_re = mpfr_add_q(re, re, q, rnd_re);
+        break;
+    case GMPY_XOP_SUB:
+        inex_re = mpfr_sub_q(re, re, q, rnd_re);
+        break;
+    case GMPY_XOP_MUL:
+        inex_re = mpfr_mul_q(re, re, q, rnd_re);
+        inex_im = mpfr_mul_q(im, im, q, rnd_im);
+        break;
+    default:
+        inex_re = mpfr_div_q(re, re, q, rnd_re);
+        inex_im = mpfr_div_q(im, im, q, rnd_im);
+        break;
+    }
+    return MPC_INEX(inex_re, inex_im);
+}
+
+static PyObject *
+_GMPy_XMPC_IOp(PyObject *self, PyObject *other, int op)
+{
+    PyObject *result = NULL;
+    MPQ_Object *tempq = NULL;
+    MPFR_Object *tempf = NULL;
+    MPC_Object *tempc = NULL;
+    mpc_rnd_t rnd;
+    int rc;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+    rnd = GET_MPC_ROUND(context);
+
+    int ytype = GMPy_ObjectType(other);
+
+    if (IS_TYPE_MPC(ytype) || IS_TYPE_XMPC(ytype)) {
+        mpfr_clear_flags();
+        rc = xmpc_c_ops[op](MPC(self), MPC(self), MPC(other), rnd);
+    }
+    else if (IS_TYPE_MPFR(ytype) || IS_TYPE_XMPFR(ytype)) {
+        mpfr_clear_flags();
+        rc = xmpc_fr_ops[op](MPC(self), MPC(self), MPFR(other), rnd);
+    }
+    else if (IS_TYPE_RATIONAL_ONLY(ytype)) {
+        if (!(tempq = GMPy_MPQ_From_RationalWithType(other, ytype, context))) {
+            return NULL;
+        }
+        mpfr_clear_flags();
+        rc = _GMPy_XMPC_IOp_Q(MPC(self), tempq->q, op, rnd);
+        Py_DECREF((PyObject*)tempq);
+    }
+    else if (IS_TYPE_REAL(ytype)) {
+        if (!(tempf = GMPy_MPFR_From_RealWithType(other, ytype, 1, context))) {
+            return NULL;
+        }
+        mpfr_clear_flags();
+        rc = xmpc_fr_ops[op](MPC(self), MPC(self), tempf->f, rnd);
+        Py_DECREF((PyObject*)tempf);
+    }
+    else if (IS_TYPE_COMPLEX(ytype)) {
+        if (!(tempc = GMPy_MPC_From_ComplexWithType(other, ytype, 1, 1, context))) {
+            return NULL;
+        }
+        mpfr_clear_flags();
+        rc = xmpc_c_ops[op](MPC(self), MPC(self), tempc->c, rnd);
+        Py_DECREF((PyObject*)tempc);
+    }
+    else {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    ((XMPC_Object*)self)->rc = rc;
+    Py_INCREF(self);
+    result = self;
+    _GMPy_MPC_Cleanup((MPC_Object**)&result, context);
+    return result;
+}
+
+static PyObject *
+GMPy_XMPC_IAdd_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_IOp(self, other, GMPY_XOP_ADD);
+}
+
+static PyObject *
+GMPy_XMPC_ISub_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_IOp(self, other, GMPY_XOP_SUB);
+}
+
+static PyObject *
+GMPy_XMPC_IMul_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_IOp(self, other, GMPY_XOP_MUL);
+}
+
+static PyObject *
+GMPy_XMPC_ITrueDiv_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_IOp(self, other, GMPY_XOP_DIV);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpc_method_mpc,
+"x.__mpc__() -> mpc\n\n"
+"Return an `mpc` with the current value and precision of x.");
+
+static PyObject *
+GMPy_XMPC_Method_MPC(PyObject *self, PyObject *other)
+{
+    return (PyObject*)GMPy_MPC_From_XMPC((XMPC_Object*)self, 1, 1, NULL);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpc_method_copy,
+"x.copy() -> xmpc\n\n"
+"Return a copy of a x.");
+
+static PyObject *
+GMPy_XMPC_Method_Copy(PyObject *self, PyObject *other)
+{
+    XMPC_Object *result;
+    mpfr_prec_t rprec = 0, iprec = 0;
+
+    mpc_get_prec2(&rprec, &iprec, MPC(self));
+    if ((result = GMPy_XMPC_New(rprec, iprec, NULL))) {
+        mpc_set(result->c, MPC(self), MPC_RNDNN);
+        result->rc = ((XMPC_Object*)self)->rc;
+    }
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpc_method_make_mpc,
+"x.make_mpc() -> mpc\n\n"
+"Return an `mpc` by converting x as quickly as possible.\n\n"
+"NOTE: Optimized for speed so the original `xmpc` value is set to 0!");
+
+static PyObject *
+GMPy_XMPC_Method_MakeMPC(PyObject *self, PyObject *other)
+{
+    MPC_Object *result;
+    mpfr_prec_t rprec = 0, iprec = 0;
+
+    mpc_get_prec2(&rprec, &iprec, MPC(self));
+    if (!(result = GMPy_MPC_New(rprec, iprec, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpc_swap(result->c, MPC(self));
+    result->rc = ((XMPC_Object*)self)->rc;
+    mpc_set_ui(MPC(self), 0, MPC_RNDNN);
+    ((XMPC_Object*)self)->rc = 0;
+    return (PyObject*)result;
+}
+
+static PyNumberMethods GMPy_XMPC_number_methods =
+{
+    .nb_add = (binaryfunc) GMPy_Number_Add_Slot,
+    .nb_subtract = (binaryfunc) GMPy_Number_Sub_Slot,
+    .nb_multiply = (binaryfunc) GMPy_Number_Mul_Slot,
+    .nb_remainder = (binaryfunc) GMPy_Number_Mod_Slot,
+    .nb_divmod = (binaryfunc) GMPy_Number_DivMod_Slot,
+    .nb_power = (ternaryfunc) GMPy_Number_Pow_Slot,
+    .nb_negative = (unaryfunc) GMPy_XMPC_Neg_Slot,
+    .nb_positive = (unaryfunc) GMPy_XMPC_Pos_Slot,
+    .nb_absolute = (unaryfunc) GMPy_XMPC_Abs_Slot,
+    .nb_bool = (inquiry) GMPy_MPC_NonZero_Slot,
+    .nb_int = (unaryfunc) GMPy_MPC_Int_Slot,
+    .nb_float = (unaryfunc) GMPy_MPC_Float_Slot,
+    .nb_inplace_add = (binaryfunc) GMPy_XMPC_IAdd_Slot,
+    .nb_inplace_subtract = (binaryfunc) GMPy_XMPC_ISub_Slot,
+    .nb_inplace_multiply = (binaryfunc) GMPy_XMPC_IMul_Slot,
+    .nb_floor_divide = (binaryfunc) GMPy_Number_FloorDiv_Slot,
+    .nb_true_divide = (binaryfunc) GMPy_Number_TrueDiv_Slot,
+    .nb_inplace_true_divide = (binaryfunc) GMPy_XMPC_ITrueDiv_Slot,
+};
+
+static PyGetSetDef GMPy_XMPC_getseters[] =
+{
+    {"precision", (getter)GMPy_MPC_GetPrec_Attrib, NULL, "precision in bits", NULL},
+    {"rc", (getter)GMPy_MPC_GetRc_Attrib, NULL, "return code", NULL},
+    {"imag", (getter)GMPy_MPC_GetImag_Attrib, NULL, "imaginary component", NULL},
+    {"real", (getter)GMPy_MPC_GetReal_Attrib, NULL, "real component", NULL},
+    {NULL}
+};
+
+static PyMethodDef GMPy_XMPC_methods[] =
+{
+    { "__complex__", GMPy_PyComplex_From_MPC, METH_NOARGS, GMPy_doc_mpc_complex },
+    { "__format__", GMPy_XMPC_Format, METH_VARARGS, GMPy_doc_mpc_format },
+    { "__mpc__", GMPy_XMPC_Method_MPC, METH_NOARGS, GMPy_doc_xmpc_method_mpc },
+    { "copy", GMPy_XMPC_Method_Copy, METH_NOARGS, GMPy_doc_xmpc_method_copy },
+    { "digits", GMPy_MPC_Digits_Method, METH_VARARGS, GMPy_doc_mpc_digits_method },
+    { "make_mpc", GMPy_XMPC_Method_MakeMPC, METH_NOARGS, GMPy_doc_xmpc_method_make_mpc },
+    { NULL }
+};
+
+static PyTypeObject XMPC_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.xmpc",
+    .tp_basicsize = sizeof(XMPC_Object),
+    .tp_dealloc = (destructor) GMPy_XMPC_Dealloc,
+    .tp_repr = (reprfunc) GMPy_XMPC_Repr_Slot,
+    .tp_as_number = &GMPy_XMPC_number_methods,
+    .tp_str = (reprfunc) GMPy_XMPC_Str_Slot,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_xmpc,
+    .tp_richcompare = (richcmpfunc)&GMPy_RichCompare_Slot,
+    .tp_methods = GMPy_XMPC_methods,
+    .tp_getset = GMPy_XMPC_getseters,
+    .tp_new = GMPy_XMPC_NewInit,
+};
@@ -0,0 +1,52 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpc.h                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_XMPC_H
+#define GMPY_XMPC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static PyTypeObject XMPC_Type;
+#define XMPC_Check(v) (((PyObject*)v)->ob_type == &XMPC_Type)
+
+static PyObject * GMPy_XMPC_Str_Slot(XMPC_Object *self);
+static PyObject * GMPy_XMPC_Repr_Slot(XMPC_Object *self);
+static PyObject * GMPy_XMPC_Neg_Slot(XMPC_Object *self);
+static PyObject * GMPy_XMPC_Pos_Slot(XMPC_Object *self);
+static PyObject * GMPy_XMPC_Abs_Slot(XMPC_Object *self);
+static PyObject * GMPy_XMPC_IAdd_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_ISub_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_IMul_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_ITrueDiv_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_Format(PyObject *self, PyObject *args);
+static PyObject * GMPy_XMPC_Method_MPC(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_Method_Copy(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPC_Method_MakeMPC(PyObject *self, PyObject *other);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,357 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpfr.c                                                           *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+PyDoc_STRVAR(GMPy_doc_xmpfr,
+"xmpfr(n=0, /, precision=0)\n"
+"xmpfr(n, /, precision, context)\n"
+"xmpfr(s, /, precision=0, base=0)\n"
+"xmpfr(s, /, precision, base, context)\n\n"
+"Return a mutable floating-point number.  Every input, that is\n"
+"accepted by the `mpfr` type constructor is also accepted.\n\n"
+"Note: The augmented assignments +=, -=, *= and /= update an `xmpfr`\n"
+"in place and round the result to the precision of the `xmpfr`, not\n"
+"the precision of the current context.  Other operations return a new\n"
+"`mpfr`.  `xmpfr` objects cannot be used as dictionary keys.");
+
+/* str, repr and format are delegated to a temporary mpfr. */
+
+static PyObject *
+GMPy_XMPFR_Str_Slot(XMPFR_Object *self)
+{
+    PyObject *result;
+    MPFR_Object *temp;
+
+    if (!(temp = GMPy_MPFR_From_XMPFR(self, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = GMPy_MPFR_Str_Slot(temp);
+    Py_DECREF((PyObject*)temp);
+    return result;
+}
+
+static PyObject *
+GMPy_XMPFR_Repr_Slot(XMPFR_Object *self)
+{
+    PyObject *result = NULL, *temp;
+    MPFR_Object *tempx;
+
+    if (!(tempx = GMPy_MPFR_From_XMPFR(self, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    temp = GMPy_MPFR_Repr_Slot(tempx);
+    Py_DECREF((PyObject*)tempx);
+    if (temp) {
+        result = PyUnicode_FromFormat("x%U", temp);
+        Py_DECREF(temp);
+    }
+    return result;
+}
+
+static PyObject *
+GMPy_XMPFR_Format(PyObject *self, PyObject *args)
+{
+    PyObject *result;
+    MPFR_Object *temp;
+
+    if (!(temp = GMPy_MPFR_From_XMPFR((XMPFR_Object*)self, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = GMPy_MPFR_Format((PyObject*)temp, args);
+    Py_DECREF((PyObject*)temp);
+    return result;
+}
+
+/* As with xmpz, the unary operations modify x and return None. */
+
+static PyObject *
+GMPy_XMPFR_Neg_Slot(XMPFR_Object *self)
+{
+    self->rc = mpfr_neg(self->f, self->f, MPFR_RNDN);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPFR_Pos_Slot(XMPFR_Object *self)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPFR_Abs_Slot(XMPFR_Object *self)
+{
+    self->rc = mpfr_abs(self->f, self->f, MPFR_RNDN);
+    Py_RETURN_NONE;
+}
+
+/* Inplace arithmetic. The result is rounded once to the precision of x;
+ * integer, rational and float operands are passed (after an exact
+ * conversion to mpq for rationals such as Fraction) to the mixed MPFR
+ * functions. Other real operands are converted exactly and non-real
+ * operands return NotImplemented.
+ */
+
+typedef int (*xmpfr_fr_func)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+typedef int (*xmpfr_si_func)(mpfr_ptr, mpfr_srcptr, long, mpfr_rnd_t);
+typedef int (*xmpfr_z_func)(mpfr_ptr, mpfr_srcptr, mpz_srcptr, mpfr_rnd_t);
+typedef int (*xmpfr_q_func)(mpfr_ptr, mpfr_srcptr, mpq_srcptr, mpfr_rnd_t);
+typedef int (*xmpfr_d_func)(mpfr_ptr, mpfr_srcptr, double, mpfr_rnd_t);
+
+static const xmpfr_fr_func xmpfr_fr_ops[] = { mpfr_add, mpfr_sub, mpfr_mul, mpfr_div };
+static const xmpfr_si_func xmpfr_si_ops[] = { mpfr_add_si, mpfr_sub_si, mpfr_mul_si, mpfr_div_si };
+static const xmpfr_z_func xmpfr_z_ops[] = { mpfr_add_z, mpfr_sub_z, mpfr_mul_z, mpfr_div_z };
+static const xmpfr_q_func xmpfr_q_ops[] = { mpfr_add_q, mpfr_sub_q, mpfr_mul_q, mpfr_div_q };
+static const xmpfr_d_func xmpfr_d_ops[] = { mpfr_add_d, mpfr_sub_d, mpfr_mul_d, mpfr_div_d };
+
+static PyObject *
+_GMPy_XMPFR_IOp(PyObject *self, PyObject *other, int op)
+{
+    PyObject *result = NULL;
+    MPFR_Object *tempy = NULL;
+    mpfr_rnd_t rnd;
+    int rc;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+    rnd = GET_MPFR_ROUND(context);
+
+    int ytype = GMPy_ObjectType(other);
+
+    if (!IS_TYPE_REAL(ytype)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    mpfr_clear_flags();
+
+    if (IS_TYPE_MPFR(ytype) || IS_TYPE_XMPFR(ytype)) {
+        rc = xmpfr_fr_ops[op](MPFR(self), MPFR(self), MPFR(other), rnd);
+    }
+    else if (IS_TYPE_PyFloat(ytype)) {
+        rc = xmpfr_d_ops[op](MPFR(self), MPFR(self), PyFloat_AS_DOUBLE(other), rnd);
+    }
+    else if (IS_TYPE_MPZANY(ytype)) {
+        rc = xmpfr_z_ops[op](MPFR(self), MPFR(self), MPZ(other), rnd);
+    }
+    else if (IS_TYPE_PyInteger(ytype)) {
+        int error;
+        long temp = PyLong_AsLongAndOverflow(other, &error);
+
+        if (!error) {
+            rc = xmpfr_si_ops[op](MPFR(self), MPFR(self), temp, rnd);
+        }
+        else {
+            mpz_t tempz;
+            mpz_init(tempz);
+            if (mpz_set_PyLong(tempz, other)) {
+                /* LCOV_EXCL_START */
+                mpz_clear(tempz);
+                return NULL;
+                /* LCOV_EXCL_STOP */
+            }
+            rc = xmpfr_z_ops[op](MPFR(self), MPFR(self), tempz, rnd);
+            mpz_clear(tempz);
+        }
+    }
+    else if (IS_TYPE_RATIONAL(ytype)) {
+        MPQ_Object *tempq;
+
+        if (!(tempq = GMPy_MPQ_From_RationalWithType(other, ytype, context))) {
+            return NULL;
+        }
+        mpfr_clear_flags();
+        rc = xmpfr_q_ops[op](MPFR(self), MPFR(self), tempq->q, rnd);
+        Py_DECREF((PyObject*)tempq);
+    }
+    else {
+        if (!(tempy = GMPy_MPFR_From_RealWithType(other, ytype, 1, context))) {
+            return NULL;
+        }
+        mpfr_clear_flags();
+        rc = xmpfr_fr_ops[op](MPFR(self), MPFR(self), tempy->f, rnd);
+        Py_DECREF((PyObject*)tempy);
+    }
+
+    ((XMPFR_Object*)self)->rc = rc;
+    Py_INCREF(self);
+    result = self;
+    _GMPy_MPFR_Cleanup((MPFR_Object**)&result, context);
+    return result;
+}
+
+static PyObject *
+GMPy_XMPFR_IAdd_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPFR_IOp(self, other, GMPY_XOP_ADD);
+}
+
+static PyObject *
+GMPy_XMPFR_ISub_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPFR_IOp(self, other, GMPY_XOP_SUB);
+}
+
+static PyObject *
+GMPy_XMPFR_IMul_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPFR_IOp(self, other, GMPY_XOP_MUL);
+}
+
+static PyObject *
+GMPy_XMPFR_ITrueDiv_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPFR_IOp(self, other, GMPY_XOP_DIV);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpfr_method_mpfr,
+"x.__mpfr__() -> mpfr\n\n"
+"Return an `mpfr` with the current value and precision of x.");
+
+static PyObject *
+GMPy_XMPFR_Method_MPFR(PyObject *self, PyObject *other)
+{
+    return (PyObject*)GMPy_MPFR_From_XMPFR((XMPFR_Object*)self, 1, NULL);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpfr_method_copy,
+"x.copy() -> xmpfr\n\n"
+"Return a copy of a x.");
+
+static PyObject *
+GMPy_XMPFR_Method_Copy(PyObject *self, PyObject *other)
+{
+    XMPFR_Object *result;
+
+    if ((result = GMPy_XMPFR_New(mpfr_get_prec(MPFR(self)), NULL))) {
+        mpfr_set(result->f, MPFR(self), MPFR_RNDN);
+        result->rc = ((XMPFR_Object*)self)->rc;
+    }
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpfr_method_make_mpfr,
+"x.make_mpfr() -> mpfr\n\n"
+"Return an `mpfr` by converting x as quickly as possible.\n\n"
+"NOTE: Optimized for speed so the original `xmpfr` value is set to 0!");
+
+static PyObject *
+GMPy_XMPFR_Method_MakeMPFR(PyObject *self, PyObject *other)
+{
+    MPFR_Object *result;
+
+    if (!(result = GMPy_MPFR_New(mpfr_get_prec(MPFR(self)), NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpfr_swap(result->f, MPFR(self));
+    result->rc = ((XMPFR_Object*)self)->rc;
+    mpfr_set_zero(MPFR(self), 1);
+    ((XMPFR_Object*)self)->rc = 0;
+    return (PyObject*)result;
+}
+
+/* __round__() may return its argument, so it is called with an mpfr. */
+
+static PyObject *
+GMPy_XMPFR_Method_Round10(PyObject *self, PyObject *args)
+{
+    PyObject *result;
+    MPFR_Object *temp;
+
+    if (!(temp = GMPy_MPFR_From_XMPFR((XMPFR_Object*)self, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = GMPy_MPFR_Method_Round10((PyObject*)temp, args);
+    Py_DECREF((PyObject*)temp);
+    return result;
+}
+
+static PyNumberMethods GMPy_XMPFR_number_methods =
+{
+    .nb_add = (binaryfunc) GMPy_Number_Add_Slot,
+    .nb_subtract = (binaryfunc) GMPy_Number_Sub_Slot,
+    .nb_multiply = (binaryfunc) GMPy_Number_Mul_Slot,
+    .nb_remainder = (binaryfunc) GMPy_Number_Mod_Slot,
+    .nb_divmod = (binaryfunc) GMPy_Number_DivMod_Slot,
+    .nb_power = (ternaryfunc) GMPy_Number_Pow_Slot,
+    .nb_negative = (unaryfunc) GMPy_XMPFR_Neg_Slot,
+    .nb_positive = (unaryfunc) GMPy_XMPFR_Pos_Slot,
+    .nb_absolute = (unaryfunc) GMPy_XMPFR_Abs_Slot,
+    .nb_bool = (inquiry) GMPy_MPFR_NonZero_Slot,
+    .nb_int = (unaryfunc) GMPy_MPFR_Int_Slot,
+    .nb_float = (unaryfunc) GMPy_MPFR_Float_Slot,
+    .nb_inplace_add = (binaryfunc) GMPy_XMPFR_IAdd_Slot,
+    .nb_inplace_subtract = (binaryfunc) GMPy_XMPFR_ISub_Slot,
+    .nb_inplace_multiply = (binaryfunc) GMPy_XMPFR_IMul_Slot,
+    .nb_floor_divide = (binaryfunc) GMPy_Number_FloorDiv_Slot,
+    .nb_true_divide = (binaryfunc) GMPy_Number_TrueDiv_Slot,
+    .nb_inplace_true_divide = (binaryfunc) GMPy_XMPFR_ITrueDiv_Slot,
+};
+
+static PyGetSetDef GMPy_XMPFR_getseters[] =
+{
+    {"precision", (getter)GMPy_MPFR_GetPrec_Attrib, NULL, "precision in bits", NULL},
+    {"rc", (getter)GMPy_MPFR_GetRc_Attrib, NULL, "return code", NULL},
+    {NULL}
+};
+
+static PyMethodDef GMPy_XMPFR_methods [] =
+{
+    { "__ceil__", GMPy_MPFR_Method_Ceil, METH_NOARGS, GMPy_doc_mpfr_ceil_method },
+    { "__floor__", GMPy_MPFR_Method_Floor, METH_NOARGS, GMPy_doc_mpfr_floor_method },
+    { "__format__", GMPy_XMPFR_Format, METH_VARARGS, GMPy_doc_mpfr_format },
+    { "__mpfr__", GMPy_XMPFR_Method_MPFR, METH_NOARGS, GMPy_doc_xmpfr_method_mpfr },
+    { "__round__", GMPy_XMPFR_Method_Round10, METH_VARARGS, GMPy_doc_method_round10 },
+    { "__trunc__", GMPy_MPFR_Method_Trunc, METH_NOARGS, GMPy_doc_mpfr_trunc_method },
+    { "as_integer_ratio", GMPy_MPFR_Integer_Ratio_Method, METH_NOARGS, GMPy_doc_method_integer_ratio },
+    { "copy", GMPy_XMPFR_Method_Copy, METH_NOARGS, GMPy_doc_xmpfr_method_copy },
+    { "digits", GMPy_MPFR_Digits_Method, METH_VARARGS, GMPy_doc_mpfr_digits_method },
+    { "is_integer", GMPy_MPFR_Is_Integer_Method, METH_NOARGS, GMPy_doc_method_is_integer },
+    { "make_mpfr", GMPy_XMPFR_Method_MakeMPFR, METH_NOARGS, GMPy_doc_xmpfr_method_make_mpfr },
+    { NULL }
+};
+
+static PyTypeObject XMPFR_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.xmpfr",
+    .tp_basicsize = sizeof(XMPFR_Object),
+    .tp_dealloc = (destructor) GMPy_XMPFR_Dealloc,
+    .tp_repr = (reprfunc) GMPy_XMPFR_Repr_Slot,
+    .tp_as_number = &GMPy_XMPFR_number_methods,
+    .tp_str = (reprfunc) GMPy_XMPFR_Str_Slot,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_xmpfr,
+    .tp_richcompare = (richcmpfunc)&GMPy_RichCompare_Slot,
+    .tp_methods = GMPy_XMPFR_methods,
+    .tp_getset = GMPy_XMPFR_getseters,
+    .tp_new = GMPy_XMPFR_NewInit,
+};
@@ -0,0 +1,53 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpfr.h                                                           *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_XMPFR_H
+#define GMPY_XMPFR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static PyTypeObject XMPFR_Type;
+#define XMPFR_Check(v) (((PyObject*)v)->ob_type == &XMPFR_Type)
+
+static PyObject * GMPy_XMPFR_Str_Slot(XMPFR_Object *self);
+static PyObject * GMPy_XMPFR_Repr_Slot(XMPFR_Object *self);
+static PyObject * GMPy_XMPFR_Neg_Slot(XMPFR_Object *self);
+static PyObject * GMPy_XMPFR_Pos_Slot(XMPFR_Object *self);
+static PyObject * GMPy_XMPFR_Abs_Slot(XMPFR_Object *self);
+static PyObject * GMPy_XMPFR_IAdd_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_ISub_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_IMul_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_ITrueDiv_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_Format(PyObject *self, PyObject *args);
+static PyObject * GMPy_XMPFR_Method_MPFR(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_Method_Copy(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_Method_MakeMPFR(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPFR_Method_Round10(PyObject *self, PyObject *args);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
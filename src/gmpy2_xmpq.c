@@ -0,0 +1,307 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpq.c                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+PyDoc_STRVAR(GMPy_doc_xmpq,
+"xmpq(n=0, /)\n"
+"xmpq(n, m, /)\n"
+"xmpq(s, /, base=10)\n\n"
+"Return a mutable rational number.  Every input, that is accepted\n"
+"by the `mpq` type constructor is also accepted.\n\n"
+"Note: The augmented assignments +=, -=, *= and /= update an `xmpq`\n"
+"in place.  Other operations return a new `mpq`.  `xmpq` objects\n"
+"cannot be used as dictionary keys.");
+
+/* str and repr implementations for xmpq */
+static PyObject *
+GMPy_XMPQ_Str_Slot(XMPQ_Object *self)
+{
+    /* base-10, no tag */
+    return GMPy_PyStr_From_MPQ((MPQ_Object*)self, 10, 0, NULL);
+}
+
+static PyObject *
+GMPy_XMPQ_Repr_Slot(XMPQ_Object *self)
+{
+    PyObject *result, *temp;
+
+    /* base-10, with tag */
+    if (!(temp = GMPy_PyStr_From_MPQ((MPQ_Object*)self, 10, 1, NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result = PyUnicode_FromFormat("x%U", temp);
+    Py_DECREF(temp);
+    return result;
+}
+
+/* As with xmpz, the unary operations modify x and return None. */
+
+static PyObject *
+GMPy_XMPQ_Neg_Slot(XMPQ_Object *self)
+{
+    mpq_neg(self->q, self->q);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPQ_Pos_Slot(XMPQ_Object *self)
+{
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPQ_Abs_Slot(XMPQ_Object *self)
+{
+    mpq_abs(self->q, self->q);
+    Py_RETURN_NONE;
+}
+
+/* Inplace arithmetic. An integer is added or subtracted with a single
+ * mpz_addmul() or mpz_submul() since a/b + n = (a + n*b)/b is already in
+ * lowest terms. Operands that are not rational return NotImplemented so
+ * Python falls back to the binary operation.
+ */
+
+static void
+_GMPy_XMPQ_Apply(mpq_ptr x, mpq_srcptr y, int op)
+{
+    switch (op) {
+    case GMPY_XOP_ADD:
+        mpq_add(x, x, y);
+        break;
+    case GMPY_XOP_SUB:
+        mpq_sub(x, x, y);
+        break;
+    case GMPY_XOP_MUL:
+        mpq_mul(x, x, y);
+        break;
+    default:
+        mpq_div(x, x, y);
+        break;
+    }
+}
+
+static PyObject *
+_GMPy_XMPQ_IOp(PyObject *self, PyObject *other, int op)
+{
+    MPZ_Object *tempz = NULL;
+    MPQ_Object *tempq = NULL;
+    CTXT_Object *context = NULL;
+
+    CHECK_CONTEXT(context);
+
+    int ytype = GMPy_ObjectType(other);
+
+    if (IS_TYPE_MPQ(ytype) || IS_TYPE_XMPQ(ytype)) {
+        if (op == GMPY_XOP_DIV && mpq_sgn(MPQ(other)) == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            return NULL;
+        }
+        GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
+        _GMPy_XMPQ_Apply(MPQ(self), MPQ(other), op);
+        GMPY_MAYBE_END_ALLOW_THREADS(context);
+        Py_INCREF(self);
+        return self;
+    }
+
+    if (IS_TYPE_INTEGER(ytype)) {
+        if (!(tempz = GMPy_MPZ_From_IntegerWithType(other, ytype, context))) {
+            /* LCOV_EXCL_START */
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+        if (op == GMPY_XOP_ADD) {
+            mpz_addmul(mpq_numref(MPQ(self)), mpq_denref(MPQ(self)), tempz->z);
+        }
+        else if (op == GMPY_XOP_SUB) {
+            mpz_submul(mpq_numref(MPQ(self)), mpq_denref(MPQ(self)), tempz->z);
+        }
+        else {
+            mpq_t q;
+
+            if (op == GMPY_XOP_DIV && mpz_sgn(tempz->z) == 0) {
+                ZERO_ERROR("division or modulo by zero");
+                Py_DECREF((PyObject*)tempz);
+                return NULL;
+            }
+            mpq_init(q);
+            mpq_set_z(q, tempz->z);
+            _GMPy_XMPQ_Apply(MPQ(self), q, op);
+            mpq_clear(q);
+        }
+        Py_DECREF((PyObject*)tempz);
+        Py_INCREF(self);
+        return self;
+    }
+
+    if (IS_TYPE_RATIONAL(ytype)) {
+        if (!(tempq = GMPy_MPQ_From_RationalWithType(other, ytype, context))) {
+            return NULL;
+        }
+        if (op == GMPY_XOP_DIV && mpq_sgn(tempq->q) == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            Py_DECREF((PyObject*)tempq);
+            return NULL;
+        }
+        _GMPy_XMPQ_Apply(MPQ(self), tempq->q, op);
+        Py_DECREF((PyObject*)tempq);
+        Py_INCREF(self);
+        return self;
+    }
+
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+static PyObject *
+GMPy_XMPQ_IAdd_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_IOp(self, other, GMPY_XOP_ADD);
+}
+
+static PyObject *
+GMPy_XMPQ_ISub_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_IOp(self, other, GMPY_XOP_SUB);
+}
+
+static PyObject *
+GMPy_XMPQ_IMul_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_IOp(self, other, GMPY_XOP_MUL);
+}
+
+static PyObject *
+GMPy_XMPQ_ITrueDiv_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_IOp(self, other, GMPY_XOP_DIV);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpq_method_mpq,
+"x.__mpq__() -> mpq\n\n"
+"Return an `mpq` with the current value of x.");
+
+static PyObject *
+GMPy_XMPQ_Method_MPQ(PyObject *self, PyObject *other)
+{
+    return (PyObject*)GMPy_MPQ_From_XMPQ((XMPQ_Object*)self, NULL);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpq_method_copy,
+"x.copy() -> xmpq\n\n"
+"Return a copy of a x.");
+
+static PyObject *
+GMPy_XMPQ_Method_Copy(PyObject *self, PyObject *other)
+{
+    XMPQ_Object *result;
+
+    if ((result = GMPy_XMPQ_New(NULL))) {
+        mpq_set(result->q, MPQ(self));
+    }
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpq_method_make_mpq,
+"x.make_mpq() -> mpq\n\n"
+"Return an `mpq` by converting x as quickly as possible.\n\n"
+"NOTE: Optimized for speed so the original `xmpq` value is set to 0!");
+
+static PyObject *
+GMPy_XMPQ_Method_MakeMPQ(PyObject *self, PyObject *other)
+{
+    MPQ_Object *result;
+
+    if (!(result = GMPy_MPQ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpq_swap(result->q, MPQ(self));
+    mpq_set_ui(MPQ(self), 0, 1);
+    return (PyObject*)result;
+}
+
+static PyNumberMethods GMPy_XMPQ_number_methods =
+{
+    .nb_add = (binaryfunc) GMPy_Number_Add_Slot,
+    .nb_subtract = (binaryfunc) GMPy_Number_Sub_Slot,
+    .nb_multiply = (binaryfunc) GMPy_Number_Mul_Slot,
+    .nb_remainder = (binaryfunc) GMPy_Number_Mod_Slot,
+    .nb_divmod = (binaryfunc) GMPy_Number_DivMod_Slot,
+    .nb_power = (ternaryfunc) GMPy_Number_Pow_Slot,
+    .nb_negative = (unaryfunc) GMPy_XMPQ_Neg_Slot,
+    .nb_positive = (unaryfunc) GMPy_XMPQ_Pos_Slot,
+    .nb_absolute = (unaryfunc) GMPy_XMPQ_Abs_Slot,
+    .nb_bool = (inquiry) GMPy_MPQ_NonZero_Slot,
+    .nb_int = (unaryfunc) GMPy_MPQ_Int_Slot,
+    .nb_float = (unaryfunc) GMPy_MPQ_Float_Slot,
+    .nb_inplace_add = (binaryfunc) GMPy_XMPQ_IAdd_Slot,
+    .nb_inplace_subtract = (binaryfunc) GMPy_XMPQ_ISub_Slot,
+    .nb_inplace_multiply = (binaryfunc) GMPy_XMPQ_IMul_Slot,
+    .nb_floor_divide = (binaryfunc) GMPy_Number_FloorDiv_Slot,
+    .nb_true_divide = (binaryfunc) GMPy_Number_TrueDiv_Slot,
+    .nb_inplace_true_divide = (binaryfunc) GMPy_XMPQ_ITrueDiv_Slot,
+};
+
+static PyGetSetDef GMPy_XMPQ_getseters[] =
+{
+    { "numerator", (getter)GMPy_MPQ_Attrib_GetNumer, NULL,
+        "the numerator of a rational number in lowest terms", NULL },
+    { "denominator", (getter)GMPy_MPQ_Attrib_GetDenom, NULL,
+        "the denominator of a rational number in lowest terms", NULL },
+    {NULL}
+};
+
+static PyMethodDef GMPy_XMPQ_methods [] =
+{
+    { "__ceil__", GMPy_MPQ_Method_Ceil, METH_NOARGS, GMPy_doc_mpq_method_ceil },
+    { "__floor__", GMPy_MPQ_Method_Floor, METH_NOARGS, GMPy_doc_mpq_method_floor },
+    { "__mpq__", GMPy_XMPQ_Method_MPQ, METH_NOARGS, GMPy_doc_xmpq_method_mpq },
+    { "__round__", GMPy_MPQ_Method_Round, METH_VARARGS, GMPy_doc_mpq_method_round },
+    { "__trunc__", GMPy_MPQ_Method_Trunc, METH_NOARGS, GMPy_doc_mpq_method_trunc },
+    { "as_integer_ratio", GMPy_MPQ_Method_As_Integer_Ratio, METH_NOARGS, GMPy_doc_mpq_method_as_integer_ratio },
+    { "copy", GMPy_XMPQ_Method_Copy, METH_NOARGS, GMPy_doc_xmpq_method_copy },
+    { "digits", GMPy_MPQ_Digits_Method, METH_VARARGS, GMPy_doc_mpq_digits_method },
+    { "is_integer", GMPy_MPQ_Method_IsInteger, METH_NOARGS, GMPy_doc_mpq_method_is_integer },
+    { "make_mpq", GMPy_XMPQ_Method_MakeMPQ, METH_NOARGS, GMPy_doc_xmpq_method_make_mpq },
+    { NULL }
+};
+
+static PyTypeObject XMPQ_Type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "gmpy2.xmpq",
+    .tp_basicsize = sizeof(XMPQ_Object),
+    .tp_dealloc = (destructor) GMPy_XMPQ_Dealloc,
+    .tp_repr = (reprfunc) GMPy_XMPQ_Repr_Slot,
+    .tp_as_number = &GMPy_XMPQ_number_methods,
+    .tp_str = (reprfunc) GMPy_XMPQ_Str_Slot,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = GMPy_doc_xmpq,
+    .tp_richcompare = (richcmpfunc)&GMPy_RichCompare_Slot,
+    .tp_methods = GMPy_XMPQ_methods,
+    .tp_getset = GMPy_XMPQ_getseters,
+    .tp_new = GMPy_XMPQ_NewInit,
+};
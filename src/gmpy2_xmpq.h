@@ -0,0 +1,58 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpq.h                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_XMPQ_H
+#define GMPY_XMPQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static PyTypeObject XMPQ_Type;
+#define XMPQ_Check(v) (((PyObject*)v)->ob_type == &XMPQ_Type)
+
+/* Operation codes shared by the inplace slots of xmpq, xmpfr and xmpc. */
+
+#define GMPY_XOP_ADD 0
+#define GMPY_XOP_SUB 1
+#define GMPY_XOP_MUL 2
+#define GMPY_XOP_DIV 3
+
+static PyObject * GMPy_XMPQ_Str_Slot(XMPQ_Object *self);
+static PyObject * GMPy_XMPQ_Repr_Slot(XMPQ_Object *self);
+static PyObject * GMPy_XMPQ_Neg_Slot(XMPQ_Object *self);
+static PyObject * GMPy_XMPQ_Pos_Slot(XMPQ_Object *self);
+static PyObject * GMPy_XMPQ_Abs_Slot(XMPQ_Object *self);
+static PyObject * GMPy_XMPQ_IAdd_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_ISub_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_IMul_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_ITrueDiv_Slot(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_Method_MPQ(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_Method_Copy(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPQ_Method_MakeMPQ(PyObject *self, PyObject *other);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -101,15 +101,23 @@ static PyMethodDef GMPy_XMPZ_methods [] =
     { "bit_scan1", (PyCFunction)GMPy_MPZ_bit_scan1_method, METH_FASTCALL, doc_bit_scan1_method },
     { "bit_set", GMPy_MPZ_bit_set_method, METH_O, doc_bit_set_method },
     { "bit_test", GMPy_MPZ_bit_test_method, METH_O, doc_bit_test_method },
+    { "clear_progression", (PyCFunction)GMPy_XMPZ_Method_ClearProgression, METH_FASTCALL, GMPy_doc_xmpz_method_clear_progression },
     { "conjugate", GMPy_MP_Method_Conjugate, METH_NOARGS, GMPy_doc_mp_method_conjugate },
     { "copy", GMPy_XMPZ_Method_Copy, METH_NOARGS, GMPy_doc_xmpz_method_copy },
     { "digits", GMPy_XMPZ_Digits_Method, METH_VARARGS, GMPy_doc_mpz_digits_method },
     { "iter_bits", (PyCFunction)GMPy_XMPZ_Method_IterBits, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_iter_bits },
     { "iter_clear", (PyCFunction)GMPy_XMPZ_Method_IterClear, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_iter_clear },
+    { "iter_runs", (PyCFunction)GMPy_XMPZ_Method_IterRuns, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_iter_runs },
     { "iter_set", (PyCFunction)GMPy_XMPZ_Method_IterSet, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_iter_set },
+    { "iter_set_batched", (PyCFunction)GMPy_XMPZ_Method_IterSetBatched, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_iter_set_batched },
     { "make_mpz", GMPy_XMPZ_Method_MakeMPZ, METH_NOARGS, GMPy_doc_xmpz_method_make_mpz },
     { "num_digits", (PyCFunction)GMPy_MPZ_Method_NumDigits, METH_FASTCALL, GMPy_doc_mpz_method_num_digits },
     { "num_limbs", GMPy_XMPZ_Method_NumLimbs, METH_NOARGS, GMPy_doc_xmpz_method_num_limbs },
+    { "rank1", GMPy_XMPZ_Method_Rank1, METH_O, GMPy_doc_xmpz_method_rank1 },
+    { "select1", GMPy_XMPZ_Method_Select1, METH_O, GMPy_doc_xmpz_method_select1 },
+    { "set_progression", (PyCFunction)GMPy_XMPZ_Method_SetProgression, METH_FASTCALL, GMPy_doc_xmpz_method_set_progression },
+    { "set_positions", (PyCFunction)GMPy_XMPZ_Method_SetPositions, METH_VARARGS | METH_KEYWORDS, GMPy_doc_xmpz_method_set_positions },
+    { "sieve_clear", (PyCFunction)GMPy_XMPZ_Method_SieveClear, METH_FASTCALL, GMPy_doc_xmpz_method_sieve_clear },
     { "limbs_read", GMPy_XMPZ_Method_LimbsRead, METH_NOARGS, GMPy_doc_xmpz_method_limbs_read },
     { "limbs_write", GMPy_XMPZ_Method_LimbsWrite, METH_O, GMPy_doc_xmpz_method_limbs_write },
     { "limbs_modify", GMPy_XMPZ_Method_LimbsModify, METH_O, GMPy_doc_xmpz_method_limbs_modify },
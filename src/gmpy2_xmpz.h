@@ -40,6 +40,7 @@ typedef struct {
     PyObject_HEAD
     XMPZ_Object *bitmap;
     mp_bitcnt_t start, stop;
+    Py_ssize_t batch;
     int iter_type;
 } GMPy_Iter_Object;
 
@@ -38,6 +38,7 @@ GMPy_XMPZ_IAdd_Slot(PyObject *self, PyObject *other)
 
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     int ytype = GMPy_ObjectType(other);
 
@@ -90,6 +91,7 @@ GMPy_XMPZ_ISub_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     int ytype = GMPy_ObjectType(other);
 
@@ -142,6 +144,7 @@ GMPy_XMPZ_IMul_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     int ytype = GMPy_ObjectType(other);
 
@@ -191,6 +194,7 @@ GMPy_XMPZ_IFloorDiv_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     int ytype = GMPy_ObjectType(other);
 
@@ -252,6 +256,7 @@ GMPy_XMPZ_IRem_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     int ytype = GMPy_ObjectType(other);
 
@@ -314,6 +319,7 @@ GMPy_XMPZ_IRshift_Slot(PyObject *self, PyObject *other)
     if (shift == (mp_bitcnt_t)(-1) && PyErr_Occurred())
         return NULL;
 
+    XMPZ_MODIFIED(self);
     mpz_fdiv_q_2exp(MPZ(self), MPZ(self), shift);
     Py_INCREF(self);
     return self;
@@ -331,6 +337,7 @@ GMPy_XMPZ_ILshift_Slot(PyObject *self, PyObject *other)
     if (shift == (mp_bitcnt_t)(-1) && PyErr_Occurred())
         return NULL;
 
+    XMPZ_MODIFIED(self);
     mpz_mul_2exp(MPZ(self), MPZ(self), shift);
     Py_INCREF(self);
     return self;
@@ -348,6 +355,7 @@ GMPy_XMPZ_IPow_Slot(PyObject *self, PyObject *other, PyObject *mod)
     if (exp == (unsigned long)(-1) && PyErr_Occurred())
         return NULL;
 
+    XMPZ_MODIFIED(self);
     mpz_pow_ui(MPZ(self), MPZ(self), exp);
     Py_INCREF((PyObject*)self);
     return self;
@@ -363,6 +371,7 @@ GMPy_XMPZ_IAnd_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     if (CHECK_MPZANY(other)) {
         GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
@@ -400,6 +409,7 @@ GMPy_XMPZ_IXor_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     if(CHECK_MPZANY(other)) {
         GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
@@ -437,6 +447,7 @@ GMPy_XMPZ_IIor_Slot(PyObject *self, PyObject *other)
 {
     CTXT_Object *context = NULL;
     CHECK_CONTEXT(context);
+    XMPZ_MODIFIED(self);
 
     if(CHECK_MPZANY(other)) {
         GMPY_MAYBE_BEGIN_ALLOW_THREADS(context);
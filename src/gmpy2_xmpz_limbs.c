@@ -57,6 +57,7 @@ static PyObject* GMPy_XMPZ_Method_LimbsWrite(PyObject* obj, PyObject* other)
     }
     else {
         size_t num_limbs = (size_t) PyLong_AsSsize_t(other);
+        XMPZ_MODIFIED(obj);
         mp_limb_t * limbs = mpz_limbs_write(XMPZ(obj), (mp_size_t) num_limbs);
         return PyLong_FromVoidPtr((void *) limbs);
     }
@@ -76,6 +77,7 @@ static PyObject* GMPy_XMPZ_Method_LimbsModify(PyObject* obj, PyObject* other)
     }
     else {
         size_t num_limbs = (size_t) PyLong_AsSsize_t(other);
+        XMPZ_MODIFIED(obj);
         mp_limb_t * limbs = mpz_limbs_modify(XMPZ(obj), (mp_size_t) num_limbs);
         return PyLong_FromVoidPtr((void *) limbs);
     }
@@ -94,6 +96,7 @@ static PyObject* GMPy_XMPZ_Method_LimbsFinish(PyObject* obj, PyObject* other)
     }
     else {
         size_t num_limbs = (size_t) PyLong_AsSsize_t(other);
+        XMPZ_MODIFIED(obj);
         mpz_limbs_finish(XMPZ(obj), num_limbs);
         Py_RETURN_NONE;
     }
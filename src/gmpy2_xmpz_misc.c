@@ -65,6 +65,7 @@ GMPy_XMPZ_Function_XbitMask(PyObject *self, PyObject *other)
 static PyObject *
 GMPy_XMPZ_Abs_Slot(XMPZ_Object *x)
 {
+    XMPZ_MODIFIED(x);
     mpz_abs(x->z, x->z);
     Py_RETURN_NONE;
 }
@@ -72,6 +73,7 @@ GMPy_XMPZ_Abs_Slot(XMPZ_Object *x)
 static PyObject *
 GMPy_XMPZ_Neg_Slot(XMPZ_Object *x)
 {
+    XMPZ_MODIFIED(x);
     mpz_neg(x->z, x->z);
     Py_RETURN_NONE;
 }
@@ -93,6 +95,7 @@ GMPy_XMPZ_NonZero_Slot(XMPZ_Object *x)
 static PyObject *
 GMPy_XMPZ_Com_Slot(XMPZ_Object *x)
 {
+    XMPZ_MODIFIED(x);
     mpz_com(x->z, x->z);
     Py_RETURN_NONE;
 }
@@ -113,6 +116,7 @@ GMPy_XMPZ_Method_MakeMPZ(PyObject *self, PyObject *other)
     if (!(result = GMPy_MPZ_New(context))) {
         return NULL;
     }
+    XMPZ_MODIFIED(self);
     mpz_swap(result->z, MPZ(self));
     mpz_set_ui(MPZ(self), 0);
     return (PyObject*)result;
@@ -132,6 +136,72 @@ GMPy_XMPZ_Method_Copy(PyObject *self, PyObject *other)
     return (PyObject*)GMPy_XMPZ_From_XMPZ((XMPZ_Object*)self, context);
 }
 
+/* Support for the out= keyword of integer functions. GMPy_XMPZ_ParseOut()
+ * accepts only out= in kwnames and sets *out to the xmpz, or to NULL if
+ * out= is missing or None. GMPy_MPZ_NewOut() returns a new reference to
+ * out, or a new mpz if out is NULL. Functions that may fail after they
+ * start writing the result (gcd, lcm, invert) compute into a new mpz
+ * instead and finish with GMPy_MPZ_SetOut(), so out is unchanged on error.
+ */
+
+static int
+GMPy_XMPZ_ParseOut(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                   const char *name, PyObject **out)
+{
+    PyObject *value;
+
+    *out = NULL;
+    if (!kwnames || PyTuple_GET_SIZE(kwnames) == 0) {
+        return 0;
+    }
+
+    if (PyTuple_GET_SIZE(kwnames) > 1 ||
+        !PyUnicode_Check(PyTuple_GET_ITEM(kwnames, 0)) ||
+        PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, 0), "out")) {
+        PyErr_Format(PyExc_TypeError, "%s() got an invalid keyword argument", name);
+        return -1;
+    }
+
+    value = args[nargs];
+    if (Py_IsNone(value)) {
+        return 0;
+    }
+    if (!XMPZ_Check(value)) {
+        PyErr_Format(PyExc_TypeError, "%s() out must be an 'xmpz'", name);
+        return -1;
+    }
+    *out = value;
+    return 0;
+}
+
+static MPZ_Object *
+GMPy_MPZ_NewOut(PyObject *out, CTXT_Object *context)
+{
+    if (out) {
+        XMPZ_MODIFIED(out);
+        Py_INCREF(out);
+        return (MPZ_Object*)out;
+    }
+    return GMPy_MPZ_New(context);
+}
+
+/* Steals the reference to result. If out is not NULL, the value of result
+ * is moved into out and a new reference to out is returned.
+ */
+
+static PyObject *
+GMPy_MPZ_SetOut(MPZ_Object *result, PyObject *out)
+{
+    if (!result || !out) {
+        return (PyObject*)result;
+    }
+    XMPZ_MODIFIED(out);
+    mpz_swap(MPZ(out), result->z);
+    Py_DECREF((PyObject*)result);
+    Py_INCREF(out);
+    return out;
+}
+
 /*
  * Add mapping support to xmpz objects.
  */
@@ -142,6 +212,314 @@ GMPy_XMPZ_Method_Length(XMPZ_Object *obj)
     return mpz_sizeinbase(obj->z, 2);
 }
 
+/* Word-level helpers for bit operations on a non-negative xmpz. Limbs at
+ * or above size are treated as 0.
+ */
+
+#define XMPZ_LIMB_BITS GMP_NUMB_BITS
+
+/* Return the XMPZ_LIMB_BITS bits of src starting at bit off. */
+
+static mp_limb_t
+GMPy_XMPZ_GetLimb(const mp_limb_t *src, mp_size_t size, mp_bitcnt_t off)
+{
+    mp_size_t i = (mp_size_t)(off / XMPZ_LIMB_BITS);
+    unsigned int s = (unsigned int)(off % XMPZ_LIMB_BITS);
+    mp_limb_t lo, hi;
+
+    lo = i < size ? src[i] : 0;
+    if (s == 0) {
+        return lo;
+    }
+    hi = i + 1 < size ? src[i + 1] : 0;
+    return (lo >> s) | (hi << (XMPZ_LIMB_BITS - s));
+}
+
+/* Copy len bits of src, starting at bit 0, to bits start..start+len-1 of
+ * dst. dst must have enough limbs for bit start+len-1.
+ */
+
+static void
+GMPy_XMPZ_CopyBits(mp_limb_t *dst, mp_bitcnt_t start, mp_bitcnt_t len,
+                   const mp_limb_t *src, mp_size_t size)
+{
+    mp_bitcnt_t done = 0, pos, take;
+    mp_limb_t mask, bits;
+    unsigned int off;
+
+    while (done < len) {
+        pos = start + done;
+        off = (unsigned int)(pos % XMPZ_LIMB_BITS);
+        take = XMPZ_LIMB_BITS - off;
+        if (take > len - done) {
+            take = len - done;
+        }
+        mask = (take == XMPZ_LIMB_BITS) ? ~(mp_limb_t)0 : (((mp_limb_t)1 << take) - 1);
+        bits = GMPy_XMPZ_GetLimb(src, size, done);
+        mask <<= off;
+        dst[pos / XMPZ_LIMB_BITS] = (dst[pos / XMPZ_LIMB_BITS] & ~mask) | ((bits << off) & mask);
+        done += take;
+    }
+}
+
+/* Set bit start+i*step of dst to bit i of src for 0 <= i < len. step may be
+ * negative. src is read one limb at a time.
+ */
+
+static void
+GMPy_XMPZ_Scatter(mp_limb_t *dst, Py_ssize_t start, Py_ssize_t step, Py_ssize_t len,
+                  const mp_limb_t *src, mp_size_t size)
+{
+    Py_ssize_t i, cur;
+    mp_limb_t w = 0, m;
+
+    for (i = 0, cur = start; i < len; i++, cur += step) {
+        if (i % XMPZ_LIMB_BITS == 0) {
+            w = (i / XMPZ_LIMB_BITS < size) ? src[i / XMPZ_LIMB_BITS] : 0;
+        }
+        m = (mp_limb_t)1 << (cur % XMPZ_LIMB_BITS);
+        if (w & 1) {
+            dst[cur / XMPZ_LIMB_BITS] |= m;
+        }
+        else {
+            dst[cur / XMPZ_LIMB_BITS] &= ~m;
+        }
+        w >>= 1;
+    }
+}
+
+/* Set result to the len bits of src at positions start+i*step. The bits
+ * are collected into whole limbs before they are stored.
+ */
+
+static void
+GMPy_XMPZ_Gather(mpz_t result, const mp_limb_t *src, mp_size_t size,
+                 Py_ssize_t start, Py_ssize_t step, Py_ssize_t len)
+{
+    mp_size_t n = (mp_size_t)((len + XMPZ_LIMB_BITS - 1) / XMPZ_LIMB_BITS), k;
+    mp_limb_t *dst, w = 0;
+    Py_ssize_t i, cur;
+
+    if (len == 0) {
+        mpz_set_ui(result, 0);
+        return;
+    }
+
+    if (result->_mp_alloc < n) {
+        _mpz_realloc(result, n);
+    }
+    dst = result->_mp_d;
+
+    if (step == 1) {
+        for (k = 0; k < n; k++) {
+            dst[k] = GMPy_XMPZ_GetLimb(src, size, (mp_bitcnt_t)start + (mp_bitcnt_t)k * XMPZ_LIMB_BITS);
+        }
+        if (len % XMPZ_LIMB_BITS) {
+            dst[n - 1] &= ((mp_limb_t)1 << (len % XMPZ_LIMB_BITS)) - 1;
+        }
+    }
+    else {
+        for (i = 0, cur = start; i < len; i++, cur += step) {
+            if (cur / XMPZ_LIMB_BITS < size &&
+                (src[cur / XMPZ_LIMB_BITS] >> (cur % XMPZ_LIMB_BITS)) & 1) {
+                w |= (mp_limb_t)1 << (i % XMPZ_LIMB_BITS);
+            }
+            if (i % XMPZ_LIMB_BITS == XMPZ_LIMB_BITS - 1) {
+                dst[i / XMPZ_LIMB_BITS] = w;
+                w = 0;
+            }
+        }
+        if (len % XMPZ_LIMB_BITS) {
+            dst[n - 1] = w;
+        }
+    }
+
+    while (n > 0 && dst[n - 1] == 0) {
+        n--;
+    }
+    result->_mp_size = (int)n;
+}
+
+/* Set (or clear) the bits start, start+step, ... that are less than stop.
+ * dst must have enough limbs for bit stop-1. When step is at most the limb
+ * size, the bits in each limb are set with a single precomputed mask that
+ * is shifted to the first position in the limb.
+ */
+
+static void
+GMPy_XMPZ_FillProgression(mp_limb_t *dst, mp_bitcnt_t start, mp_bitcnt_t step,
+                          mp_bitcnt_t stop, int set)
+{
+    mp_size_t k, last;
+    mp_limb_t pattern = 0, mask;
+    mp_bitcnt_t r, adv, cur;
+
+    if (start >= stop) {
+        return;
+    }
+
+    if (step > XMPZ_LIMB_BITS) {
+        for (cur = start; cur < stop; cur += step) {
+            if (set) {
+                dst[cur / XMPZ_LIMB_BITS] |= (mp_limb_t)1 << (cur % XMPZ_LIMB_BITS);
+            }
+            else {
+                dst[cur / XMPZ_LIMB_BITS] &= ~((mp_limb_t)1 << (cur % XMPZ_LIMB_BITS));
+            }
+        }
+        return;
+    }
+
+    for (r = 0; r < XMPZ_LIMB_BITS; r += step) {
+        pattern |= (mp_limb_t)1 << r;
+    }
+
+    /* r is the position of the first bit in limb k; adv is the change in
+     * r from one limb to the next, modulo step.
+     */
+    k = (mp_size_t)(start / XMPZ_LIMB_BITS);
+    last = (mp_size_t)((stop - 1) / XMPZ_LIMB_BITS);
+    r = start % XMPZ_LIMB_BITS;
+    adv = (step - XMPZ_LIMB_BITS % step) % step;
+
+    for (;;) {
+        mask = pattern << r;
+        if (k == last) {
+            if (stop % XMPZ_LIMB_BITS) {
+                mask &= ((mp_limb_t)1 << (stop % XMPZ_LIMB_BITS)) - 1;
+            }
+            if (set) {
+                dst[k] |= mask;
+            }
+            else {
+                dst[k] &= ~mask;
+            }
+            break;
+        }
+        if (set) {
+            dst[k] |= mask;
+        }
+        else {
+            dst[k] &= ~mask;
+        }
+        if (r >= step) {
+            /* Only possible in the first limb. */
+            r %= step;
+        }
+        r += adv;
+        if (r >= step) {
+            r -= step;
+        }
+        k++;
+    }
+}
+
+/* Make sure z has at least need limbs, clearing any new limbs. Returns the
+ * new number of limbs in use.
+ */
+
+static mp_size_t
+GMPy_XMPZ_Grow(mpz_t z, mp_size_t need)
+{
+    mp_size_t size = (mp_size_t)mpz_size(z);
+
+    if (need > size) {
+        if (z->_mp_alloc < need) {
+            _mpz_realloc(z, need);
+        }
+        memset(z->_mp_d + size, 0, (need - size) * sizeof(mp_limb_t));
+        size = need;
+    }
+    return size;
+}
+
+static void
+GMPy_XMPZ_Normalize(mpz_t z, mp_size_t size)
+{
+    while (size > 0 && z->_mp_d[size - 1] == 0) {
+        size--;
+    }
+    z->_mp_size = (int)size;
+}
+
+/* Set (or clear) the bits start, start+step, ... that are less than stop
+ * in the non-negative xmpz z. Setting bits grows z as needed.
+ */
+
+static void
+GMPy_XMPZ_SetProgression(mpz_t z, mp_bitcnt_t start, mp_bitcnt_t step,
+                         mp_bitcnt_t stop, int set)
+{
+    mp_size_t size = (mp_size_t)mpz_size(z);
+
+    if (start >= stop) {
+        return;
+    }
+
+    if (set) {
+        /* Stop just after the last bit that is set. */
+        stop = start + ((stop - 1 - start) / step) * step + 1;
+        size = GMPy_XMPZ_Grow(z, (mp_size_t)((stop - 1) / XMPZ_LIMB_BITS) + 1);
+    }
+    else {
+        /* Bits above the top limb are already clear. */
+        if (stop > (mp_bitcnt_t)size * XMPZ_LIMB_BITS) {
+            stop = (mp_bitcnt_t)size * XMPZ_LIMB_BITS;
+        }
+    }
+
+    GMPy_XMPZ_FillProgression(z->_mp_d, start, step, stop, set);
+    GMPy_XMPZ_Normalize(z, size);
+}
+
+/* Assign len bits of the positive integer value to positions start+i*step
+ * of the non-negative xmpz z.
+ */
+
+static void
+GMPy_XMPZ_AssignBits(mpz_t z, Py_ssize_t start, Py_ssize_t step, Py_ssize_t len,
+                     mpz_srcptr value)
+{
+    mp_size_t size;
+    Py_ssize_t top;
+
+    if (len <= 0) {
+        return;
+    }
+
+    top = step > 0 ? start + (len - 1) * step : start;
+    size = GMPy_XMPZ_Grow(z, (mp_size_t)(top / XMPZ_LIMB_BITS) + 1);
+
+    if (step == 1) {
+        GMPy_XMPZ_CopyBits(z->_mp_d, (mp_bitcnt_t)start, (mp_bitcnt_t)len,
+                           value->_mp_d, (mp_size_t)mpz_size(value));
+    }
+    else {
+        GMPy_XMPZ_Scatter(z->_mp_d, start, step, len,
+                          value->_mp_d, (mp_size_t)mpz_size(value));
+    }
+    GMPy_XMPZ_Normalize(z, size);
+}
+
+/* Set (or clear) the slice start, start+step, ... of length len of the
+ * non-negative xmpz z. step may be negative.
+ */
+
+static void
+GMPy_XMPZ_FillSlice(mpz_t z, Py_ssize_t start, Py_ssize_t step, Py_ssize_t len,
+                    int set)
+{
+    if (len <= 0) {
+        return;
+    }
+    if (step < 0) {
+        start += (len - 1) * step;
+        step = -step;
+    }
+    GMPy_XMPZ_SetProgression(z, (mp_bitcnt_t)start, (mp_bitcnt_t)step,
+                             (mp_bitcnt_t)(start + (len - 1) * step + 1), set);
+}
+
 static PyObject *
 GMPy_XMPZ_Method_SubScript(XMPZ_Object* self, PyObject* item)
 {
@@ -180,6 +558,12 @@ GMPy_XMPZ_Method_SubScript(XMPZ_Object* self, PyObject* item)
             return NULL;
         }
 
+        if (mpz_sgn(self->z) >= 0) {
+            GMPy_XMPZ_Gather(result->z, self->z->_mp_d, (mp_size_t)mpz_size(self->z),
+                             start, step, slicelength);
+            return (PyObject*)result;
+        }
+
         mpz_set_ui(result->z, 0);
         if (slicelength > 0) {
             for (cur = start, i = 0; i < slicelength; cur += step, i++) {
@@ -202,6 +586,7 @@ GMPy_XMPZ_Method_AssignSubScript(XMPZ_Object* self, PyObject* item, PyObject* va
     CTXT_Object *context = NULL;
 
     CHECK_CONTEXT_M1(context);
+    XMPZ_MODIFIED(self);
 
     if (PyIndex_Check(item)) {
         Py_ssize_t bit_value, i;
@@ -274,7 +659,15 @@ GMPy_XMPZ_Method_AssignSubScript(XMPZ_Object* self, PyObject* item, PyObject* va
                 VALUE_ERROR("must specify bit sequence as an integer");
                 return -1;
             }
-            if (mpz_sgn(tempx->z) == 0) {
+            if (mpz_sgn(self->z) >= 0 && mpz_sgn(tempx->z) > 0) {
+                GMPy_XMPZ_AssignBits(self->z, start, step, slicelength, tempx->z);
+            }
+            else if (mpz_sgn(self->z) >= 0 &&
+                     (mpz_sgn(tempx->z) == 0 || !(mpz_cmp_si(tempx->z, -1)))) {
+                GMPy_XMPZ_FillSlice(self->z, start, step, slicelength,
+                                    mpz_sgn(tempx->z) != 0);
+            }
+            else if (mpz_sgn(tempx->z) == 0) {
                 for (cur = start, i = 0; i < slicelength; cur += step, i++) {
                     mpz_clrbit(self->z, cur);
                 }
@@ -306,6 +699,191 @@ GMPy_XMPZ_Method_AssignSubScript(XMPZ_Object* self, PyObject* item, PyObject* va
     return -1;
 }
 
+/* Set (or clear) the bits start, start+step, ... that are less than stop.
+ * A negative xmpz uses the per-bit functions since its bits are in 2's
+ * complement format.
+ */
+
+static void
+GMPy_XMPZ_Progression(mpz_t z, mp_bitcnt_t start, mp_bitcnt_t step,
+                      mp_bitcnt_t stop, int set)
+{
+    mp_bitcnt_t cur;
+
+    if (mpz_sgn(z) >= 0) {
+        GMPy_XMPZ_SetProgression(z, start, step, stop, set);
+        return;
+    }
+
+    for (cur = start; cur < stop; cur += step) {
+        if (set) {
+            mpz_setbit(z, cur);
+        }
+        else {
+            mpz_clrbit(z, cur);
+        }
+        if (step > stop - cur) {
+            break;
+        }
+    }
+}
+
+static PyObject *
+GMPy_XMPZ_ProgressionMethod(PyObject *self, PyObject *const *args,
+                            Py_ssize_t nargs, const char *name, int set)
+{
+    mp_bitcnt_t start, step, stop;
+
+    if (nargs != 3) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 3 arguments", name);
+        return NULL;
+    }
+
+    start = GMPy_Integer_AsMpBitCnt(args[0]);
+    if (start == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        return NULL;
+    }
+    step = GMPy_Integer_AsMpBitCnt(args[1]);
+    if (step == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        return NULL;
+    }
+    stop = GMPy_Integer_AsMpBitCnt(args[2]);
+    if (stop == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        return NULL;
+    }
+
+    if (step == 0) {
+        PyErr_Format(PyExc_ValueError, "%s() step must be > 0", name);
+        return NULL;
+    }
+
+    XMPZ_MODIFIED(self);
+    GMPy_XMPZ_Progression(MPZ(self), start, step, stop, set);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_clear_progression,
+"x.clear_progression(start, step, stop, /) -> None\n\n"
+"Clear the bits start, start+step, start+2*step, ... of x that are\n"
+"less than stop. This is the same as x[start:stop:step] = 0 but\n"
+"requires step > 0.");
+
+static PyObject *
+GMPy_XMPZ_Method_ClearProgression(PyObject *self, PyObject *const *args,
+                                  Py_ssize_t nargs)
+{
+    return GMPy_XMPZ_ProgressionMethod(self, args, nargs, "clear_progression", 0);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_set_progression,
+"x.set_progression(start, step, stop, /) -> None\n\n"
+"Set the bits start, start+step, start+2*step, ... of x that are less\n"
+"than stop. This is the same as x[start:stop:step] = -1 but requires\n"
+"step > 0.");
+
+static PyObject *
+GMPy_XMPZ_Method_SetProgression(PyObject *self, PyObject *const *args,
+                                Py_ssize_t nargs)
+{
+    return GMPy_XMPZ_ProgressionMethod(self, args, nargs, "set_progression", 1);
+}
+
+/* sieve_clear() processes x in blocks of GMPY_SIEVE_BLOCK bits and clears
+ * the multiples of every prime in a block before moving to the next one,
+ * so a block is loaded into the cache only once.
+ */
+
+#define GMPY_SIEVE_BLOCK ((mp_bitcnt_t)1 << 18)
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_sieve_clear,
+"x.sieve_clear(primes, offsets, /) -> None\n\n"
+"For each p in primes and the corresponding o in offsets, clear the\n"
+"bits o, o+p, o+2*p, ... of x. This is the same as x[o::p] = 0 for\n"
+"every pair but is faster when x is large. Every p must be > 0.");
+
+static PyObject *
+GMPy_XMPZ_Method_SieveClear(PyObject *self, PyObject *const *args,
+                            Py_ssize_t nargs)
+{
+    PyObject *primes = NULL, *offsets = NULL;
+    mp_bitcnt_t *next = NULL, *step = NULL, nbits, lo, hi;
+    Py_ssize_t i, n;
+    mpz_ptr z = MPZ(self);
+
+    if (nargs != 2) {
+        TYPE_ERROR("sieve_clear() requires 2 arguments");
+        return NULL;
+    }
+
+    if (!(primes = PySequence_Fast(args[0], "sieve_clear() primes must be a sequence"))) {
+        return NULL;
+    }
+    if (!(offsets = PySequence_Fast(args[1], "sieve_clear() offsets must be a sequence"))) {
+        Py_DECREF(primes);
+        return NULL;
+    }
+
+    n = PySequence_Fast_GET_SIZE(primes);
+    if (n != PySequence_Fast_GET_SIZE(offsets)) {
+        VALUE_ERROR("sieve_clear() requires primes and offsets of the same length");
+        goto error;
+    }
+
+    if (!(next = PyMem_New(mp_bitcnt_t, n)) || !(step = PyMem_New(mp_bitcnt_t, n))) {
+        PyErr_NoMemory(); /* LCOV_EXCL_LINE */
+        goto error; /* LCOV_EXCL_LINE */
+    }
+
+    for (i = 0; i < n; i++) {
+        step[i] = GMPy_Integer_AsMpBitCnt(PySequence_Fast_GET_ITEM(primes, i));
+        if (step[i] == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+            goto error;
+        }
+        if (step[i] == 0) {
+            VALUE_ERROR("sieve_clear() primes must be > 0");
+            goto error;
+        }
+        next[i] = GMPy_Integer_AsMpBitCnt(PySequence_Fast_GET_ITEM(offsets, i));
+        if (next[i] == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+            goto error;
+        }
+    }
+
+    XMPZ_MODIFIED(self);
+    if (mpz_sgn(z) < 0) {
+        nbits = mpz_sizeinbase(z, 2);
+        for (i = 0; i < n; i++) {
+            GMPy_XMPZ_Progression(z, next[i], step[i], nbits, 0);
+        }
+    }
+    else {
+        nbits = (mp_bitcnt_t)mpz_size(z) * XMPZ_LIMB_BITS;
+        for (lo = 0; lo < nbits; lo = hi) {
+            hi = (nbits - lo > GMPY_SIEVE_BLOCK) ? lo + GMPY_SIEVE_BLOCK : nbits;
+            for (i = 0; i < n; i++) {
+                if (next[i] < hi) {
+                    GMPy_XMPZ_FillProgression(z->_mp_d, next[i], step[i], hi, 0);
+                    next[i] += ((hi - next[i] + step[i] - 1) / step[i]) * step[i];
+                }
+            }
+        }
+        GMPy_XMPZ_Normalize(z, (mp_size_t)mpz_size(z));
+    }
+
+    PyMem_Free(next);
+    PyMem_Free(step);
+    Py_DECREF(primes);
+    Py_DECREF(offsets);
+    Py_RETURN_NONE;
+
+  error:
+    PyMem_Free(next);
+    PyMem_Free(step);
+    Py_DECREF(primes);
+    Py_DECREF(offsets);
+    return NULL;
+}
+
 /* Implement a multi-purpose iterator object that iterates over the bits in
  * an xmpz. Three different iterators can be created:
  *   1) xmpz.iter_bits(start=0, stop=-1) will return True/False for each bit
@@ -317,9 +895,64 @@ GMPy_XMPZ_Method_AssignSubScript(XMPZ_Object* self, PyObject* item, PyObject* va
  *   3) xmpz.iter_clear(start=0, stop=-1, scale=1, offset=0) will return
  *      (scale*bit_position + offset) when bit_position is clear, beginning at
  *      'start', ending at 'stop'.
+ *   4) xmpz.iter_set_batched(n, start=0, stop=-1) will return lists of up
+ *      to n positions of set bits.
+ *   5) xmpz.iter_runs(start=0, stop=-1) will return (start, length) for
+ *      every run of consecutive set bits.
  *
  */
 
+/* Append the positions of the set bits of z in [*start, stop) to list,
+ * but no more than count of them if count >= 0. *start is advanced past
+ * the last position that was checked. The limbs of a non-negative z are
+ * read directly and each set bit is found with a count of trailing zeros.
+ */
+
+static int
+GMPy_XMPZ_CollectSet(PyObject *list, mpz_srcptr z, mp_bitcnt_t *start,
+                     mp_bitcnt_t stop, Py_ssize_t count)
+{
+    mp_bitcnt_t pos = *start, bit;
+    mp_size_t k;
+    mp_limb_t w;
+    PyObject *item;
+    int rc;
+
+    if (mpz_sgn(z) >= 0 && stop > (mp_bitcnt_t)mpz_size(z) * XMPZ_LIMB_BITS) {
+        stop = (mp_bitcnt_t)mpz_size(z) * XMPZ_LIMB_BITS;
+    }
+
+    while (count != 0 && pos < stop) {
+        if (mpz_sgn(z) >= 0) {
+            k = (mp_size_t)(pos / XMPZ_LIMB_BITS);
+            w = z->_mp_d[k] & (~(mp_limb_t)0 << (pos % XMPZ_LIMB_BITS));
+            if (!w) {
+                pos = (mp_bitcnt_t)(k + 1) * XMPZ_LIMB_BITS;
+                continue;
+            }
+            bit = (mp_bitcnt_t)k * XMPZ_LIMB_BITS + mpn_scan1(&w, 0);
+        }
+        else {
+            bit = mpz_scan1(z, pos);
+        }
+        if (bit >= stop) {
+            break;
+        }
+        if (!(item = GMPy_PyLong_FromMpBitCnt(bit))) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+        rc = PyList_Append(list, item);
+        Py_DECREF(item);
+        if (rc < 0) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+        pos = bit + 1;
+        count--;
+    }
+    *start = count == 0 ? pos : stop;
+    return 0;
+}
+
 static GMPy_Iter_Object *
 GMPy_Iter_New(void)
 {
@@ -330,6 +963,7 @@ GMPy_Iter_New(void)
         result->bitmap = NULL;
         result->start = 0;
         result->stop = (mp_bitcnt_t)-1;
+        result->batch = 0;
         result->iter_type = 1;
     }
     return result;
@@ -389,6 +1023,38 @@ GMPy_Iter_Next(GMPy_Iter_Object *self) {
                 }
             }
             break;
+        case 4:
+            if (self->start >= current_stop)
+                PyErr_SetNone(PyExc_StopIteration);
+            else if ((result = PyList_New(0))) {
+                if (GMPy_XMPZ_CollectSet(result, self->bitmap->z, &self->start,
+                                         current_stop, self->batch) < 0) {
+                    Py_CLEAR(result);
+                }
+                else if (PyList_GET_SIZE(result) == 0) {
+                    Py_CLEAR(result);
+                    PyErr_SetNone(PyExc_StopIteration);
+                }
+            }
+            break;
+        case 5:
+            if (self->start >= current_stop)
+                PyErr_SetNone(PyExc_StopIteration);
+            else {
+                temp = mpz_scan1(self->bitmap->z, self->start);
+                if (temp == (mp_bitcnt_t)(-1) || temp >= current_stop) {
+                    self->start = current_stop;
+                    PyErr_SetNone(PyExc_StopIteration);
+                }
+                else {
+                    self->start = mpz_scan0(self->bitmap->z, temp);
+                    if (self->start > current_stop)
+                        self->start = current_stop;
+                    result = Py_BuildValue("(NN)", GMPy_PyLong_FromMpBitCnt(temp),
+                                           GMPy_PyLong_FromMpBitCnt(self->start - temp));
+                }
+            }
+            break;
         default:
             SYSTEM_ERROR("Illegal iter_type in gmpy2.Iterator.");
     }
@@ -502,6 +1168,115 @@ GMPy_XMPZ_Method_IterClear(PyObject *self, PyObject *args, PyObject *kwargs)
     return (PyObject*)result;
 }
 
+PyDoc_STRVAR(GMPy_doc_xmpz_method_iter_set_batched,
+"x.iter_set_batched(n, start=0, stop=-1) -> collections.abc.Iterator\n\n"
+"Return an iterator yielding lists of the positions of the bits that\n"
+"are set in x, in increasing order, for positions in [start, stop). If\n"
+"'stop' is negative there is no upper limit. Every list holds n\n"
+"positions except the last one, which holds from 1 to n; no list is\n"
+"yielded if no bit in the range is set.");
+
+static PyObject *
+GMPy_XMPZ_Method_IterSetBatched(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    GMPy_Iter_Object *result;
+    Py_ssize_t batch, start = 0, stop = -1;
+
+    static char *kwlist[] = {"n", "start", "stop", NULL };
+
+    if (!(PyArg_ParseTupleAndKeywords(args, kwargs, "n|nn", kwlist, &batch, &start, &stop))) {
+        return NULL;
+    }
+
+    if (batch <= 0) {
+        VALUE_ERROR("iter_set_batched() requires n > 0");
+        return NULL;
+    }
+
+    if (!(result = GMPy_Iter_New())) {
+        return NULL;
+    }
+
+    result->iter_type = 4;
+    result->bitmap = (XMPZ_Object*)self;
+    Py_INCREF(self);
+    result->start = start;
+    result->stop = stop;
+    result->batch = batch;
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_iter_runs,
+"x.iter_runs(start=0, stop=-1) -> collections.abc.Iterator\n\n"
+"Return an iterator yielding a tuple (position, length) for every run\n"
+"of consecutive 1-bits in x, beginning at 'start'. If a positive value\n"
+"is specified for 'stop', iteration is continued until 'stop' is\n"
+"reached and a run that continues past 'stop' is shortened. If a\n"
+"negative value is specified, iteration is continued until the last\n"
+"1-bit.");
+
+static PyObject *
+GMPy_XMPZ_Method_IterRuns(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    GMPy_Iter_Object *result;
+    Py_ssize_t start = 0, stop = -1;
+
+    static char *kwlist[] = {"start", "stop", NULL };
+
+    if (!(result = GMPy_Iter_New())) {
+        return NULL;
+    }
+
+    if (!(PyArg_ParseTupleAndKeywords(args, kwargs, "|nn", kwlist, &start, &stop))) {
+        Py_XDECREF((PyObject*)result);
+        return NULL;
+    }
+
+    result->iter_type = 5;
+    result->bitmap = (XMPZ_Object*)self;
+    Py_INCREF(self);
+    result->start = start;
+    result->stop = stop;
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_set_positions,
+"x.set_positions(start=0, stop=-1) -> list[int]\n\n"
+"Return a list of the positions of all bits that are set in x,\n"
+"beginning at 'start'. If a positive value is specified for 'stop',\n"
+"positions at or after 'stop' are not included. If a negative value is\n"
+"specified, all positions up to the last 1-bit are included.");
+
+static PyObject *
+GMPy_XMPZ_Method_SetPositions(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *result;
+    Py_ssize_t start = 0, stop = -1;
+    mp_bitcnt_t pos, current_stop;
+
+    static char *kwlist[] = {"start", "stop", NULL };
+
+    if (!(PyArg_ParseTupleAndKeywords(args, kwargs, "|nn", kwlist, &start, &stop))) {
+        return NULL;
+    }
+
+    if (!(result = PyList_New(0))) {
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+
+    pos = start;
+    if (stop < 0)
+        current_stop = mpz_sizeinbase(MPZ(self), 2);
+    else
+        current_stop = stop;
+
+    if (GMPy_XMPZ_CollectSet(result, MPZ(self), &pos, current_stop, -1) < 0) {
+        Py_DECREF(result); /* LCOV_EXCL_LINE */
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+    return result;
+}
+
 static PyObject *
 GMPy_XMPZ_Attrib_GetNumer(XMPZ_Object *self, void *closure)
 {
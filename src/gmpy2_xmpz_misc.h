@@ -39,9 +39,15 @@ static PyObject * GMPy_XMPZ_Pos_Slot(XMPZ_Object *x);
 static PyObject * GMPy_XMPZ_Com_Slot(XMPZ_Object *x);
 static PyObject * GMPy_XMPZ_Method_MakeMPZ(PyObject *self, PyObject *other);
 static PyObject * GMPy_XMPZ_Method_Copy(PyObject *self, PyObject *other);
+static int        GMPy_XMPZ_ParseOut(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, const char *name, PyObject **out);
+static MPZ_Object * GMPy_MPZ_NewOut(PyObject *out, CTXT_Object *context);
+static PyObject * GMPy_MPZ_SetOut(MPZ_Object *result, PyObject *out);
 static Py_ssize_t GMPy_XMPZ_Method_Length(XMPZ_Object *obj);
 static PyObject * GMPy_XMPZ_Method_SubScript(XMPZ_Object* self, PyObject* item);
 static int        GMPy_XMPZ_Method_AssignSubScript(XMPZ_Object* self, PyObject* item, PyObject* value);
+static PyObject * GMPy_XMPZ_Method_ClearProgression(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_XMPZ_Method_SetProgression(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+static PyObject * GMPy_XMPZ_Method_SieveClear(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
 
 static PyObject * GMPy_XMPZ_Attrib_GetNumer(XMPZ_Object *self, void *closure);
 static PyObject * GMPy_XMPZ_Attrib_GetDenom(XMPZ_Object *self, void *closure);
@@ -55,6 +61,9 @@ static PyObject *         GMPy_Iter_Repr(GMPy_Iter_Object *self);
 static PyObject *         GMPy_XMPZ_Method_IterBits(PyObject *self, PyObject *args, PyObject *kwargs);
 static PyObject *         GMPy_XMPZ_Method_IterSet(PyObject *self, PyObject *args, PyObject *kwargs);
 static PyObject *         GMPy_XMPZ_Method_IterClear(PyObject *self, PyObject *args, PyObject *kwargs);
+static PyObject *         GMPy_XMPZ_Method_IterSetBatched(PyObject *self, PyObject *args, PyObject *kwargs);
+static PyObject *         GMPy_XMPZ_Method_IterRuns(PyObject *self, PyObject *args, PyObject *kwargs);
+static PyObject *         GMPy_XMPZ_Method_SetPositions(PyObject *self, PyObject *args, PyObject *kwargs);
 static PyObject *         GMPy_XMPZ_Method_SizeOf(PyObject *self, PyObject *other);
 
 
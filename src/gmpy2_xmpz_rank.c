@@ -0,0 +1,222 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpz_rank.c                                                       *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* rank1() and select1() use a directory that is built on the first call
+ * and kept until the xmpz is changed. With 64-bit limbs a block holds 512
+ * bits and its count takes 16 bits, so the directory needs a little more
+ * than 3% of the size of the xmpz.
+ *
+ * rank1(i) adds the superblock and block counts to the popcount of at most
+ * RANK_BLOCK_LIMBS limbs. select1(k) starts from the sampled block of set
+ * bit k and does a binary search over the blocks up to the next sample,
+ * then scans the limbs of a single block.
+ */
+
+#define RANK_SUPER_LIMBS (RANK_BLOCK_LIMBS * RANK_SUPER_BLOCKS)
+
+static void
+GMPy_XMPZ_Rank_Clear(XMPZ_Object *self)
+{
+    struct gmpy_rank_dir *dir = self->rank;
+
+    if (dir) {
+        PyMem_Free(dir->super);
+        PyMem_Free(dir->block);
+        PyMem_Free(dir->sample);
+        PyMem_Free(dir);
+        self->rank = NULL;
+    }
+}
+
+static mp_bitcnt_t
+GMPy_Rank_Popcount(const mp_limb_t *p, mp_size_t n)
+{
+    return n > 0 ? mpn_popcount(p, n) : 0;
+}
+
+/* Return the directory for self, building it if needed. */
+
+static struct gmpy_rank_dir *
+GMPy_XMPZ_Rank_Get(XMPZ_Object *self, const char *name)
+{
+    struct gmpy_rank_dir *dir = self->rank;
+    const mp_limb_t *d = self->z->_mp_d;
+    mp_size_t size = (mp_size_t)mpz_size(self->z), b, nsuper;
+    mp_bitcnt_t count = 0, next = 0, c;
+
+    if (mpz_sgn(self->z) < 0) {
+        PyErr_Format(PyExc_ValueError, "%s() requires a non-negative xmpz", name);
+        return NULL;
+    }
+
+    /* The address and size are checked in case the limbs were changed
+     * without going through an xmpz method.
+     */
+    if (dir && dir->limbs == d && dir->size == size) {
+        return dir;
+    }
+    GMPy_XMPZ_Rank_Clear(self);
+
+    if (!(dir = PyMem_Malloc(sizeof(struct gmpy_rank_dir)))) {
+        PyErr_NoMemory(); /* LCOV_EXCL_LINE */
+        return NULL; /* LCOV_EXCL_LINE */
+    }
+    dir->limbs = d;
+    dir->size = size;
+    dir->nblocks = (size + RANK_BLOCK_LIMBS - 1) / RANK_BLOCK_LIMBS;
+    nsuper = (size + RANK_SUPER_LIMBS - 1) / RANK_SUPER_LIMBS;
+    dir->total = GMPy_Rank_Popcount(d, size);
+    dir->nsamples = (mp_size_t)((dir->total + RANK_SAMPLE - 1) / RANK_SAMPLE);
+    dir->super = PyMem_New(mp_bitcnt_t, nsuper + 1);
+    dir->block = PyMem_New(unsigned short, dir->nblocks + 1);
+    dir->sample = PyMem_New(mp_size_t, dir->nsamples + 1);
+    if (!dir->super || !dir->block || !dir->sample) {
+        /* LCOV_EXCL_START */
+        self->rank = dir;
+        GMPy_XMPZ_Rank_Clear(self);
+        PyErr_NoMemory();
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    for (b = 0; b < dir->nblocks; b++) {
+        if (b % RANK_SUPER_BLOCKS == 0) {
+            dir->super[b / RANK_SUPER_BLOCKS] = count;
+        }
+        dir->block[b] = (unsigned short)(count - dir->super[b / RANK_SUPER_BLOCKS]);
+        c = GMPy_Rank_Popcount(d + b * RANK_BLOCK_LIMBS,
+                               (b + 1 < dir->nblocks) ? RANK_BLOCK_LIMBS
+                                                      : size - b * RANK_BLOCK_LIMBS);
+        while (next < count + c) {
+            dir->sample[next / RANK_SAMPLE] = b;
+            next += RANK_SAMPLE;
+        }
+        count += c;
+    }
+
+    self->rank = dir;
+    return dir;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_rank1,
+"x.rank1(i, /) -> int\n\n"
+"Return the number of 1-bits of x at positions less than i. x must\n"
+"not be negative. The first call builds an index of x that makes\n"
+"later calls to `rank1()` and `select1()` take constant time; the\n"
+"index is discarded when x is changed.");
+
+static PyObject *
+GMPy_XMPZ_Method_Rank1(PyObject *self, PyObject *other)
+{
+    struct gmpy_rank_dir *dir;
+    mp_bitcnt_t i, r;
+    mp_size_t limb, b;
+    mp_limb_t w;
+
+    i = GMPy_Integer_AsMpBitCnt(other);
+    if (i == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        return NULL;
+    }
+
+    if (!(dir = GMPy_XMPZ_Rank_Get((XMPZ_Object*)self, "rank1"))) {
+        return NULL;
+    }
+
+    if (i >= (mp_bitcnt_t)dir->size * GMP_NUMB_BITS) {
+        return GMPy_PyLong_FromMpBitCnt(dir->total);
+    }
+
+    limb = (mp_size_t)(i / GMP_NUMB_BITS);
+    b = limb / RANK_BLOCK_LIMBS;
+    r = dir->super[b / RANK_SUPER_BLOCKS] + dir->block[b] +
+        GMPy_Rank_Popcount(dir->limbs + b * RANK_BLOCK_LIMBS, limb - b * RANK_BLOCK_LIMBS);
+    if (i % GMP_NUMB_BITS) {
+        w = dir->limbs[limb] & (((mp_limb_t)1 << (i % GMP_NUMB_BITS)) - 1);
+        r += mpn_popcount(&w, 1);
+    }
+    return GMPy_PyLong_FromMpBitCnt(r);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpz_method_select1,
+"x.select1(k, /) -> int\n\n"
+"Return the position of the 1-bit of x with index k, counting from 0\n"
+"at the least significant bit, so that x.rank1(x.select1(k)) == k.\n"
+"x must not be negative and k must be less than x.bit_count().\n"
+"Uses the same index as `rank1()`.");
+
+static PyObject *
+GMPy_XMPZ_Method_Select1(PyObject *self, PyObject *other)
+{
+    struct gmpy_rank_dir *dir;
+    mp_bitcnt_t k, c;
+    mp_size_t lo, hi, mid, j, end;
+    mp_limb_t w;
+
+    k = GMPy_Integer_AsMpBitCnt(other);
+    if (k == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        return NULL;
+    }
+
+    if (!(dir = GMPy_XMPZ_Rank_Get((XMPZ_Object*)self, "select1"))) {
+        return NULL;
+    }
+
+    if (k >= dir->total) {
+        INDEX_ERROR("select1() index out of range");
+        return NULL;
+    }
+
+    /* Find the last block that starts with fewer than k+1 set bits. */
+    lo = dir->sample[k / RANK_SAMPLE];
+    hi = (k / RANK_SAMPLE + 1 < (mp_bitcnt_t)dir->nsamples) ?
+         dir->sample[k / RANK_SAMPLE + 1] : dir->nblocks - 1;
+    while (lo < hi) {
+        mid = lo + (hi - lo + 1) / 2;
+        if (dir->super[mid / RANK_SUPER_BLOCKS] + dir->block[mid] <= k) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+    k -= dir->super[lo / RANK_SUPER_BLOCKS] + dir->block[lo];
+
+    /* Find the limb, then clear the lower set bits of that limb. */
+    end = (lo + 1) * RANK_BLOCK_LIMBS;
+    if (end > dir->size) {
+        end = dir->size;
+    }
+    for (j = lo * RANK_BLOCK_LIMBS; j < end; j++) {
+        w = dir->limbs[j];
+        c = mpn_popcount(&w, 1);
+        if (k < c) {
+            break;
+        }
+        k -= c;
+    }
+    for (; k > 0; k--) {
+        w &= w - 1;
+    }
+    return GMPy_PyLong_FromMpBitCnt((mp_bitcnt_t)j * GMP_NUMB_BITS + mpn_scan1(&w, 0));
+}
@@ -0,0 +1,72 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpz_rank.h                                                       *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP, MPFR, and MPC multiple precision           *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2008 - 2025 Case Van Horsen                                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_XMPZ_RANK_H
+#define GMPY_XMPZ_RANK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A rank/select directory for a non-negative xmpz. The limbs are grouped
+ * into blocks of RANK_BLOCK_LIMBS limbs and the blocks into superblocks of
+ * RANK_SUPER_BLOCKS blocks. super[s] is the number of set bits before
+ * superblock s and block[b] is the number of set bits before block b
+ * counted from the start of its superblock. sample[j] is the block that
+ * contains set bit number j*RANK_SAMPLE.
+ *
+ * The directory describes the limbs at the address and size that are
+ * recorded when it is built. It is discarded by XMPZ_MODIFIED() whenever
+ * the value of the xmpz is changed.
+ */
+
+#define RANK_BLOCK_LIMBS 8
+#define RANK_SUPER_BLOCKS 128
+#define RANK_SAMPLE 8192
+
+struct gmpy_rank_dir {
+    const mp_limb_t *limbs;
+    mp_size_t size;
+    mp_size_t nblocks;
+    mp_size_t nsamples;
+    mp_bitcnt_t total;
+    mp_bitcnt_t *super;
+    unsigned short *block;
+    mp_size_t *sample;
+};
+
+static void       GMPy_XMPZ_Rank_Clear(XMPZ_Object *self);
+static PyObject * GMPy_XMPZ_Method_Rank1(PyObject *self, PyObject *other);
+static PyObject * GMPy_XMPZ_Method_Select1(PyObject *self, PyObject *other);
+
+#define XMPZ_MODIFIED(obj) \
+    do { \
+        if (((XMPZ_Object*)(obj))->rank) \
+            GMPy_XMPZ_Rank_Clear((XMPZ_Object*)(obj)); \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+#endif
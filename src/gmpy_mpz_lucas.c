@@ -664,3 +664,610 @@ GMPY_mpz_lucasv_mod(PyObject *self, PyObject *args)
 
     return (PyObject*)result;
 }
+
+/* The functions below evaluate U[k] and V[k] together. They use a ladder
+ * that tracks the state (U[h], U[h+1], V[h], V[h+1], q^h) while the bits of
+ * k are consumed from the most significant end:
+ *
+ *   bit 0:  U[2h]   = U[h]*V[h]
+ *           U[2h+1] = U[h+1]*V[h] - q^h
+ *           V[2h]   = V[h]^2 - 2*q^h
+ *           V[2h+1] = V[h]*V[h+1] - p*q^h
+ *   bit 1:  U[2h+1] = U[h+1]*V[h] - q^h
+ *           U[2h+2] = U[h+1]*V[h+1]
+ *           V[2h+1] = V[h]*V[h+1] - p*q^h
+ *           V[2h+2] = V[h+1]^2 - 2*q^(h+1)
+ *
+ * After consuming the leading d bits of k the state describes h = k >> (len-d).
+ * Indices that share a binary prefix therefore share the ladder for that
+ * prefix, which lucasuv_mod_list() exploits.
+ */
+
+typedef struct {
+    mpz_t u0;       /* U[h]   */
+    mpz_t u1;       /* U[h+1] */
+    mpz_t v0;       /* V[h]   */
+    mpz_t v1;       /* V[h+1] */
+    mpz_t qh;       /* q^h    */
+} lucas_state;
+
+static void
+lucas_state_init(lucas_state *st)
+{
+    mpz_init(st->u0);
+    mpz_init(st->u1);
+    mpz_init(st->v0);
+    mpz_init(st->v1);
+    mpz_init(st->qh);
+}
+
+static void
+lucas_state_clear(lucas_state *st)
+{
+    mpz_clear(st->u0);
+    mpz_clear(st->u1);
+    mpz_clear(st->v0);
+    mpz_clear(st->v1);
+    mpz_clear(st->qh);
+}
+
+static void
+lucas_state_start(lucas_state *st, mpz_t p)
+{
+    mpz_set_ui(st->u0, 0);
+    mpz_set_ui(st->u1, 1);
+    mpz_set_ui(st->v0, 2);
+    mpz_set(st->v1, p);
+    mpz_set_ui(st->qh, 1);
+}
+
+static void
+lucas_state_copy(lucas_state *dst, lucas_state *src)
+{
+    mpz_set(dst->u0, src->u0);
+    mpz_set(dst->u1, src->u1);
+    mpz_set(dst->v0, src->v0);
+    mpz_set(dst->v1, src->v1);
+    mpz_set(dst->qh, src->qh);
+}
+
+/* Reduce p and q modulo n into pp and qq and start the ladder at h = 0. */
+
+static void
+lucas_state_start_mod(lucas_state *st, mpz_t pp, mpz_t qq,
+                      mpz_t p, mpz_t q, mpz_t n)
+{
+    mpz_mod(pp, p, n);
+    mpz_mod(qq, q, n);
+    lucas_state_start(st, pp);
+    mpz_mod(st->u1, st->u1, n);
+    mpz_mod(st->v0, st->v0, n);
+    mpz_mod(st->qh, st->qh, n);
+}
+
+/* Advance the ladder from depth 'from' to depth 'to', i.e. consume bits
+ * (len-1-from) down to (len-to) of k where len is the bit length of k. If n
+ * is not NULL, all values are reduced modulo n after every step. tmp is
+ * scratch space.
+ */
+
+static void
+lucas_state_walk(lucas_state *st, mpz_t p, mpz_t q, mpz_t k, size_t len,
+                 size_t from, size_t to, mpz_ptr n, mpz_t tmp)
+{
+    size_t d;
+
+    for (d = from; d < to; d++) {
+        if (mpz_tstbit(k, len - 1 - d)) {
+            /* u0 = U[2h+1], u1 = U[2h+2] */
+            mpz_mul(st->u0, st->u1, st->v0);
+            mpz_sub(st->u0, st->u0, st->qh);
+            mpz_mul(st->u1, st->u1, st->v1);
+
+            /* v0 = V[2h+1], v1 = V[2h+2], qh = q^(2h+1) */
+            mpz_mul(st->v0, st->v0, st->v1);
+            mpz_submul(st->v0, p, st->qh);
+            mpz_mul(tmp, st->qh, q);
+            mpz_mul(st->v1, st->v1, st->v1);
+            mpz_submul_ui(st->v1, tmp, 2);
+            mpz_mul(st->qh, st->qh, tmp);
+        }
+        else {
+            /* u1 = U[2h+1], u0 = U[2h] */
+            mpz_mul(st->u1, st->u1, st->v0);
+            mpz_sub(st->u1, st->u1, st->qh);
+            mpz_mul(st->u0, st->u0, st->v0);
+
+            /* v1 = V[2h+1], v0 = V[2h], qh = q^(2h) */
+            mpz_mul(st->v1, st->v1, st->v0);
+            mpz_submul(st->v1, p, st->qh);
+            mpz_mul(st->v0, st->v0, st->v0);
+            mpz_submul_ui(st->v0, st->qh, 2);
+            mpz_mul(st->qh, st->qh, st->qh);
+        }
+        if (n) {
+            mpz_mod(st->u0, st->u0, n);
+            mpz_mod(st->u1, st->u1, n);
+            mpz_mod(st->v0, st->v0, n);
+            mpz_mod(st->v1, st->v1, n);
+            mpz_mod(st->qh, st->qh, n);
+        }
+    }
+}
+
+/* Return the number of bits in k, using 0 for k == 0. */
+
+static size_t
+lucas_bit_length(mpz_t k)
+{
+    return mpz_sgn(k) ? mpz_sizeinbase(k, 2) : 0;
+}
+
+/* Validate p, q, k, and n for the lucasuv functions. n may be NULL. */
+
+static int
+lucas_check_args(mpz_t p, mpz_t q, mpz_t k, mpz_ptr n, const char *name)
+{
+    mpz_t tmp;
+    int bad;
+
+    mpz_init(tmp);
+    mpz_mul(tmp, p, p);
+    mpz_submul_ui(tmp, q, 4);
+    bad = (mpz_sgn(tmp) == 0);
+    mpz_clear(tmp);
+
+    if (bad) {
+        PyErr_Format(PyExc_ValueError, "invalid values for p,q in %s()", name);
+        return 0;
+    }
+
+    if (k && mpz_sgn(k) < 0) {
+        PyErr_Format(PyExc_ValueError, "invalid value for k in %s()", name);
+        return 0;
+    }
+
+    if (n && mpz_sgn(n) <= 0) {
+        PyErr_Format(PyExc_ValueError, "invalid value for n in %s()", name);
+        return 0;
+    }
+    return 1;
+}
+
+/* Build the (U, V) result tuple from the current ladder state. */
+
+static PyObject *
+lucas_state_result(lucas_state *st)
+{
+    MPZ_Object *u = NULL, *v = NULL;
+    PyObject *result = NULL;
+
+    if (!(u = GMPy_MPZ_New(NULL)) ||
+        !(v = GMPy_MPZ_New(NULL))) {
+        Py_XDECREF((PyObject*)u);
+        return NULL;
+    }
+    mpz_set(u->z, st->u0);
+    mpz_set(v->z, st->v0);
+
+    if (!(result = PyTuple_Pack(2, (PyObject*)u, (PyObject*)v))) {
+        Py_DECREF((PyObject*)u);
+        Py_DECREF((PyObject*)v);
+        return NULL;
+    }
+    Py_DECREF((PyObject*)u);
+    Py_DECREF((PyObject*)v);
+    return result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasuv,
+"lucasuv(p,q,k,/) -> tuple[mpz, mpz]\n\n"
+"Return the k-th elements of the Lucas U and V sequences defined by p,q\n"
+"as a tuple (U, V). Both values are computed by a single ladder.\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0.");
+
+static PyObject *
+GMPY_mpz_lucasuv(PyObject *self, PyObject *args)
+{
+    MPZ_Object *p = NULL, *q = NULL, *k = NULL;
+    PyObject *result = NULL;
+    lucas_state st;
+    size_t len;
+    mpz_t tmp;
+
+    if (PyTuple_Size(args) != 3) {
+        TYPE_ERROR("lucasuv() requires 3 integer arguments");
+        return NULL;
+    }
+
+    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
+    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
+    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
+    if (!p || !q || !k) {
+        TYPE_ERROR("lucasuv() requires 3 integer arguments");
+        goto cleanup;
+    }
+
+    if (!lucas_check_args(p->z, q->z, k->z, NULL, "lucasuv"))
+        goto cleanup;
+
+    lucas_state_init(&st);
+    mpz_init(tmp);
+    lucas_state_start(&st, p->z);
+    len = lucas_bit_length(k->z);
+    lucas_state_walk(&st, p->z, q->z, k->z, len, 0, len, NULL, tmp);
+    result = lucas_state_result(&st);
+    lucas_state_clear(&st);
+    mpz_clear(tmp);
+
+  cleanup:
+    Py_XDECREF((PyObject*)p);
+    Py_XDECREF((PyObject*)q);
+    Py_XDECREF((PyObject*)k);
+    return result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasuv_mod,
+"lucasuv_mod(p,q,k,n,/) -> tuple[mpz, mpz]\n\n"
+"Return the k-th elements of the Lucas U and V sequences defined by p,q\n"
+"(mod n) as a tuple (U, V). Both values are computed by a single ladder.\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0;\n"
+"n must be greater than 0.");
+
+static PyObject *
+GMPY_mpz_lucasuv_mod(PyObject *self, PyObject *args)
+{
+    MPZ_Object *p = NULL, *q = NULL, *k = NULL, *n = NULL;
+    PyObject *result = NULL;
+    lucas_state st;
+    size_t len;
+    mpz_t pp, qq, tmp;
+
+    if (PyTuple_Size(args) != 4) {
+        TYPE_ERROR("lucasuv_mod() requires 4 integer arguments");
+        return NULL;
+    }
+
+    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
+    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
+    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
+    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 3), NULL);
+    if (!p || !q || !k || !n) {
+        TYPE_ERROR("lucasuv_mod() requires 4 integer arguments");
+        goto cleanup;
+    }
+
+    if (!lucas_check_args(p->z, q->z, k->z, n->z, "lucasuv_mod"))
+        goto cleanup;
+
+    lucas_state_init(&st);
+    mpz_init(pp);
+    mpz_init(qq);
+    mpz_init(tmp);
+    lucas_state_start_mod(&st, pp, qq, p->z, q->z, n->z);
+    len = lucas_bit_length(k->z);
+    lucas_state_walk(&st, pp, qq, k->z, len, 0, len, n->z, tmp);
+    result = lucas_state_result(&st);
+    lucas_state_clear(&st);
+    mpz_clear(pp);
+    mpz_clear(qq);
+    mpz_clear(tmp);
+
+  cleanup:
+    Py_XDECREF((PyObject*)p);
+    Py_XDECREF((PyObject*)q);
+    Py_XDECREF((PyObject*)k);
+    Py_XDECREF((PyObject*)n);
+    return result;
+}
+
+/* Support for lucasuv_mod_list(). The indices are visited in lexicographic
+ * order of their binary representations so that each index only walks the
+ * bits following the prefix it shares with its predecessor. The state at
+ * that depth is saved (once) by the earlier index that walked through it.
+ */
+
+typedef struct {
+    mpz_ptr k;          /* index                                  */
+    size_t len;         /* number of bits in k                    */
+    size_t resume;      /* depth shared with the previous index   */
+    Py_ssize_t pos;     /* position in the argument sequence      */
+    Py_ssize_t owner;   /* sorted index that saves the resume state */
+} lucas_index;
+
+static int
+lucas_index_cmp(const void *a, const void *b)
+{
+    const lucas_index *x = (const lucas_index*)a, *y = (const lucas_index*)b;
+    size_t d, len = (x->len < y->len) ? x->len : y->len;
+    int bx, by;
+
+    for (d = 0; d < len; d++) {
+        bx = mpz_tstbit(x->k, x->len - 1 - d);
+        by = mpz_tstbit(y->k, y->len - 1 - d);
+        if (bx != by)
+            return bx - by;
+    }
+    if (x->len != y->len)
+        return (x->len < y->len) ? -1 : 1;
+    return (x->pos < y->pos) ? -1 : (x->pos > y->pos);
+}
+
+static size_t
+lucas_index_lcp(lucas_index *x, lucas_index *y)
+{
+    size_t d, len = (x->len < y->len) ? x->len : y->len;
+
+    for (d = 0; d < len; d++) {
+        if (mpz_tstbit(x->k, x->len - 1 - d) != mpz_tstbit(y->k, y->len - 1 - d))
+            break;
+    }
+    return d;
+}
+
+/* Order saved states by (owner, resume) so each owner can emit them while it
+ * walks down its bits.
+ */
+
+static int
+lucas_request_cmp(const void *a, const void *b)
+{
+    const lucas_index *x = *(const lucas_index* const*)a;
+    const lucas_index *y = *(const lucas_index* const*)b;
+
+    if (x->owner != y->owner)
+        return (x->owner < y->owner) ? -1 : 1;
+    if (x->resume != y->resume)
+        return (x->resume < y->resume) ? -1 : 1;
+    return 0;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasuv_mod_list,
+"lucasuv_mod_list(p,q,k_lst,n,/) -> list[tuple[mpz, mpz], ...]\n\n"
+"Returns [lucasuv_mod(p,q,k,n) for k in k_lst]. The arguments p, q, and n\n"
+"are validated and reduced once and indices that share a binary prefix\n"
+"(for example k, 2*k, and 2*k+1) share the ladder steps for that prefix.\n"
+"Will always release the GIL.");
+
+static PyObject *
+GMPY_mpz_lucasuv_mod_list(PyObject *self, PyObject *args)
+{
+    MPZ_Object *p = NULL, *q = NULL, *n = NULL;
+    MPZ_Object **ks = NULL, **us = NULL, **vs = NULL;
+    PyObject *seq = NULL, *result = NULL, *tuple;
+    lucas_index *idx = NULL, **req = NULL;
+    lucas_state *saved = NULL;
+    Py_ssize_t i, j, m = 0, nreq = 0, *stack = NULL, top;
+    lucas_state st;
+    mpz_t pp, qq, tmp;
+
+    if (PyTuple_Size(args) != 4) {
+        TYPE_ERROR("lucasuv_mod_list() requires 4 arguments");
+        return NULL;
+    }
+
+    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
+    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
+    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 3), NULL);
+    if (!p || !q || !n) {
+        TYPE_ERROR("lucasuv_mod_list() requires integer arguments for p, q, and n");
+        goto cleanup;
+    }
+
+    if (!lucas_check_args(p->z, q->z, NULL, n->z, "lucasuv_mod_list"))
+        goto cleanup;
+
+    if (!(seq = PySequence_Fast(PyTuple_GET_ITEM(args, 2), "argument must be an iterable")))
+        goto cleanup;
+
+    m = PySequence_Fast_GET_SIZE(seq);
+    if (!(ks = PyMem_Calloc(m + 1, sizeof(MPZ_Object*))) ||
+        !(us = PyMem_Calloc(m + 1, sizeof(MPZ_Object*))) ||
+        !(vs = PyMem_Calloc(m + 1, sizeof(MPZ_Object*))) ||
+        !(idx = PyMem_Calloc(m + 1, sizeof(lucas_index))) ||
+        !(req = PyMem_Calloc(m + 1, sizeof(lucas_index*))) ||
+        !(stack = PyMem_Calloc(m + 1, sizeof(Py_ssize_t))) ||
+        !(saved = PyMem_Calloc(m + 1, sizeof(lucas_state)))) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    for (i = 0; i < m; i++) {
+        if (!(ks[i] = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            TYPE_ERROR("all items in iterable must be integers");
+            goto cleanup;
+        }
+        if (mpz_sgn(ks[i]->z) < 0) {
+            VALUE_ERROR("invalid value for k in lucasuv_mod_list()");
+            goto cleanup;
+        }
+        if (!(us[i] = GMPy_MPZ_New(NULL)) || !(vs[i] = GMPy_MPZ_New(NULL)))
+            goto cleanup;
+        idx[i].k = ks[i]->z;
+        idx[i].len = lucas_bit_length(ks[i]->z);
+        idx[i].pos = i;
+    }
+
+    qsort(idx, m, sizeof(lucas_index), lucas_index_cmp);
+
+    /* The state needed by idx[i] (at depth resume) is saved by the closest
+     * earlier index whose own resume depth is smaller. A resume depth of 0
+     * means the ladder is simply restarted.
+     */
+
+    top = 0;
+    for (i = 0; i < m; i++) {
+        idx[i].resume = i ? lucas_index_lcp(&idx[i-1], &idx[i]) : 0;
+        while (top > 0 && idx[stack[top-1]].resume >= idx[i].resume)
+            top--;
+        idx[i].owner = top ? stack[top-1] : 0;
+        stack[top++] = i;
+        if (idx[i].resume > 0)
+            req[nreq++] = &idx[i];
+    }
+    qsort(req, nreq, sizeof(lucas_index*), lucas_request_cmp);
+    for (j = 0; j < nreq; j++)
+        lucas_state_init(&saved[req[j] - idx]);
+
+    lucas_state_init(&st);
+    mpz_init(pp);
+    mpz_init(qq);
+    mpz_init(tmp);
+
+    Py_BEGIN_ALLOW_THREADS;
+    j = 0;
+    for (i = 0; i < m; i++) {
+        size_t d;
+
+        if (idx[i].resume == 0)
+            lucas_state_start_mod(&st, pp, qq, p->z, q->z, n->z);
+        else
+            lucas_state_copy(&st, &saved[i]);
+
+        d = idx[i].resume;
+        while (j < nreq && req[j]->owner == i) {
+            lucas_state_walk(&st, pp, qq, idx[i].k, idx[i].len, d, req[j]->resume,
+                             n->z, tmp);
+            d = req[j]->resume;
+            lucas_state_copy(&saved[req[j] - idx], &st);
+            j++;
+        }
+        lucas_state_walk(&st, pp, qq, idx[i].k, idx[i].len, d, idx[i].len, n->z, tmp);
+
+        mpz_set(us[idx[i].pos]->z, st.u0);
+        mpz_set(vs[idx[i].pos]->z, st.v0);
+    }
+    Py_END_ALLOW_THREADS;
+
+    lucas_state_clear(&st);
+    mpz_clear(pp);
+    mpz_clear(qq);
+    mpz_clear(tmp);
+    for (j = 0; j < nreq; j++)
+        lucas_state_clear(&saved[req[j] - idx]);
+
+    if (!(result = PyList_New(m)))
+        goto cleanup;
+
+    for (i = 0; i < m; i++) {
+        if (!(tuple = PyTuple_Pack(2, (PyObject*)us[i], (PyObject*)vs[i]))) {
+            Py_CLEAR(result);
+            goto cleanup;
+        }
+        PyList_SET_ITEM(result, i, tuple);
+    }
+
+  cleanup:
+    if (ks && us && vs) {
+        for (i = 0; i < m; i++) {
+            Py_XDECREF((PyObject*)ks[i]);
+            Py_XDECREF((PyObject*)us[i]);
+            Py_XDECREF((PyObject*)vs[i]);
+        }
+    }
+    PyMem_Free(ks);
+    PyMem_Free(us);
+    PyMem_Free(vs);
+    PyMem_Free(idx);
+    PyMem_Free(req);
+    PyMem_Free(stack);
+    PyMem_Free(saved);
+    Py_XDECREF(seq);
+    Py_XDECREF((PyObject*)p);
+    Py_XDECREF((PyObject*)q);
+    Py_XDECREF((PyObject*)n);
+    return result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasuv_mod_batch,
+"lucasuv_mod_batch(lst,/) -> list[tuple[mpz, mpz], ...]\n\n"
+"Returns [lucasuv_mod(p,q,k,n) for p,q,k,n in lst]. All arguments are\n"
+"validated before any sequence is evaluated. Will always release the GIL.");
+
+static PyObject *
+GMPY_mpz_lucasuv_mod_batch(PyObject *self, PyObject *other)
+{
+    MPZ_Object **args = NULL, **us = NULL, **vs = NULL;
+    PyObject *seq = NULL, *item, *result = NULL, *tuple;
+    Py_ssize_t i, j, m = 0;
+    lucas_state st;
+    size_t len;
+    mpz_t pp, qq, tmp;
+
+    if (!(seq = PySequence_Fast(other, "argument must be an iterable")))
+        return NULL;
+
+    m = PySequence_Fast_GET_SIZE(seq);
+    if (!(args = PyMem_Calloc(4 * m + 1, sizeof(MPZ_Object*))) ||
+        !(us = PyMem_Calloc(m + 1, sizeof(MPZ_Object*))) ||
+        !(vs = PyMem_Calloc(m + 1, sizeof(MPZ_Object*)))) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    for (i = 0; i < m; i++) {
+        item = PySequence_Fast_GET_ITEM(seq, i);
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 4) {
+            TYPE_ERROR("lucasuv_mod_batch() requires a sequence of (p,q,k,n) tuples");
+            goto cleanup;
+        }
+        for (j = 0; j < 4; j++) {
+            if (!(args[4*i+j] = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(item, j), NULL))) {
+                TYPE_ERROR("lucasuv_mod_batch() requires a sequence of (p,q,k,n) tuples");
+                goto cleanup;
+            }
+        }
+        if (!lucas_check_args(args[4*i]->z, args[4*i+1]->z, args[4*i+2]->z,
+                              args[4*i+3]->z, "lucasuv_mod_batch"))
+            goto cleanup;
+        if (!(us[i] = GMPy_MPZ_New(NULL)) || !(vs[i] = GMPy_MPZ_New(NULL)))
+            goto cleanup;
+    }
+
+    lucas_state_init(&st);
+    mpz_init(pp);
+    mpz_init(qq);
+    mpz_init(tmp);
+
+    Py_BEGIN_ALLOW_THREADS;
+    for (i = 0; i < m; i++) {
+        lucas_state_start_mod(&st, pp, qq, args[4*i]->z, args[4*i+1]->z, args[4*i+3]->z);
+        len = lucas_bit_length(args[4*i+2]->z);
+        lucas_state_walk(&st, pp, qq, args[4*i+2]->z, len, 0, len,
+                         args[4*i+3]->z, tmp);
+        mpz_set(us[i]->z, st.u0);
+        mpz_set(vs[i]->z, st.v0);
+    }
+    Py_END_ALLOW_THREADS;
+
+    lucas_state_clear(&st);
+    mpz_clear(pp);
+    mpz_clear(qq);
+    mpz_clear(tmp);
+
+    if (!(result = PyList_New(m)))
+        goto cleanup;
+
+    for (i = 0; i < m; i++) {
+        if (!(tuple = PyTuple_Pack(2, (PyObject*)us[i], (PyObject*)vs[i]))) {
+            Py_CLEAR(result);
+            goto cleanup;
+        }
+        PyList_SET_ITEM(result, i, tuple);
+    }
+
+  cleanup:
+    if (args && us && vs) {
+        for (i = 0; i < m; i++) {
+            for (j = 0; j < 4; j++)
+                Py_XDECREF((PyObject*)args[4*i+j]);
+            Py_XDECREF((PyObject*)us[i]);
+            Py_XDECREF((PyObject*)vs[i]);
+        }
+    }
+    PyMem_Free(args);
+    PyMem_Free(us);
+    PyMem_Free(vs);
+    Py_DECREF(seq);
+    return result;
+}
@@ -33,6 +33,10 @@ static PyObject * GMPY_mpz_lucasu(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_lucasu_mod(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_lucasv(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_lucasv_mod(PyObject *self, PyObject *args);
+static PyObject * GMPY_mpz_lucasuv(PyObject *self, PyObject *args);
+static PyObject * GMPY_mpz_lucasuv_mod(PyObject *self, PyObject *args);
+static PyObject * GMPY_mpz_lucasuv_mod_list(PyObject *self, PyObject *args);
+static PyObject * GMPY_mpz_lucasuv_mod_batch(PyObject *self, PyObject *other);
 
 #ifdef __cplusplus
 }
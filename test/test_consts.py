@@ -1,7 +1,8 @@
 import pytest
 
 import gmpy2
-from gmpy2 import const_catalan, const_euler, const_log2, const_pi, mpfr
+from gmpy2 import (const_catalan, const_euler, const_log2, const_pi, constant,
+                   mpfr)
 
 
 def test_pi():
@@ -62,3 +63,81 @@ def test_euler():
     pytest.raises(TypeError, lambda: gmpy2.ieee(32).const_euler(100))
 
     assert gmpy2.ieee(128).const_euler() == mpfr('0.577215664901532860606512090082402471',113)
+
+
+def test_constant():
+    for name, f in [('pi', const_pi), ('euler', const_euler),
+                    ('log2', const_log2), ('catalan', const_catalan)]:
+        gmpy2.free_cache()
+        expected = [(f(prec), f(prec).rc) for prec in (10, 300, 20, 2)]
+        gmpy2.free_cache()
+        assert constant(name, 300) == f(300)
+        for prec, (value, rc) in zip((10, 300, 20, 2), expected):
+            r = constant(name, precision=prec)
+            assert (r, r.rc) == (value, rc)
+            assert r.precision == prec
+
+    with gmpy2.context(round=gmpy2.RoundUp, precision=24) as ctx:
+        assert ctx.constant('pi') == mpfr('3.14159274',24)
+        assert ctx.constant('pi').rc == 1
+
+    pytest.raises(ValueError, lambda: constant('unknown'))
+    pytest.raises(TypeError, lambda: constant(1))
+    pytest.raises(TypeError, lambda: constant())
+
+
+def test_register_constant():
+    calls = []
+
+    def zeta3(prec):
+        calls.append(prec)
+        with gmpy2.context(precision=prec):
+            return gmpy2.zeta(3)
+
+    gmpy2.register_constant('zeta3', zeta3)
+    assert constant('zeta3') == mpfr('1.2020569031595942')
+    assert constant('zeta3', 20) == mpfr('1.2020569',20)
+    assert len(calls) == 1
+    assert constant('zeta3', 100) == mpfr('1.2020569031595942853997381615111',100)
+    assert len(calls) == 2
+    assert gmpy2.ieee(32).constant('zeta3') == mpfr('1.20205688',24)
+    assert len(calls) == 2
+    gmpy2.free_cache()
+    assert constant('zeta3') == mpfr('1.2020569031595942')
+    assert len(calls) == 3
+
+    gmpy2.register_constant('zeta3', lambda prec: mpfr(1.25))
+    assert constant('zeta3') == 1.25
+
+    gmpy2.register_constant('bad', lambda prec: 'a')
+    pytest.raises(TypeError, lambda: constant('bad'))
+    pytest.raises(ValueError, lambda: gmpy2.register_constant('pi', zeta3))
+    pytest.raises(TypeError, lambda: gmpy2.register_constant('x', 1))
+    pytest.raises(TypeError, lambda: gmpy2.register_constant(1, zeta3))
+
+
+def test_constant_cache_threads():
+    import threading
+
+    def worker(out):
+        out.append(const_pi(1000) == mpfr(const_pi(2000), 1000))
+        out.append(constant('half') == 0.5)
+
+    gmpy2.register_constant('half', lambda prec: mpfr(0.5))
+    out = []
+    threads = [threading.Thread(target=worker, args=(out,)) for _ in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert out == [True] * 16
+
+    def reenter(prec):
+        gmpy2.free_cache()
+        return mpfr(0.25)
+
+    gmpy2.register_constant('quarter', reenter)
+    assert constant('quarter') == 0.25
+    gmpy2.free_cache()
+    gmpy2.free_cache()
+    assert const_pi() == mpfr('3.1415926535897931')
@@ -8,18 +8,18 @@ from gmpy2 import (acos, acosh, asin, asinh, atan, atan2, atanh, bincoef,
                    c_div, c_div_2exp, c_divmod, c_divmod_2exp, c_mod,
                    c_mod_2exp, can_round, check_range, comb, context,
                    copy_sign, cos, cosh, cot, coth, csc, csch, degrees,
-                   divexact, divm, double_fac, f2q, f_div, f_div_2exp,
-                   f_divmod, f_divmod_2exp, f_mod, f_mod_2exp, fac, fib, fib2,
-                   fma, fmma, fmms, fms, free_cache, from_binary, gcd, gcdext,
-                   get_context, get_emax_max, get_emin_min, get_exp, ieee, inf,
-                   invert, iroot, iroot_rem, is_bpsw_prp, is_euler_prp,
-                   is_extra_strong_lucas_prp, is_fermat_prp, is_fibonacci_prp,
-                   is_finite, is_infinite, is_integer, is_lessgreater,
-                   is_lucas_prp, is_nan, is_regular, is_selfridge_prp,
-                   is_signed, is_strong_bpsw_prp, is_strong_lucas_prp,
-                   is_strong_prp, is_strong_selfridge_prp, is_unordered,
-                   is_zero, isqrt, isqrt_rem, jacobi, kronecker, lcm, legendre,
-                   lucas, lucas2, maxnum, minnum, mpc, mpfr,
+                   divexact, divm, double_fac, evaluate_to, f2q, f_div,
+                   f_div_2exp, f_divmod, f_divmod_2exp, f_mod, f_mod_2exp, fac,
+                   fib, fib2, fma, fmma, fmms, fms, free_cache, from_binary,
+                   gcd, gcdext, get_context, get_emax_max, get_emin_min,
+                   get_exp, ieee, inf, invert, iroot, iroot_rem, is_bpsw_prp,
+                   is_euler_prp, is_extra_strong_lucas_prp, is_fermat_prp,
+                   is_fibonacci_prp, is_finite, is_infinite, is_integer,
+                   is_lessgreater, is_lucas_prp, is_nan, is_regular,
+                   is_selfridge_prp, is_signed, is_strong_bpsw_prp,
+                   is_strong_lucas_prp, is_strong_prp, is_strong_selfridge_prp,
+                   is_unordered, is_zero, isqrt, isqrt_rem, jacobi, kronecker,
+                   lcm, legendre, lucas, lucas2, maxnum, minnum, mpc, mpfr,
                    mpfr_from_old_binary, mpq, mpq_from_old_binary, mpz,
                    mpz_from_old_binary, multi_fac, nan, next_prime, norm,
                    phase, polar, powmod, powmod_sec, primorial, proj, radians,
@@ -274,6 +274,76 @@ def test_can_round():
     assert not can_round(x, 10, 1, 1, 10)
 
 
+def test_evaluate_to():
+    assert evaluate_to('sin', 53, 1) == sin(1)
+    assert evaluate_to(gmpy2.exp, 100, 1) == context(precision=100).exp(1)
+    assert evaluate_to('add', 0, 1, 2) == mpfr(3)
+
+    for rnd in range(5):
+        ctx = context(precision=30, round=rnd)
+        for x in (mpfr('0.3'), mpfr(7), mpfr('1e-30')):
+            r1, r2 = ctx.evaluate_to('expm1', 30, x), ctx.expm1(x)
+            assert r1 == r2 and r1.rc == r2.rc
+            r1 = ctx.evaluate_to(('sub', ('exp', x), 1), 30)
+            assert r1 == r2 and r1.rc == r2.rc
+
+    with context(round=gmpy2.RoundUp):
+        r = evaluate_to(('add', 1, ('exp', -200)), 53)
+        assert r == 1 + mpfr(2)**-52 and r.rc == 1
+    r = evaluate_to(('add', 1, ('exp', -200)), 53)
+    assert r == 1 and r.rc == -1
+    r = evaluate_to(('add', mpq(1,2), ('mul', 3, 5)), 53)
+    assert r == mpfr('15.5') and r.rc == 0
+    r = evaluate_to(('abs', ('sub', mpq(1,3), 1)), 24)
+    assert r == context(precision=24).div(2, 3) and r.rc == 1
+    assert evaluate_to(('rint', 2.5), 53) == 2
+    with context(round=gmpy2.RoundDown):
+        assert is_signed(evaluate_to(('sub', 1, 1), 53))
+    for rnd in range(5):
+        ctx = context(precision=20, round=rnd)
+        for e, v in [(('cos', mpq(1,3)), ctx.cos(mpfr(mpq(1,3), 200))),
+                     (('tan', ('div', 355, 113)), ctx.tan(mpfr(mpq(355,113), 200))),
+                     (('pow', mpq(2,3), mpq(1,7)), ctx.pow(mpfr(mpq(2,3), 200), mpfr(mpq(1,7), 200))),
+                     (('atan2', mpq(1,3), Fraction(-1,7)), ctx.atan2(mpfr(mpq(1,3), 200), mpfr(mpq(-1,7), 200)))]:
+            r = ctx.evaluate_to(e, 20)
+            assert r == v and r.rc == v.rc
+
+    # A value that is exact but cannot be proven so is not accepted.
+    pytest.raises(ValueError, lambda: evaluate_to(('mul', mpq(1,3), 3), 53))
+    pytest.raises(ValueError, lambda: evaluate_to(('mul', Fraction(1,3), 3), 53))
+    pytest.raises(ValueError, lambda: evaluate_to(('gamma', mpq(1,3)), 53))
+    assert evaluate_to(('gamma', ('add', 1, mpq(1,2))), 53) == gmpy2.gamma(mpfr('1.5'))
+    assert evaluate_to(('sub', ('exp', mpfr('1e-500')), 1), 53) == mpfr('1e-500')
+    assert evaluate_to(('div', 1, 0), 53) == inf()
+    assert is_nan(evaluate_to(('sqrt', -1), 53))
+    assert is_nan(evaluate_to(('add', ('sqrt', -1), ('exp', mpq(1,3))), 53))
+    assert evaluate_to(('hypot', 0, ('exp', mpq(1,3))), 53) == gmpy2.exp(mpq(1,3))
+    assert evaluate_to(('atan2', 0, ('exp', mpq(1,3))), 53) == 0
+    with context() as ctx:
+        assert evaluate_to(('exp', 1e10), 53) == inf() and ctx.overflow
+        assert evaluate_to(('neg', ('add', ('exp', 1e10), 1)), 53) == -inf()
+    with context(round=gmpy2.RoundDown) as ctx:
+        r = evaluate_to(('exp', 1e10), 53)
+        assert r == ctx.exp(1e10) and is_finite(r) and ctx.overflow
+    with context(trap_overflow=True):
+        pytest.raises(gmpy2.OverflowResultError, lambda: evaluate_to(('exp', 1e10), 53))
+
+    pytest.raises(ValueError,
+                  lambda: evaluate_to(('sub', ('sin', 1), ('sin', 1)), 53))
+    pytest.raises(ValueError,
+                  lambda: evaluate_to(('sub', ('exp', mpfr('1e-500')), 1), 53,
+                                      max_precision=100))
+    pytest.raises(ValueError, lambda: evaluate_to('sin', 53, 1, max_precision=10))
+    pytest.raises(ValueError, lambda: evaluate_to('sin', -1, 1))
+    pytest.raises(ValueError, lambda: evaluate_to('spam', 53, 1))
+    pytest.raises(TypeError, lambda: evaluate_to('sin', 53))
+    pytest.raises(TypeError, lambda: evaluate_to('sin', 53, 1, 2))
+    pytest.raises(TypeError, lambda: evaluate_to('sin', 53, 1j))
+    pytest.raises(TypeError, lambda: evaluate_to(('sin', 1), 53, 2))
+    pytest.raises(TypeError, lambda: evaluate_to(('sin',), 53))
+    pytest.raises(TypeError, lambda: evaluate_to(len, 53, 1))
+
+
 def test_powmod():
     z1, z2 = mpz(5), mpz(2)
     q = mpq(2,3)
@@ -987,6 +1057,104 @@ def test_sin_cos():
     assert sin_cos(r) == (sin(r), cos(r))
 
 
+def test_fused_special():
+    for v in [mpfr('0.25'), mpfr(-3), mpfr(5.6), -0.75, 2, mpq(1,3),
+              mpfr(0), mpfr('-0.0'), inf(), inf(-1), nan(), mpfr('1e-20')]:
+        for mode in [gmpy2.RoundToNearest, gmpy2.RoundUp, gmpy2.RoundDown]:
+            with context(precision=30, round=mode):
+                for fused, funcs in [(gmpy2.exp_expm1, [gmpy2.exp, gmpy2.expm1]),
+                                     (gmpy2.log_log1p, [gmpy2.log, gmpy2.log1p]),
+                                     (gmpy2.erf_erfc, [gmpy2.erf, gmpy2.erfc]),
+                                     (gmpy2.gamma_lgamma,
+                                      [gmpy2.gamma, lambda x: gmpy2.lgamma(x)[0]]),
+                                     (gmpy2.j0_j1_y0_y1, [gmpy2.j0, gmpy2.j1,
+                                                          gmpy2.y0, gmpy2.y1])]:
+                    res = fused(v)
+                    assert type(res) is tuple and len(res) == len(funcs)
+                    for r, f in zip(res, funcs):
+                        e = f(v)
+                        assert (r.is_nan() and e.is_nan()) or (r == e and r.rc == e.rc)
+
+    assert gmpy2.exp_expm1(1) == (mpfr('2.7182818284590451'), mpfr('1.7182818284590453'))
+    assert gmpy2.erf_erfc(mpfr(4)) == (mpfr('0.99999998458274209'), mpfr('1.541725790028002e-08'))
+    assert gmpy2.gamma_lgamma(mpfr(3)) == (mpfr('2.0'), mpfr('0.69314718055994529'))
+    assert gmpy2.ieee(32).exp_expm1(1) == (mpfr('2.71828175',24), mpfr('1.71828187',24))
+
+    pytest.raises(TypeError, lambda: gmpy2.exp_expm1(mpc(1, 1)))
+    pytest.raises(TypeError, lambda: gmpy2.erf_erfc('a'))
+
+
+def test_polyval():
+    assert gmpy2.polyval([1, 2, 3], 2) == mpz(11)
+    assert type(gmpy2.polyval([1, 2, 3], 2)) is mpz
+    assert gmpy2.polyval([1, 2, 3], mpq(1,2)) == mpq(17,4)
+    assert gmpy2.polyval([mpq(1,2), 1], 3) == mpq(5,2)
+    assert gmpy2.polyval([1, 2, 3], 0.5) == mpfr('4.25')
+    assert gmpy2.polyval([1, 2, 3], 1j) == mpc('2.0+2.0j')
+    assert gmpy2.polyval([], 2) == mpz(0)
+    assert gmpy2.polyval([], 2.0) == mpfr(0)
+
+    coeffs = [(-1)**i * (i * 10**20 + 7) for i in range(100)]
+    for x in [3, -7, 2**200 + 1]:
+        expected = 0
+        for c in coeffs:
+            expected = expected * x + c
+        assert gmpy2.polyval(coeffs, x) == expected
+
+    coeffs = [mpfr(1) / (i + 1) for i in range(51)]
+    exact = gmpy2.polyval([mpq(c) for c in coeffs], mpq(mpfr('0.9')))
+    assert gmpy2.polyval(coeffs, mpfr('0.9')) == mpfr(exact)
+    assert gmpy2.ieee(32).polyval([1, 1, 1], mpfr('0.1')) == mpfr('1.11000001',24)
+
+    # Correct rounding and ternary value, compared with a single addition.
+    c = mpfr(2)**-53 + mpfr(2)**-90
+    r = gmpy2.polyval([1, c], 1)
+    assert r == gmpy2.add(1, c) and r.rc == gmpy2.add(1, c).rc == 1
+    r = gmpy2.polyval([1, 1], mpfr(2)**-100)
+    assert r == 1 and r.rc == -1
+    with gmpy2.context(round=gmpy2.RoundUp):
+        r = gmpy2.polyval([1, 1], mpfr(2)**-100)
+        assert r == 1 + mpfr(2)**-52 and r.rc == 1
+    r = gmpy2.polyval([1, 0, -2], gmpy2.sqrt(2))
+    assert r == mpq(gmpy2.sqrt(2))**2 - 2 and r.rc == 0
+    for rnd in [gmpy2.RoundToNearest, gmpy2.RoundUp, gmpy2.RoundDown]:
+        ctx = gmpy2.context(round=rnd, precision=24)
+        for x in [mpfr('0.7'), mpfr('-1.3'), mpfr(2)**-30]:
+            r = ctx.polyval(coeffs, x)
+            exact = ctx.plus(mpfr(gmpy2.polyval([mpq(c) for c in coeffs], mpq(x)), 4000))
+            assert r == exact and r.rc == exact.rc
+
+    r = gmpy2.polyval([1, 1j], mpc(mpfr(2)**-100, 1))
+    assert r == mpc(mpfr(2)**-100, 2) and r.rc == (0, 0)
+    r = gmpy2.polyval([1, c], mpc(1, 0))
+    assert r.real == gmpy2.add(1, c) and r.imag == 0 and r.rc == (1, 0)
+
+    pytest.raises(TypeError, lambda: gmpy2.polyval(1, 2))
+    pytest.raises(TypeError, lambda: gmpy2.polyval([1, 'a'], 2))
+    pytest.raises(TypeError, lambda: gmpy2.polyval([1], 'a'))
+    pytest.raises(TypeError, lambda: gmpy2.polyval([1]))
+
+
+def test_polyval_many():
+    assert gmpy2.polyval_many([1, 0, -2], [1, 2, 3]) == [mpz(-1), mpz(2), mpz(7)]
+    assert gmpy2.polyval_many([1, 0, -2], [1, 2.5]) == [mpfr(-1), mpfr('4.25')]
+    assert gmpy2.polyval_many([1j, 1], [1, 2]) == [mpc('1.0+1.0j'), mpc('1.0+2.0j')]
+    assert gmpy2.polyval_many([1, 2], []) == []
+
+    res = gmpy2.polyval_many([1, 2], gmpy2.mpfr_array([1, 2, 3]))
+    assert type(res) is gmpy2.mpfr_array
+    assert res.tolist() == [3, 4, 5]
+    ctx = gmpy2.context(precision=100)
+    assert ctx.polyval_many([mpq(1,3)], gmpy2.mpfr_array([1])).precision == 100
+    c = mpfr(2)**-53 + mpfr(2)**-90
+    res = gmpy2.polyval_many([1, c], gmpy2.mpfr_array([1, 2]))
+    assert res.tolist() == [gmpy2.add(1, c), 2 + c]
+
+    pytest.raises(TypeError, lambda: gmpy2.polyval_many([1], [1, 'a']))
+    pytest.raises(TypeError, lambda: gmpy2.polyval_many([1], 1))
+    pytest.raises(TypeError, lambda: gmpy2.polyval_many([1j], gmpy2.mpfr_array([1])))
+
+
 def test_tan():
     r = mpfr(5.6)
 
@@ -1460,6 +1628,82 @@ def test_comb():
     assert comb(8,4) == mpz(70)
 
 
+def test_bincoef_mod():
+    for n in [0, 1, 10, 57, 300]:
+        for k in [0, 1, 2, n // 3, n, n + 1]:
+            for m in [1, 2, 8, 97, 1000, 10**9 + 7, 2**100]:
+                assert gmpy2.bincoef_mod(n, k, m) == bincoef(n, k) % m
+
+    # n beyond the cached prime table; m is factored instead.
+    n = 2**24 + 12345
+    for m in [2, 7, 27, 1000, 10**9 + 7, 2**10 * 3**5, 6 * (10**9 + 7)]:
+        for k in [0, 1, 100, 1000, n - 5]:
+            assert gmpy2.bincoef_mod(n, k, m) == bincoef(n, k) % m
+
+    assert gmpy2.bincoef_mod(10**18 + 5*10**8, 10**5, 10**9 + 7) == mpz(154685920)
+
+    # A long modulus is not used to reduce the Kummer product.
+    m = mpz(3)**20000 + 2
+    assert gmpy2.bincoef_mod(5000, 2100, m) == bincoef(5000, 2100) % m
+
+    # The Lucas, Granville and exact fallbacks are bounded.
+    n = 2**25
+    assert gmpy2.bincoef_mod(n, 30000, 3**13) == bincoef(n, 30000) % 3**13
+    pytest.raises(OverflowError, lambda: gmpy2.bincoef_mod(n, 2**20, 3**13))
+    p = gmpy2.next_prime(2**40)
+    pytest.raises(OverflowError, lambda: gmpy2.bincoef_mod(n, 2**22, p))
+    pytest.raises(OverflowError, lambda: gmpy2.bincoef_mod(n, 2**22, p * 7))
+
+    # The prime table is freed by free_cache() and rebuilt on demand.
+    gmpy2.free_cache()
+    gmpy2.free_cache()
+    assert gmpy2.bincoef_mod(1000, 300, 10**30) == bincoef(1000, 300) % 10**30
+
+    pytest.raises(ValueError, lambda: gmpy2.bincoef_mod(-1, 0, 5))
+    pytest.raises(ValueError, lambda: gmpy2.bincoef_mod(1, -1, 5))
+    pytest.raises(ValueError, lambda: gmpy2.bincoef_mod(1, 1, 0))
+    pytest.raises(TypeError, lambda: gmpy2.bincoef_mod('a', 1, 2))
+    pytest.raises(TypeError, lambda: gmpy2.bincoef_mod(1, 2))
+
+
+def test_range_product():
+    for a in range(-6, 6):
+        for b in range(-6, 8):
+            r = 1
+            for i in range(a, b):
+                r *= i
+            assert gmpy2.range_product(a, b) == r
+
+    assert gmpy2.range_product(1, 101) == fac(100)
+    assert gmpy2.range_product(50, 201) * fac(49) == fac(200)
+    assert gmpy2.range_product(2**64 - 10, 2**64 + 90) == \
+           gmpy2.falling_factorial(2**64 + 89, 100)
+    x = mpz(10)**30
+    assert gmpy2.range_product(x, x + 100) == gmpy2.rising_factorial(x, 100)
+
+    pytest.raises(OverflowError, lambda: gmpy2.range_product(0, 2**100))
+    pytest.raises(TypeError, lambda: gmpy2.range_product(1, 'a'))
+    pytest.raises(TypeError, lambda: gmpy2.range_product(1))
+
+
+def test_falling_rising_factorial():
+    for x in [-7, -1, 0, 1, 5, 100, 10**20]:
+        for k in [0, 1, 2, 5, 40]:
+            f = r = 1
+            for i in range(k):
+                f *= x - i
+                r *= x + i
+            assert gmpy2.falling_factorial(x, k) == f
+            assert gmpy2.rising_factorial(x, k) == r
+
+    assert gmpy2.falling_factorial(100, 3) == mpz(970200)
+    assert gmpy2.rising_factorial(mpz(5), 3) == mpz(210)
+
+    pytest.raises(OverflowError, lambda: gmpy2.falling_factorial(5, -1))
+    pytest.raises(TypeError, lambda: gmpy2.rising_factorial('a', 1))
+    pytest.raises(TypeError, lambda: gmpy2.rising_factorial(1))
+
+
 def test_isqrt():
     a = mpz(123)
 
@@ -1525,6 +1769,24 @@ def test_invert():
     assert invert(123,100) == mpz(87)
 
 
+def test_invert_many():
+    m = mpz(2)**127 - 1
+    xs = [mpz(3)**i % m for i in range(1, 50)] + [-5, 10**50]
+
+    assert gmpy2.invert_many(xs, m) == [invert(x, m) for x in xs]
+    assert gmpy2.invert_many([3, -2, 10], 7) == [mpz(5), mpz(3), mpz(5)]
+    assert gmpy2.invert_many((x for x in [1, 2]), 5) == [mpz(1), mpz(3)]
+    assert gmpy2.invert_many([3], -7) == [mpz(5)]
+    assert gmpy2.invert_many([], 5) == []
+
+    pytest.raises(ZeroDivisionError, lambda: gmpy2.invert_many([3, 4, 5], 8))
+    pytest.raises(ZeroDivisionError, lambda: gmpy2.invert_many([3], 0))
+    pytest.raises(TypeError, lambda: gmpy2.invert_many([3, 'a'], 7))
+    pytest.raises(TypeError, lambda: gmpy2.invert_many([3], 'a'))
+    pytest.raises(TypeError, lambda: gmpy2.invert_many([3]))
+    pytest.raises(TypeError, lambda: gmpy2.invert_many(3, 7))
+
+
 def test_divexact():
     a = mpz(123)
 
@@ -1627,12 +1889,107 @@ def test_legendre():
     pytest.raises(TypeError, lambda: legendre())
 
 
+def test_sqrtmod():
+    # p = 3 mod 4, p = 5 mod 8, Tonelli-Shanks and Cipolla
+    for p in [2, 7, 13, 97, 2**127 - 1, 2**255 - 19, 65537, 3*2**30 + 1]:
+        p = mpz(p)
+        for x in [0, 1, 2, 12345, p - 1, 3**100]:
+            a = x*x % p
+            r = gmpy2.sqrtmod(a, p)
+            assert r*r % p == a
+            assert 2*r <= p
+        xs = [x*x for x in range(50)]
+        assert gmpy2.sqrtmod_list(xs, p) == [gmpy2.sqrtmod(a, p) for a in xs]
+
+    assert gmpy2.sqrtmod(10, 13) == mpz(6)
+    assert gmpy2.sqrtmod(-3, 7) == mpz(2)
+    assert gmpy2.sqrtmod_list([], 7) == []
+
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod(3, 7))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod(2, 4))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod(2, -7))
+    pytest.raises(TypeError, lambda: gmpy2.sqrtmod('a', 7))
+    pytest.raises(TypeError, lambda: gmpy2.sqrtmod(2))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_list([2, 3], 7))
+    pytest.raises(TypeError, lambda: gmpy2.sqrtmod_list([2, 'a'], 7))
+
+    # p is not tested for primality, but a composite p is detected by the
+    # capped search for a non-residue or by the final check of the root.
+    for p in [15, 10007**2, 1000003**2, 561, 2**61 * 3 + 1, 4, 22]:
+        pytest.raises(ValueError, lambda: gmpy2.sqrtmod(2, p))
+        pytest.raises(ValueError, lambda: gmpy2.sqrtmod_list([4, 2], p))
+        pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power(2, p, 2))
+        pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power_list([2], p, 2))
+    with pytest.raises(ValueError, match="prime"):
+        gmpy2.sqrtmod(2, 15)
+    with pytest.raises(ValueError, match="prime"):
+        gmpy2.sqrtmod(6, 15)
+
+
+def test_sqrtmod_prime_power():
+    for p in [2, 3, 5, 97]:
+        for k in [1, 2, 3, 7, 20]:
+            pk = mpz(p)**k
+            for x in [1, 3, 11, 3**40, p*7, p**3 * 5]:
+                a = x*x % pk
+                r = gmpy2.sqrtmod_prime_power(a, p, k)
+                assert r*r % pk == a
+                assert 2*r <= pk
+
+    assert gmpy2.sqrtmod_prime_power(0, 3, 4) == mpz(0)
+    assert gmpy2.sqrtmod_prime_power_list([4, 9], 5, 3) == [mpz(2), mpz(3)]
+
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power(3, 7, 2))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power(3, 3, 3))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power(5, 2, 3))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power(2, 7, 0))
+    pytest.raises(OverflowError, lambda: gmpy2.sqrtmod_prime_power(2, 7, -1))
+    pytest.raises(TypeError, lambda: gmpy2.sqrtmod_prime_power(2, 7))
+    pytest.raises(ValueError, lambda: gmpy2.sqrtmod_prime_power_list([4, 3], 5, 3))
+
+
 def test_fsum():
     assert gmpy2.fsum([]) == mpfr('0.0')
     assert gmpy2.fsum([4, 5, 6]) == mpfr('15.0')
     assert gmpy2.fsum(range(13)) == mpfr('78.0')
 
+    assert gmpy2.fsum(x for x in range(13)) == mpfr('78.0')
+    assert gmpy2.fsum(iter([1e100, 1.0, -1e100])) == mpfr('1.0')
+    assert gmpy2.fsum(gmpy2.mpfr_array([1, 2, 3])) == mpfr('6.0')
+
+    assert gmpy2.fsum([mpq(1, 3)] * 3) == 1
+    assert gmpy2.fsum([Fraction(1, 10)] * 10) == 1
+    assert gmpy2.fsum([1, mpq(1, 2**53), mpq(1, 2**200)]) == mpfr('1.0000000000000002')
+    assert gmpy2.fsum([1e300, mpq(1, 3), -1e300]) == mpfr(mpq(1, 3))
+    assert gmpy2.fsum([float('inf'), mpq(1, 3)]) == mpfr('inf')
+    with gmpy2.context(precision=200):
+        assert gmpy2.fsum([mpq(1, 3)]) == mpfr(mpq(1, 3))
+
     pytest.raises(TypeError, lambda: gmpy2.fsum(1))
+    pytest.raises(TypeError, lambda: gmpy2.fsum(['a']))
+    pytest.raises(TypeError, lambda: gmpy2.fsum(x for x in [1, 'a']))
+
+
+def test_fdot():
+    assert gmpy2.fdot([], []) == mpfr('0.0')
+    assert gmpy2.fdot([1, 2, 3], [4, 5, 6]) == mpfr('32.0')
+    assert gmpy2.fdot([1e100, 1, -1e100], [1, 1, 1]) == mpfr('1.0')
+    assert gmpy2.fdot((x for x in range(4)), range(4)) == mpfr('14.0')
+    assert gmpy2.fdot(gmpy2.mpfr_array([0.5, 2]), [mpq(1,3), 3]) == mpfr('6.1666666666666667')
+
+    ctx = gmpy2.context(precision=20)
+    assert ctx.fdot([mpfr('0.1')], [3]) == ctx.mul(mpfr('0.1'), 3)
+
+    assert gmpy2.fdot([mpq(1, 3), mpq(2, 3)], [3, Fraction(3, 2)]) == 2
+    assert gmpy2.fdot([mpq(1, 3), 1], [mpfr(3), mpq(1, 2**200)]) == 1
+    assert gmpy2.fdot([1, 1, mpq(1, 3)], [1, 2**-53, 3 * 2**-200]) == mpfr('1.0000000000000002')
+    assert gmpy2.is_nan(gmpy2.fdot([mpq(1, 3), float('inf')], [3, mpq(0)]))
+    assert gmpy2.fdot([mpq(1, 3), float('inf')], [3, mpq(-1)]) == mpfr('-inf')
+
+    pytest.raises(TypeError, lambda: gmpy2.fdot([1]))
+    pytest.raises(TypeError, lambda: gmpy2.fdot(1, [1]))
+    pytest.raises(TypeError, lambda: gmpy2.fdot([1], ['a']))
+    pytest.raises(ValueError, lambda: gmpy2.fdot([1, 2], [1]))
 
 
 def test_next_toward():
@@ -25,3 +25,29 @@ def test_misc():
 def test_sizeof():
     assert sys.getsizeof(gmpy2.mpz(10)) > 0
     assert sys.getsizeof(gmpy2.mpfr('1.0')) > 0
+
+
+@pytest.mark.skipif(platform.python_implementation() == "PyPy",
+                    reason="objects are not cached")
+def test_cache_stats():
+    stats = gmpy2._cache_stats()
+    assert [s[0] for s in stats['mpfr']] == [64, 128, 256, 512, 1024]
+    assert [s[0] for s in stats['mpc']] == [64, 128, 256, 512, 1024]
+
+    # A freed 113-bit mpfr is reused for the next request in its bucket.
+    x = gmpy2.mpfr(1, 113)
+    del x
+    before = gmpy2._cache_stats()['mpfr'][1]
+    x = gmpy2.mpfr(2, 113)
+    after = gmpy2._cache_stats()['mpfr'][1]
+    assert after[2] == before[2] + 1
+    assert after[1] == before[1] - 1
+    assert x == 2 and x.precision == 113
+
+    z = gmpy2.mpc(1, precision=(53, 200))
+    del z
+    before = gmpy2._cache_stats()['mpc'][2]
+    z = gmpy2.mpc(2, precision=(250, 100))
+    after = gmpy2._cache_stats()['mpc'][2]
+    assert after[2] == before[2] + 1
+    assert z == 2 and z.precision == (250, 100)
@@ -1,3 +1,5 @@
+import copy
+import pickle
 from concurrent.futures import ThreadPoolExecutor
 from fractions import Fraction
 import cmath
@@ -9,7 +11,8 @@ from supportclasses import a, b, c, cx, d, q, r, z
 
 import gmpy2
 from gmpy2 import (cmp, cmp_abs, from_binary, get_context, is_nan, mpc,
-                   mpc_random, mpfr, mpq, mpz, nan, random_state, to_binary)
+                   mpc_random, mpfr, mpq, mpz, nan, random_state, to_binary,
+                   xmpc)
 
 
 def test_mpc_cmp():
@@ -511,3 +514,57 @@ def test_mpc_thread_safe():
     tpe = ThreadPoolExecutor(max_workers=20)
     for _ in range(1000):
         tpe.submit(worker)
+
+
+def test_xmpc():
+    x = xmpc(1+2j)
+    assert repr(x) == "xmpc('1.0+2.0j')" and str(x) == '1.0+2.0j'
+    assert xmpc(1, 2, precision=(60, 70)).precision == (60, 70)
+    pytest.raises(TypeError, lambda: hash(x))
+
+    y = x
+    x *= 1j
+    x += mpfr(1)
+    x /= 2
+    x -= mpq(1, 2)
+    x += mpc(1, 1)
+    assert x is y and x == mpc(0.0, 1.5)
+    assert x.real == 0 and x.imag == 1.5 and x.rc == (0, 0)
+
+    assert type(x + 1) is mpc and x + 1 == mpc(1, 1.5)
+    assert -x is None and x == mpc(0, -1.5)
+    assert abs(x) == 1.5 and type(abs(x)) is mpfr
+    assert complex(x) == -1.5j and '{:.1f}'.format(x) == '-0.0-1.5j'
+    c = mpc(x)
+    x += 1
+    assert c == mpc(0, -1.5) and x == mpc(1, -1.5)
+
+    c = x.copy()
+    c += 1
+    assert c == mpc(2, -1.5) and x == mpc(1, -1.5)
+    m = x.make_mpc()
+    assert type(m) is mpc and m == mpc(1, -1.5) and x == 0
+
+    x = xmpc(1, 2, precision=(60, 70))
+    x /= 3
+    assert x.digits(2, 4) == (('1011', -1, 60), ('1011', 0, 70))
+    for y in (pickle.loads(pickle.dumps(x)), from_binary(gmpy2.to_binary(x)),
+              copy.copy(x), copy.deepcopy(x)):
+        assert type(y) is xmpc and y is not x and y == x
+        assert y.precision == (60, 70)
+    y += 1
+    assert y != x
+
+    x = xmpc(1, precision=200)
+    x += mpq(1, 3)
+    assert x.real == mpfr(mpq(4, 3), 200) and x.imag == 0
+    x = xmpc(1)
+    x += mpq(1, 2**53) + mpq(1, 2**200)
+    assert x == mpc('1.0000000000000002')
+    x = xmpc(1, 2, precision=200)
+    x *= Fraction(1, 3)
+    assert x.real == mpfr(mpq(1, 3), 200) and x.imag == mpfr(mpq(2, 3), 200)
+    x = xmpc(1, 2)
+    x -= mpq(1, 2)
+    x /= mpq(1, 2)
+    assert x == mpc(1, 4) and x.rc == (0, 0)
@@ -1,3 +1,5 @@
+import array
+import copy
 import math
 import pickle
 import sys
@@ -12,8 +14,9 @@ from supportclasses import a, b, c, d, q, r, z
 
 import gmpy2
 from gmpy2 import (cmp, cmp_abs, from_binary, gamma_inc, get_context, inf,
-                   is_nan, mpc, mpfr, mpfr_grandom, mpfr_nrandom, mpq, mpz,
-                   nan, random_state, to_binary, xmpz, zero)
+                   is_nan, mpc, mpfr, mpfr_array, mpfr_grandom, mpfr_nrandom,
+                   mpq, mpz, nan, random_state, to_binary, vec, xmpfr, xmpz,
+                   zero)
 
 
 def test_mpfr_gamma_inc():
@@ -932,6 +935,294 @@ def test_issue_540():
     assert ctxD.div(a, b) == mpfr('0.099999999999999992')
 
 
+def test_vec():
+    xs = [mpfr(i)/7 for i in range(1, 300)]
+
+    assert vec('sin', xs) == [gmpy2.sin(x) for x in xs]
+    assert vec(gmpy2.exp, (x for x in xs)) == [gmpy2.exp(x) for x in xs]
+    assert vec(get_context().log, xs) == [gmpy2.log(x) for x in xs]
+    assert vec('add', xs, xs) == [x + x for x in xs]
+    assert vec('pow', [1, 2, mpz(3), mpq(1,2)], 2) == [1, 4, 9, mpfr(0.25)]
+    assert vec('atan2', [1], [mpfr(1)]) == [gmpy2.atan2(1, 1)]
+    assert vec('sin', []) == []
+
+    assert vec('sin', xs, threads=4) == vec('sin', xs)
+    assert vec('mul', xs, 3, threads=3) == [x * 3 for x in xs]
+
+    r = vec('sqrt', [4, -1])
+    assert r[0] == 2 and is_nan(r[1])
+    assert vec('sqrt', [4, -1+0j]) == [mpc(2), mpc(1j)]
+    assert vec('mul', [1j, 2], 1j) == [mpc(-1), mpc(2j)]
+
+    ctx = gmpy2.context(precision=100)
+    r = ctx.vec('log', [2])
+    assert r[0].precision == 100 and r[0] == ctx.log(2)
+
+    out = [None]*3
+    assert vec('square', [1, 2, 3], out=out) is out
+    assert out == [1, 4, 9]
+
+    ctx = gmpy2.context()
+    ctx.vec('div', [1, 2], 3)
+    assert ctx.inexact and not ctx.divzero
+    ctx.vec('log', [1, 0])
+    assert ctx.divzero
+    ctx.trap_divzero = True
+    with pytest.raises(gmpy2.DivisionByZeroError):
+        ctx.vec('log', [1, 0])
+
+    with pytest.raises(ValueError):
+        vec('foo', xs)
+    with pytest.raises(TypeError):
+        vec(math.sin, xs)
+    with pytest.raises(TypeError):
+        vec('add', xs)
+    with pytest.raises(TypeError):
+        vec('sin', xs, xs)
+    with pytest.raises(ValueError):
+        vec('add', xs, xs[1:])
+    with pytest.raises(TypeError):
+        vec('sin', [1, 'a'])
+    with pytest.raises(TypeError):
+        vec('ai', [1j])
+    with pytest.raises(TypeError):
+        vec('sin', 1)
+    with pytest.raises(ValueError):
+        vec('sin', xs, out=[])
+    with pytest.raises(ValueError):
+        vec('sin', xs, threads=0)
+
+
+def test_mpfr_array():
+    a = mpfr_array([1, 2, mpz(3), mpq(1,2), mpfr('0.1')])
+    assert len(a) == 5 and a.precision == 53
+    assert a.tolist() == [1, 2, 3, 0.5, mpfr('0.1')]
+    assert list(a) == a.tolist()
+    assert a[-1] == mpfr('0.1') and a[-1].precision == 53
+    assert repr(mpfr_array([1])) == "mpfr_array([mpfr('1.0')], precision=53)"
+    assert mpfr_array(3).tolist() == [0, 0, 0]
+    assert len(mpfr_array()) == 0
+    assert mpfr_array(2, precision=100)[0].precision == 100
+    assert mpfr_array(a, precision=10)[4].precision == 10
+    assert mpfr_array(array.array('d', [1.5, -2.0])).tolist() == [1.5, -2]
+    assert mpfr_array(memoryview(array.array('d', [1, 2, 3, 4]))[::2]).tolist() == [1, 3]
+
+    b = mpfr_array([1, 2, 3, 4])
+    assert (b + b).tolist() == [2, 4, 6, 8]
+    assert (b - 1).tolist() == [0, 1, 2, 3]
+    assert (1 - b).tolist() == [0, -1, -2, -3]
+    assert (b * mpfr(2)).tolist() == [2, 4, 6, 8]
+    assert (b / 4).tolist() == [0.25, 0.5, 0.75, 1]
+    assert (-b).tolist() == [-1, -2, -3, -4]
+    assert abs(-b).tolist() == b.tolist()
+    assert (mpfr_array([1], precision=10) + mpfr_array([1], precision=80)).precision == 80
+
+    c = b.copy()
+    c *= c
+    assert c.tolist() == [1, 4, 9, 16] and b.tolist() == [1, 2, 3, 4]
+
+    v = b[1:3]
+    assert v.tolist() == [2, 3]
+    v[0] = 20
+    assert b.tolist() == [1, 20, 3, 4]
+    assert b[::-1].tolist() == [4, 3, 20, 1]
+    assert b[::2][::-1].tolist() == [3, 1]
+    assert b[5:].tolist() == []
+    b[::2] = 0
+    assert b.tolist() == [0, 20, 0, 4]
+    b[:] = [1, 2, 3, 4]
+    b[1:] = b[:-1]
+    assert b.tolist() == [1, 1, 2, 3]
+    b[1:] += b[:-1]
+    assert b.tolist() == [1, 2, 3, 5]
+
+    b = mpfr_array([1, 2, 3, 4])
+    assert b.sum() == 10
+    assert b.dot(b) == 30
+    assert b.dot([1, 0, 1, 0]) == 4
+    assert b.norm() == gmpy2.sqrt(30)
+    x = mpfr_array([1e100, 1, -1e100])
+    assert x.sum() == 1
+    assert x.dot([1, 1, 1]) == 1
+    assert mpfr_array().sum() == 0
+
+    with gmpy2.context() as ctx:
+        mpfr_array([1, 3]) / 3
+        assert ctx.inexact
+    with gmpy2.context(trap_divzero=True):
+        with pytest.raises(gmpy2.DivisionByZeroError):
+            mpfr_array([1, 3]) / 0
+
+    r = vec('sqrt', mpfr_array([1, 4, 9]))
+    assert isinstance(r, mpfr_array) and r.tolist() == [1, 2, 3]
+    out = mpfr_array(3, precision=100)
+    assert vec('add', [1, 2, 3], out, out=out) is out
+    assert out.tolist() == [1, 2, 3] and out[0].precision == 100
+
+    with pytest.raises(ValueError):
+        mpfr_array(-1)
+    with pytest.raises(ValueError):
+        mpfr_array(1, precision=-1)
+    with pytest.raises(TypeError):
+        mpfr_array(['a'])
+    with pytest.raises(TypeError):
+        mpfr_array(array.array('i', [1]))
+    with pytest.raises(ValueError):
+        mpfr_array([1, 2]) + mpfr_array([1])
+    with pytest.raises(TypeError):
+        mpfr_array([1]) + 'a'
+    with pytest.raises(IndexError):
+        mpfr_array(2)[2]
+    with pytest.raises(IndexError):
+        mpfr_array(2)[-3] = 1
+    with pytest.raises(TypeError):
+        mpfr_array(2)['a']
+    with pytest.raises(TypeError):
+        del mpfr_array(2)[0]
+    with pytest.raises(ValueError):
+        mpfr_array(2)[:] = [1, 2, 3]
+    with pytest.raises(ValueError):
+        mpfr_array(2).dot([1])
+    with pytest.raises(TypeError):
+        vec('sqrt', [1j], out=mpfr_array(1))
+    with pytest.raises(ValueError):
+        mpfr_array(2, precision=1)
+    with pytest.raises(ValueError):
+        mpfr_array([1.5], precision=1)
+    assert mpfr_array([1.5], precision=2)[0].precision == 2
+
+
+def test_mpfr_array_numpy():
+    np = pytest.importorskip('numpy')
+
+    a = mpfr_array(np.array([1.5, 2.5, -3.0]))
+    assert a.tolist() == [1.5, 2.5, -3]
+    assert mpfr_array(np.arange(6.0)[::2]).tolist() == [0, 2, 4]
+    r = np.asarray(a)
+    assert r.dtype == np.float64 and r.tolist() == [1.5, 2.5, -3.0]
+    assert np.asarray(a, dtype=np.float32).dtype == np.float32
+
+
+def test_mpfr_accumulator():
+    acc = gmpy2.mpfr_accumulator()
+    assert acc.precision == 53 and acc.count == 0
+    assert acc.value() == 0
+    acc.add(1e100)
+    acc.add(1.0)
+    acc.add(-1e100)
+    assert acc.value() == 1 and acc.count == 3
+    assert repr(acc) == '<mpfr_accumulator precision=53 count=3>'
+
+    acc = gmpy2.mpfr_accumulator(200)
+    acc.add_many(mpfr('0.1') for _ in range(10))
+    assert acc.value() == gmpy2.context(precision=200).mul(mpfr('0.1'), 10)
+    assert acc.value().precision == 200
+
+    xs = [(-1)**i * 1.1**i for i in range(-300, 300)]
+    acc = gmpy2.mpfr_accumulator()
+    acc.add_many(xs)
+    assert acc.value() == gmpy2.fsum(xs)
+    acc.add_many(mpfr_array([1, 2, 3]))
+    assert acc.count == 603
+    acc.reset()
+    assert acc.value() == 0 and acc.count == 0
+
+    acc.add(Fraction(1, 4))
+    acc.add(mpz(2))
+    assert acc.value() == 2.25
+
+    acc.add(inf(1))
+    assert acc.value() == inf(1)
+    acc.add(inf(-1))
+    assert acc.value().is_nan()
+
+    with gmpy2.context(round=gmpy2.RoundUp):
+        acc = gmpy2.mpfr_accumulator(2)
+        acc.add(5)
+        assert acc.value() == 6
+
+    pytest.raises(TypeError, lambda: acc.add('a'))
+    pytest.raises(TypeError, lambda: acc.add_many(1))
+    pytest.raises(TypeError, lambda: acc.add_many([1, 'a']))
+    assert acc.count == 2
+    pytest.raises(ValueError, lambda: gmpy2.mpfr_accumulator(-1))
+    pytest.raises(ValueError, lambda: gmpy2.mpfr_accumulator(1))
+
+
+def test_xmpfr():
+    x = xmpfr(1, 100)
+    assert repr(x) == "xmpfr('1.0',100)" and str(x) == '1.0'
+    assert x.precision == 100
+    pytest.raises(TypeError, lambda: hash(x))
+
+    y = x
+    x /= 3
+    assert x is y and x.precision == 100 and x.rc == 1
+    assert x == gmpy2.context(precision=100).div(1, 3)
+    x += mpq(1, 3)
+    x *= 3
+    x -= 0.5
+    x += mpz(2)**70
+    x += 2**80
+    assert x == mpq(3, 2) + 2**70 + 2**80 and x.precision == 100
+
+    x = xmpfr(1)
+    x += mpq(1, 3)
+    assert x == mpfr(mpq(4, 3))
+    x += 1j
+    assert type(x) is mpc
+
+    x = xmpfr(1.5)
+    assert type(x + 1) is mpfr and x + 1 == 2.5
+    assert -x is None and x == -1.5
+    assert abs(x) is None and x == 1.5
+    assert int(x) == 2 and float(x) == 1.5 and '{:.2f}'.format(x) == '1.50'
+    assert mpq(x) == mpq(3, 2) and mpz(xmpfr(2.5)) == 2
+    f = mpfr(x)
+    x *= 2
+    assert f == 1.5 and x == 3
+
+    with gmpy2.context(trap_divzero=True):
+        pytest.raises(gmpy2.DivisionByZeroError, lambda: x.copy().__itruediv__(0))
+
+    c = x.copy()
+    c += 1
+    assert c == 4 and x == 3
+    m = x.make_mpfr()
+    assert type(m) is mpfr and m == 3 and m.precision == 53 and x == 0
+
+    # Rationals are rounded once: 1 + 2**-53 + tiny must not round to 1.
+    y = Fraction(1, 2**53) + Fraction(1, 3*2**100)
+    x = xmpfr(1)
+    x += y
+    assert x == 1 + mpfr(2)**-52 and x.rc == 1
+    class HasMPQ:
+        def __mpq__(self): return mpq(y)
+    x = xmpfr(1)
+    x += HasMPQ()
+    assert x == 1 + mpfr(2)**-52
+    x = xmpfr(2)
+    x *= q
+    assert x == 3
+
+    x = xmpfr(-2.5, 100)
+    assert round(x) == -2 and type(round(x)) is mpz and round(x, 1) == -2.5
+    assert math.trunc(x) == -2 and math.floor(x) == -3 and math.ceil(x) == -2
+    assert x.as_integer_ratio() == (-5, 2) and not x.is_integer()
+    assert x.digits() == ('-25000000000000000000000000000000', 1, 100)
+    assert gmpy2.get_exp(x) == 2 and gmpy2.check_range(x) == -2.5
+    assert type(gmpy2.check_range(x)) is mpfr
+    x /= 3
+    for y in (pickle.loads(pickle.dumps(x)), from_binary(gmpy2.to_binary(x)),
+              copy.copy(x), copy.deepcopy(x)):
+        assert type(y) is xmpfr and y is not x and y == x
+        assert y.precision == 100 and y.rc == x.rc == 1
+    y += 1
+    assert y != x
+    y = pickle.loads(pickle.dumps(xmpfr('nan')))
+    assert type(y) is xmpfr and gmpy2.is_nan(y)
+
+
 def test_mpfr_thread_safe():
     def worker():
         ctx = gmpy2.get_context()
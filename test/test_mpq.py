@@ -1,3 +1,4 @@
+import copy
 import math
 import numbers
 import pickle
@@ -12,8 +13,9 @@ from hypothesis.strategies import fractions, integers
 from supportclasses import a, b, c, d, q, z
 
 import gmpy2
-from gmpy2 import (cmp, cmp_abs, from_binary, is_nan, mpc, mpfr, mpq, mpz,
-                   to_binary, xmpz)
+from gmpy2 import (cmp, cmp_abs, continued_fraction, convergents,
+                   from_binary, is_nan, mpc, mpfr, mpq, mpq_accumulator,
+                   mpq_sum, mpz, rational_reconstruct, to_binary, xmpq, xmpz)
 
 
 def test_mpq_constructor():
@@ -183,6 +185,10 @@ def test_mpq_to_from_binary(p, q):
 @example(Fraction(15432, 125))
 @example(Fraction(1, sys.hash_info.modulus))
 @example(Fraction(-1, sys.hash_info.modulus))
+@example(Fraction(3, 7*sys.hash_info.modulus**2))
+@example(Fraction(sys.hash_info.modulus, 2))
+@example(Fraction(1, sys.hash_info.modulus - 1))
+@example(Fraction(-2**200 - 1, 3**90))
 def test_mpq_hash(q):
     assert hash(mpq(q)) == hash(q)
 
@@ -668,3 +674,161 @@ def test_mpq_limit_denominator():
     assert mpq(201, 200).limit_denominator(100) == mpq(1)
     assert mpq(201, 200).limit_denominator(101) == mpq(102, 101)
     assert mpq(0).limit_denominator(10000) == mpq(0)
+
+
+def test_xmpq():
+    x = xmpq(1, 3)
+    assert repr(x) == 'xmpq(1,3)' and str(x) == '1/3'
+    assert xmpq('2/4') == mpq(1, 2)
+    pytest.raises(TypeError, lambda: hash(x))
+
+    y = x
+    x += 1
+    x -= mpq(1, 6)
+    x *= mpz(6)
+    x /= Fraction(7, 2)
+    assert x is y and x == 2 and type(x) is xmpq
+    x += xmpz(2)
+    x -= x
+    assert x == 0
+    with pytest.raises(ZeroDivisionError):
+        x /= 0
+
+    x = xmpq(3, 2)
+    assert type(x + 1) is mpq and x + 1 == mpq(5, 2)
+    assert type(mpq(1, 2) * x) is mpq
+    x += 1.5
+    assert type(x) is mpfr and x == 3
+
+    x = xmpq(-3, 2)
+    assert -x is None and x == mpq(3, 2)
+    assert abs(-mpq(1)) == 1 and abs(x) is None and x == mpq(3, 2)
+    assert int(x) == 1 and float(x) == 1.5 and bool(x)
+    assert x.numerator == 3 and x.denominator == 2
+    assert mpz(x) == 1 and mpfr(x) == 1.5 and mpc(x) == 1.5
+
+    q = mpq(x)
+    assert type(q) is mpq
+    x += 1
+    assert q == mpq(3, 2)
+
+    c = x.copy()
+    c += 1
+    assert c == mpq(7, 2) and x == mpq(5, 2)
+    m = x.make_mpq()
+    assert type(m) is mpq and m == mpq(5, 2) and x == 0
+
+    x = xmpq(-7, 2)
+    assert round(x) == -4 and type(round(x)) is mpz and round(x, -1) == 0
+    assert math.trunc(x) == -3 and math.floor(x) == -4 and math.ceil(x) == -3
+    assert x.as_integer_ratio() == (-7, 2) and not x.is_integer()
+    assert x.digits() == '-7/2' and x.digits(2) == '-0b111/0b10'
+    for y in (pickle.loads(pickle.dumps(x)), gmpy2.from_binary(gmpy2.to_binary(x)),
+              copy.copy(x), copy.deepcopy(x)):
+        assert type(y) is xmpq and y is not x and y == x
+    y += 1
+    assert y != x
+    assert gmpy2.from_binary(gmpy2.to_binary(xmpq(0))) == 0
+
+
+def test_mpq_accumulator():
+    acc = mpq_accumulator()
+    assert acc.threshold == 1024 and acc.count == 0
+    assert acc.value() == 0 and type(acc.value()) is mpq
+    acc.add(mpq(1, 3))
+    acc.add(Fraction(1, 6))
+    acc.add(2)
+    acc.add(xmpq(-1, 2))
+    assert acc.value() == 2 and acc.count == 4
+    assert repr(acc) == '<mpq_accumulator threshold=1024 count=4>'
+
+    xs = [mpq(1, k) for k in range(1, 300)]
+    for t in (0, 16, 1024):
+        acc = mpq_accumulator(t)
+        acc.add_many(iter(xs))
+        assert acc.value() == sum(xs, mpq(0))
+        assert acc.value() == sum(xs, mpq(0))
+    acc.add_many([mpz(3), mpq(-2, 3)])
+    assert acc.value() == sum(xs, mpq(7, 3)) and acc.count == 301
+    acc.reset()
+    assert acc.value() == 0 and acc.count == 0
+    acc0 = mpq_accumulator(0)
+    acc0.add_many([mpq(1, 2)] * 3 + [mpq(1, 6), mpq(1, 3)])
+    assert acc0.value() == 2
+
+    pytest.raises(ValueError, lambda: mpq_accumulator(-1))
+    pytest.raises(TypeError, lambda: acc.add(1.5))
+    pytest.raises(TypeError, lambda: acc.add_many(1))
+    pytest.raises(TypeError, lambda: acc.add_many([1, 'a']))
+    assert acc.value() == 1
+
+
+def test_mpq_sum():
+    assert mpq_sum([]) == 0 and type(mpq_sum([])) is mpq
+    assert mpq_sum([mpq(1, 3)]) == mpq(1, 3)
+    assert mpq_sum([1, mpz(2), mpq(1, 2), Fraction(1, 3), xmpq(1, 6)]) == 4
+    xs = [mpq(k % 7 - 3, k) for k in range(1, 500)]
+    assert mpq_sum(xs) == sum(xs, mpq(0))
+    assert mpq_sum(x for x in xs) == sum(xs, mpq(0))
+    assert mpq_sum([mpq(1, 4)] * 8) == 2
+    pytest.raises(TypeError, lambda: mpq_sum(1))
+    pytest.raises(TypeError, lambda: mpq_sum([1, 1.5]))
+
+
+def cf_terms(n, d):
+    terms = []
+    while d:
+        q, r = divmod(n, d)
+        terms.append(q)
+        n, d = d, r
+    return terms
+
+
+def test_continued_fraction():
+    assert list(continued_fraction(mpq(7, 3))) == [2, 3]
+    assert list(continued_fraction(mpq(-7, 3))) == [-3, 1, 2]
+    assert list(continued_fraction(0)) == [0]
+    assert list(continued_fraction(Fraction(415, 93))) == [4, 2, 6, 7]
+    assert list(continued_fraction(mpfr(1.5))) == [1, 2]
+    assert list(continued_fraction(0.1, 3)) == [0, 9, 1]
+    assert list(continued_fraction(mpq(7, 3), 0)) == []
+    assert all(type(t) is mpz for t in continued_fraction(mpq(355, 113)))
+
+    x = mpq(mpz(3)**2000 + 1, mpz(7)**1100)
+    assert list(continued_fraction(x)) == cf_terms(int(x.numerator),
+                                                   int(x.denominator))
+    assert len(list(continued_fraction(x, 1000))) == 1000
+
+    pytest.raises(TypeError, lambda: continued_fraction(1j))
+    pytest.raises(TypeError, lambda: continued_fraction())
+    pytest.raises(TypeError, lambda: continued_fraction(1, 'a'))
+    pytest.raises(ValueError, lambda: continued_fraction(1, -1))
+    pytest.raises(OverflowError, lambda: continued_fraction(mpfr('inf')))
+
+
+def test_convergents():
+    assert list(convergents(3.14159, 4)) == [3, mpq(22, 7), mpq(333, 106),
+                                              mpq(355, 113)]
+    assert list(convergents(mpq(-7, 3))) == [-3, -2, mpq(-7, 3)]
+    x = mpq(mpz(3)**2000 + 1, mpz(7)**1100)
+    c = list(convergents(x))
+    assert c[-1] == x and all(type(v) is mpq for v in c)
+    assert all(abs(x - c[i + 1]) < abs(x - c[i]) for i in range(len(c) - 1))
+
+
+def test_rational_reconstruct():
+    p = 1000003
+    assert rational_reconstruct(3 * pow(7, -1, p), p) == mpq(3, 7)
+    assert rational_reconstruct(-2 * pow(5, -1, p), p) == mpq(-2, 5)
+    assert rational_reconstruct(0, p) == 0
+    assert rational_reconstruct(5, 101) == 5
+    assert rational_reconstruct(50, 101) == mpq(-1, 2)
+    pytest.raises(ValueError, lambda: rational_reconstruct(8, 101))
+    pytest.raises(ValueError, lambda: rational_reconstruct(1, 1))
+    pytest.raises(TypeError, lambda: rational_reconstruct(1.5, 7))
+    pytest.raises(TypeError, lambda: rational_reconstruct(1))
+
+    m = mpz(2)**3001
+    n, d = mpz(3)**900 + 1, -(mpz(7)**530 + 2)
+    r = rational_reconstruct(n * gmpy2.invert(d, m), m)
+    assert r == mpq(n, d)
@@ -1240,6 +1240,90 @@ def test_lucasu():
     assert gmpy2.lucasv_mod(4,3,57,123456) == mpz(75172)
 
 
+def test_lucasuv():
+    assert gmpy2.lucasuv(2,4,0) == (mpz(0), mpz(2))
+    assert gmpy2.lucasuv(4,3,8) == (gmpy2.lucasu(4,3,8), mpz(6562))
+    assert gmpy2.lucasuv(-3,5,77) == (gmpy2.lucasu(-3,5,77),
+                                      gmpy2.lucasv(-3,5,77))
+
+    raises(ValueError, lambda: gmpy2.lucasuv(2,1,4))
+    raises(ValueError, lambda: gmpy2.lucasuv(2,4,-1))
+    raises(TypeError, lambda: gmpy2.lucasuv(2,4))
+    raises(TypeError, lambda: gmpy2.lucasuv('a',4,8))
+
+    assert gmpy2.lucasuv_mod(3,2,0,7) == (mpz(0), mpz(2))
+    assert gmpy2.lucasuv_mod(3,2,555,777777777) == (mpz(387104641),
+                                                    gmpy2.lucasv_mod(3,2,555,777777777))
+    assert gmpy2.lucasuv_mod(4,3,55,123456) == (gmpy2.lucasu_mod(4,3,55,123456),
+                                                mpz(35788))
+    assert gmpy2.lucasuv_mod(4,3,0,1) == (mpz(0), mpz(0))
+
+    raises(ValueError, lambda: gmpy2.lucasuv_mod(2,1,555,777777777))
+    raises(ValueError, lambda: gmpy2.lucasuv_mod(3,2,-1,7))
+    raises(ValueError, lambda: gmpy2.lucasuv_mod(3,2,5,0))
+    raises(TypeError, lambda: gmpy2.lucasuv_mod(3,2,5,None))
+
+
+def test_lucasuv_mod_list():
+    n = mpz(2)**127 - 1
+    ks = [0, 1, 2, 5, 10, 11, 20, 21, 1000, 500, 250, 1001, 10**30, 10**30 + 1, 21]
+
+    assert gmpy2.lucasuv_mod_list(3,-1,ks,n) == [gmpy2.lucasuv_mod(3,-1,k,n) for k in ks]
+    assert gmpy2.lucasuv_mod_list(4,3,(55,56,57),123456) == [gmpy2.lucasuv_mod(4,3,k,123456)
+                                                            for k in (55,56,57)]
+    assert gmpy2.lucasuv_mod_list(4,3,[],7) == []
+
+    raises(ValueError, lambda: gmpy2.lucasuv_mod_list(2,1,[1],7))
+    raises(ValueError, lambda: gmpy2.lucasuv_mod_list(3,2,[1,-1],7))
+    raises(ValueError, lambda: gmpy2.lucasuv_mod_list(3,2,[1],0))
+    raises(TypeError, lambda: gmpy2.lucasuv_mod_list(3,2,[1,'a'],7))
+    raises(TypeError, lambda: gmpy2.lucasuv_mod_list(3,2,1,7))
+
+    params = [(3,2,555,777777777), (4,3,57,123456), (-3,5,10**20,10**9+7)]
+    assert gmpy2.lucasuv_mod_batch(params) == [gmpy2.lucasuv_mod(*t) for t in params]
+    assert gmpy2.lucasuv_mod_batch([]) == []
+
+    raises(ValueError, lambda: gmpy2.lucasuv_mod_batch([(3,2,5,7), (2,1,5,7)]))
+    raises(TypeError, lambda: gmpy2.lucasuv_mod_batch([(3,2,5)]))
+    raises(TypeError, lambda: gmpy2.lucasuv_mod_batch([[3,2,5,7]]))
+
+
+def test_crtbasis():
+    ms = [3, 5, 7, 11, 13]
+    b = gmpy2.CRTBasis(ms)
+
+    assert len(b) == 5
+    assert b.moduli == tuple(map(mpz, ms))
+    assert b.modulus == 15015
+    assert repr(b) == '<gmpy2.CRTBasis with 5 moduli>'
+
+    for x in [0, 1, 52, 15014, 15015, -1, 10**20, -10**20]:
+        r = b.reduce(x)
+        assert r == [x % m for m in ms]
+        assert b.reconstruct(r) == x % 15015
+        assert b.reconstruct([a - 3*m for a, m in zip(r, ms)]) == x % 15015
+
+    ps = [gmpy2.next_prime(mpz(2)**64 + 1000*i) for i in range(37)]
+    b = gmpy2.CRTBasis(ps)
+    x = mpz(3)**1500 % b.modulus
+    assert b.reduce(x) == [x % p for p in ps]
+    assert b.reconstruct(b.reduce(x)) == x
+
+    assert gmpy2.CRTBasis([7]).reduce(-1) == [6]
+    assert gmpy2.CRTBasis([7]).reconstruct([9]) == 2
+    assert gmpy2.CRTBasis([1, 3]).reconstruct([0, 2]) == 2
+
+    raises(ValueError, lambda: gmpy2.CRTBasis([]))
+    raises(ValueError, lambda: gmpy2.CRTBasis([6, 4]))
+    raises(ValueError, lambda: gmpy2.CRTBasis([3, 0]))
+    raises(TypeError, lambda: gmpy2.CRTBasis([3, 'a']))
+    raises(TypeError, lambda: gmpy2.CRTBasis(3))
+    raises(TypeError, lambda: gmpy2.CRTBasis())
+    raises(ValueError, lambda: b.reconstruct([1, 2]))
+    raises(TypeError, lambda: b.reconstruct([1.5]*37))
+    raises(TypeError, lambda: b.reduce(1.5))
+
+
 def test_mpz_attributes():
     a = mpz(123)
 
@@ -1778,6 +1862,72 @@ def test_mpz_hamdist():
     raises(TypeError, lambda: gmpy2.hamdist(5,6,5))
 
 
+def test_mpz_popcount_hamdist_many():
+    values = [0, 7, mpz(8), xmpz(15), -65, 2**200 - 1, mpz(2)**100]
+
+    assert gmpy2.popcount_many(values) == [gmpy2.popcount(x) for x in values]
+    assert gmpy2.popcount_many(iter([1, 3])) == [1, 2]
+    assert gmpy2.popcount_many([]) == []
+    assert gmpy2.hamdist_many(mpz(5), [7, mpz(0), xmpz(5), 2**70]) == [1, 2, 0, 3]
+    assert gmpy2.hamdist_many(-1, [-2, mpz(-8)]) == [1, 3]
+    assert gmpy2.hamdist_many(2**100, []) == []
+
+    raises(TypeError, lambda: gmpy2.popcount_many([1, 4.5]))
+    raises(TypeError, lambda: gmpy2.popcount_many(5))
+    raises(TypeError, lambda: gmpy2.hamdist_many(mpq(14,2), [5]))
+    raises(TypeError, lambda: gmpy2.hamdist_many(5, [6, 'a']))
+    raises(TypeError, lambda: gmpy2.hamdist_many(5))
+
+    class BadMpz:
+        def __mpz__(self):
+            return 'a'
+
+    raises(TypeError, lambda: gmpy2.popcount_many([1, BadMpz()]),
+           match='cannot convert')
+    raises(TypeError, lambda: gmpy2.hamdist_many(5, [BadMpz()]),
+           match='cannot convert')
+    raises(TypeError, lambda: gmpy2.hamdist_many(BadMpz(), [5]),
+           match='cannot convert')
+
+
+def test_mpz_popcount_hamdist_many_buffer():
+    import array
+    import sys
+
+    words = [0, 1, 3, 2**64 - 1, 2**63 + 5, 12345678901234567]
+    buf = array.array('Q', words)
+    data = buf.tobytes()
+
+    assert gmpy2.popcount_many(b'\x01\x03\xff') == [1, 2, 8]
+    assert gmpy2.popcount_many(buf) == [gmpy2.popcount(w) for w in words]
+    assert gmpy2.popcount_many(data, width=8) == gmpy2.popcount_many(words)
+    assert gmpy2.popcount_many(data[1:-7], width=8) == \
+        gmpy2.popcount_many(array.array('Q', data[1:-7]))
+    assert gmpy2.popcount_many(buf, width=16) == \
+        [gmpy2.popcount(words[i]) + gmpy2.popcount(words[i + 1])
+         for i in range(0, len(words), 2)]
+    assert gmpy2.popcount_many(data, width=3) == \
+        [gmpy2.popcount(int.from_bytes(data[i:i + 3], sys.byteorder))
+         for i in range(0, len(data), 3)]
+    assert gmpy2.popcount_many(b'') == []
+
+    assert gmpy2.hamdist_many(5, buf) == [gmpy2.hamdist(5, w) for w in words]
+    assert gmpy2.hamdist_many(mpz(5), data, width=8) == gmpy2.hamdist_many(5, words)
+    x = 2**127 + 2**64 + 3
+    assert gmpy2.hamdist_many(x, data, width=16) == \
+        [gmpy2.hamdist(x, int.from_bytes(data[i:i + 16], sys.byteorder))
+         for i in range(0, len(data), 16)]
+    assert gmpy2.hamdist_many(0x0301, data, width=2) == \
+        [gmpy2.hamdist(0x0301, int.from_bytes(data[i:i + 2], sys.byteorder))
+         for i in range(0, len(data), 2)]
+
+    raises(ValueError, lambda: gmpy2.popcount_many(b'abc', width=2))
+    raises(ValueError, lambda: gmpy2.popcount_many(b'abc', width=-1))
+    raises(ValueError, lambda: gmpy2.hamdist_many(-1, b'a'))
+    raises(ValueError, lambda: gmpy2.hamdist_many(256, b'a'))
+    raises(TypeError, lambda: gmpy2.popcount_many(b'a', 1, 2))
+
+
 def test_issue_339():
     samples = map(mpz, [13157547707030902665, 1070317427780135395,
                         18019609787501108695, 3978762157568107671,
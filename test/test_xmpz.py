@@ -142,6 +142,94 @@ def test_xmpz_subscripts():
     assert x == xmpz(16)
 
 
+def test_xmpz_progressions():
+    x = xmpz(0)
+    x.set_progression(1, 3, 20)
+    assert x == sum(1 << i for i in range(1, 20, 3))
+    x.clear_progression(4, 6, 20)
+    assert x == sum(1 << i for i in range(1, 20, 6))
+    x.clear_progression(1, 1, 1000)
+    assert x == 0
+
+    for step in (1, 2, 3, 7, 63, 64, 65, 200):
+        x = xmpz(0)
+        x.set_progression(5, step, 1000)
+        y = xmpz(0)
+        y[5:1000:step] = -1
+        assert x == y
+        x.clear_progression(9, step, 700)
+        y[9:700:step] = 0
+        assert x == y
+
+    x = xmpz(-1000)
+    x.clear_progression(3, 2, 20)
+    y = xmpz(-1000)
+    y[3:20:2] = 0
+    assert x == y
+
+    pytest.raises(ValueError, lambda: x.set_progression(0, 0, 10))
+    pytest.raises(TypeError, lambda: x.set_progression(0, 1))
+    pytest.raises(OverflowError, lambda: x.clear_progression(-1, 1, 10))
+
+
+def test_xmpz_sieve_clear():
+    limit = 100000
+    x = xmpz(0)
+    x[0:limit] = -1
+    x[0:2] = 0
+    primes = [p for p in range(2, 317) if x[p]
+              and all(p % q for q in range(2, p))]
+    x.sieve_clear(primes, [p * p for p in primes])
+    assert list(x.iter_set()) == [n for n in range(limit)
+                                  if gmpy2.is_prime(n)]
+
+    x = xmpz(2**200 - 1)
+    y = x.copy()
+    x.sieve_clear([3, 70, 5], [1, 0, 190])
+    y[1::3] = 0
+    y[0::70] = 0
+    y[190::5] = 0
+    assert x == y
+
+    x = xmpz(-12345)
+    y = x.copy()
+    x.sieve_clear([3], [2])
+    y[2::3] = 0
+    assert x == y
+
+    x.sieve_clear([], [])
+    assert x == y
+
+    pytest.raises(ValueError, lambda: x.sieve_clear([2, 3], [1]))
+    pytest.raises(ValueError, lambda: x.sieve_clear([0], [1]))
+    pytest.raises(TypeError, lambda: x.sieve_clear(3, [1]))
+    pytest.raises(TypeError, lambda: x.sieve_clear([2]))
+
+
+@settings(max_examples=1000)
+@example(0, 0, 64, 1, -1)
+@example(2**200 - 1, 3, 197, 1, 0)
+@example(2**130 + 5, 129, 2, -1, 2**100 + 7)
+@given(integers(min_value=0, max_value=2**300), integers(0, 400),
+       integers(0, 400), integers(-70, 70),
+       integers(min_value=-1, max_value=2**300))
+def test_xmpz_slices_word_level(v, start, stop, step, value):
+    # Compare the slices against single bit access.
+    x = xmpz(v)
+    sl = slice(start, stop, step or 1)
+
+    r = 0
+    for i, c in enumerate(range(*sl.indices(len(x)))):
+        r |= x[c] << i
+    assert x[sl] == r
+
+    y = xmpz(v)
+    for i, c in enumerate(range(*sl.indices(max(len(x), stop)))):
+        y[c] = 1 if value == -1 else (value >> i) & 1
+    x[sl] = value
+    assert x == y
+
+
 def test_xmpz_iterators():
     x = xmpz(16)
 
@@ -160,6 +248,148 @@ def test_xmpz_iterators():
     assert [b for b in x.iter_clear()] == [0, 2]
 
 
+def test_xmpz_batched_iterators():
+    x = xmpz(0b1110011)
+
+    assert x.set_positions() == [0, 1, 4, 5, 6]
+    assert x.set_positions(1, 5) == [1, 4]
+    assert list(x.iter_set_batched(2)) == [[0, 1], [4, 5], [6]]
+    assert list(x.iter_set_batched(3, 1)) == [[1, 4, 5], [6]]
+    assert list(x.iter_runs()) == [(0, 2), (4, 3)]
+    assert list(x.iter_runs(1, 5)) == [(1, 1), (4, 1)]
+    assert list(xmpz(0).iter_runs()) == []
+    assert list(xmpz(0).iter_set_batched(5)) == []
+
+    x = xmpz(0)
+    x[0:1000] = -1
+    x.clear_progression(0, 7, 1000)
+    positions = [i for i in range(1000) if i % 7]
+
+    assert x.set_positions() == positions
+    assert sum(x.iter_set_batched(64), []) == positions
+    assert [len(b) for b in x.iter_set_batched(300)] == [300, 300, 257]
+    assert list(x.iter_runs()) == [(i + 1, min(6, 999 - i))
+                                   for i in range(0, 1000, 7)]
+
+    x = xmpz(-6)
+
+    assert x.set_positions() == [1]
+    assert x.set_positions(0, 6) == [1, 3, 4, 5]
+    assert list(x.iter_set_batched(3, 0, 6)) == [[1, 3, 4], [5]]
+    assert list(x.iter_runs(0, 6)) == [(1, 1), (3, 3)]
+
+    pytest.raises(ValueError, lambda: x.iter_set_batched(0))
+    pytest.raises(TypeError, lambda: x.iter_set_batched())
+
+
+
+def test_xmpz_rank_select():
+    x = xmpz(0b1011001)
+
+    assert [x.rank1(i) for i in range(9)] == [0, 1, 1, 1, 2, 3, 3, 4, 4]
+    assert [x.select1(k) for k in range(4)] == [0, 3, 4, 6]
+    assert xmpz(0).rank1(100) == 0
+
+    pytest.raises(IndexError, lambda: x.select1(4))
+    pytest.raises(IndexError, lambda: xmpz(0).select1(0))
+    pytest.raises(ValueError, lambda: xmpz(-1).rank1(0))
+    pytest.raises(ValueError, lambda: xmpz(-1).select1(0))
+
+    x = xmpz(0)
+    x[0:200000] = -1
+    x.clear_progression(0, 3, 200000)
+    positions = x.set_positions()
+
+    for k in range(0, len(positions), 997):
+        assert x.select1(k) == positions[k]
+        assert x.rank1(positions[k]) == k
+    assert x.rank1(200000) == len(positions)
+
+    x[1] = 0
+
+    assert x.select1(0) == 2
+    assert x.rank1(3) == 1
+
+    x += 1
+
+    assert x.rank1(3) == 2
+
+    x.set_progression(0, 1, 10)
+
+    assert x.select1(9) == 9
+    assert x.rank1(200000) == len(positions) + 4
+
+    x >>= 100
+
+    assert x.rank1(10) == x[0:10].bit_count()
+
+
+def test_xmpz_out():
+    x = xmpz(99)
+
+    assert gmpy2.powmod(3, 100, 1000, out=x) is x
+    assert x == pow(3, 100, 1000)
+    assert gmpy2.powmod(3, -1, 7, out=x) == 5
+    assert gmpy2.powmod(3, 5, -7, out=x) == pow(3, 5, -7)
+    assert gmpy2.powmod(x, 2, 7, out=x) == 4
+    assert gmpy2.gcd(18, 30, out=x) is x
+    assert x == 6
+    assert gmpy2.gcd(x, 4, out=x) == 2
+    assert gmpy2.gcd(-8, out=x) == 8
+    assert gmpy2.gcd(out=x) == 0
+    assert gmpy2.isqrt(99, out=x) is x
+    assert x == 9
+    assert gmpy2.isqrt(x, out=x) == 3
+    assert gmpy2.invert(3, 7, out=x) is x
+    assert x == 5
+    assert gmpy2.f_div_2exp(-17, 2, out=x) is x
+    assert x == -5
+    assert type(gmpy2.isqrt(16, out=None)) is mpz
+
+    y = xmpz(0b1011)
+    y.rank1(3)
+    gmpy2.isqrt(100, out=y)
+
+    assert y.rank1(64) == 2
+
+    pytest.raises(ZeroDivisionError, lambda: gmpy2.invert(2, 4, out=x))
+    pytest.raises(ValueError, lambda: gmpy2.isqrt(-1, out=x))
+    pytest.raises(TypeError, lambda: gmpy2.gcd(4, 6, out=mpz(0)))
+    pytest.raises(TypeError, lambda: gmpy2.isqrt(4, out=4))
+    pytest.raises(TypeError, lambda: gmpy2.powmod(2, 3, 5, mod=7))
+    pytest.raises(TypeError, lambda: gmpy2.f_div_2exp(8, 1, out=x, spam=1))
+
+    # out is unchanged if an argument is invalid or the result is undefined.
+    x = xmpz(12)
+    pytest.raises(TypeError, lambda: gmpy2.gcd(18, 'a', out=x))
+    pytest.raises(TypeError, lambda: gmpy2.lcm(4, 'a', out=x))
+    pytest.raises(ZeroDivisionError, lambda: gmpy2.invert(3, 9, out=x))
+    pytest.raises(ValueError, lambda: gmpy2.powmod(3, -1, -9, out=x))
+    pytest.raises(ZeroDivisionError, lambda: gmpy2.f_div(7, 0, out=x))
+    assert x == 12
+
+    for f, args in [(gmpy2.lcm, (4, 6, 10)), (gmpy2.c_div, (-17, 5)),
+                    (gmpy2.c_mod, (-17, 5)), (gmpy2.f_div, (-17, 5)),
+                    (gmpy2.f_mod, (-17, 5)), (gmpy2.t_div, (-17, 5)),
+                    (gmpy2.t_mod, (-17, 5)), (gmpy2.c_div_2exp, (-17, 2)),
+                    (gmpy2.c_mod_2exp, (-17, 2)), (gmpy2.f_mod_2exp, (-17, 2)),
+                    (gmpy2.t_div_2exp, (-17, 2)), (gmpy2.t_mod_2exp, (-17, 2)),
+                    (gmpy2.fac, (20,)), (gmpy2.double_fac, (9,)),
+                    (gmpy2.multi_fac, (10, 3)), (gmpy2.primorial, (30,)),
+                    (gmpy2.fib, (90,)), (gmpy2.lucas, (90,)),
+                    (gmpy2.bincoef, (40, 13)), (gmpy2.bincoef, (-40, 13)),
+                    (gmpy2.comb, (40, 13)), (gmpy2.next_prime, (10**20,)),
+                    (gmpy2.next_prime, (mpz(10**20),))]:
+        assert f(*args, out=x) is x
+        assert x == f(*args)
+        assert type(f(*args, out=None)) is mpz
+        pytest.raises(TypeError, lambda: f(*args, out=1))
+
+    x = xmpz(-17)
+    assert gmpy2.t_div(x, 5, out=x) == -3
+    assert gmpy2.next_prime(x, out=x) == 2
+    assert gmpy2.lcm(x, 3, out=x) == 6
+
 def test_xmpz_conversion():
     assert xmpz('5') == xmpz(5)
     assert xmpz('5') == xmpz(5)